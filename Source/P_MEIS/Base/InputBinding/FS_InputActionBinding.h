@@ -54,9 +54,21 @@ struct FS_InputActionBinding
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Binding")
     FName Category = FName(TEXT("General"));
 
+    /** Action groups this binding belongs to besides its Category (e.g. "Combat"); toggled at runtime per player */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Binding")
+    TArray<FName> ActionGroups;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Binding")
     FText Description;
 
+    /** String table key for the display name (table is FS_InputProfile::DisplayStringTable); overrides DisplayName when set */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Binding")
+    FName DisplayNameKey;
+
+    /** String table key for the description; overrides Description when set */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Binding")
+    FName DescriptionKey;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Binding")
     TArray<FS_KeyBinding> KeyBindings;
 
@@ -0,0 +1,138 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Action Definition - Static per-action metadata shared by every profile
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+#include "InputActionValue.h"
+#include "FS_InputActionBinding.h"
+#include "FS_InputAxisBinding.h"
+#include "FS_InputActionDefinition.generated.h"
+
+/**
+ * Game-defined metadata for one action or axis (everything except the keys)
+ *
+ * Registered once in UCPP_InputActionDefinitionRegistry, usually from a DataTable using this
+ * row struct. Saved profiles only keep the fields of a binding that differ from its definition.
+ */
+USTRUCT(BlueprintType)
+struct P_MEIS_API FS_InputActionDefinition : public FTableRowBase
+{
+    GENERATED_BODY()
+
+    /** Action/axis name; DataTable rows with None use the row name */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Definition")
+    FName ActionName;
+
+    /** True for axis bindings (FS_InputAxisBinding), false for action bindings */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Definition")
+    bool bIsAxis = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Definition")
+    FText DisplayName;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Definition")
+    FName DisplayNameKey;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Definition")
+    FText Description;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Definition")
+    FName DescriptionKey;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Definition")
+    FName Category = FName(TEXT("General"));
+
+    /** Axis value type (ignored for action bindings, which are always Boolean) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Definition")
+    EInputActionValueType ValueType = EInputActionValueType::Axis1D;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Definition")
+    float Priority = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Definition")
+    bool bEnabled = true;
+
+    /** Axis tuning defaults */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Definition")
+    float DeadZone = 0.2f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Definition")
+    float Sensitivity = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Definition")
+    bool bInvert = false;
+
+    /** Dense index assigned by the registry (INDEX_NONE until registered) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Input Definition")
+    int32 ActionIndex = INDEX_NONE;
+
+    /** Copy the definition's metadata onto a binding (keys untouched) */
+    void ApplyTo(FS_InputActionBinding &Binding) const
+    {
+        Binding.InputActionName = ActionName;
+        Binding.DisplayName = DisplayName;
+        Binding.DisplayNameKey = DisplayNameKey;
+        Binding.Description = Description;
+        Binding.DescriptionKey = DescriptionKey;
+        Binding.Category = Category;
+        Binding.Priority = Priority;
+        Binding.bEnabled = bEnabled;
+    }
+
+    void ApplyTo(FS_InputAxisBinding &Binding) const
+    {
+        Binding.InputAxisName = ActionName;
+        Binding.DisplayName = DisplayName;
+        Binding.DisplayNameKey = DisplayNameKey;
+        Binding.Description = Description;
+        Binding.DescriptionKey = DescriptionKey;
+        Binding.Category = Category;
+        Binding.ValueType = ValueType;
+        Binding.Priority = Priority;
+        Binding.bEnabled = bEnabled;
+        Binding.DeadZone = DeadZone;
+        Binding.Sensitivity = Sensitivity;
+        Binding.bInvert = bInvert;
+    }
+
+    /** Definition carrying a binding's metadata (e.g. to seed the registry from a template profile) */
+    static FS_InputActionDefinition FromBinding(const FS_InputActionBinding &Binding)
+    {
+        FS_InputActionDefinition Definition;
+        Definition.ActionName = Binding.InputActionName;
+        Definition.bIsAxis = false;
+        Definition.DisplayName = Binding.DisplayName;
+        Definition.DisplayNameKey = Binding.DisplayNameKey;
+        Definition.Description = Binding.Description;
+        Definition.DescriptionKey = Binding.DescriptionKey;
+        Definition.Category = Binding.Category;
+        Definition.ValueType = EInputActionValueType::Boolean;
+        Definition.Priority = Binding.Priority;
+        Definition.bEnabled = Binding.bEnabled;
+        return Definition;
+    }
+
+    static FS_InputActionDefinition FromBinding(const FS_InputAxisBinding &Binding)
+    {
+        FS_InputActionDefinition Definition;
+        Definition.ActionName = Binding.InputAxisName;
+        Definition.bIsAxis = true;
+        Definition.DisplayName = Binding.DisplayName;
+        Definition.DisplayNameKey = Binding.DisplayNameKey;
+        Definition.Description = Binding.Description;
+        Definition.DescriptionKey = Binding.DescriptionKey;
+        Definition.Category = Binding.Category;
+        Definition.ValueType = Binding.ValueType;
+        Definition.Priority = Binding.Priority;
+        Definition.bEnabled = Binding.bEnabled;
+        Definition.DeadZone = Binding.DeadZone;
+        Definition.Sensitivity = Binding.Sensitivity;
+        Definition.bInvert = Binding.bInvert;
+        return Definition;
+    }
+};
@@ -0,0 +1,144 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Action Rate - Fixed-memory sliding-window action counters (1s / 10s / 60s)
+ *               Used for actions-per-minute and per-action rates
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FS_InputActionRate.generated.h"
+
+/**
+ * Snapshot of an action rate counter
+ * Counts are the number of Started events inside each trailing window
+ */
+USTRUCT(BlueprintType)
+struct P_MEIS_API FS_InputActionRates
+{
+    GENERATED_BODY()
+
+    /** Events in the last second (100 ms resolution) */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Rate")
+    int32 Count1s = 0;
+
+    /** Events in the last 10 seconds (1 s resolution) */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Rate")
+    int32 Count10s = 0;
+
+    /** Events in the last 60 seconds (1 s resolution) - this is the APM value */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Rate")
+    int32 Count60s = 0;
+
+    /** Events per second averaged over the last 10 seconds */
+    float GetRatePerSecond10s() const { return Count10s / 10.0f; }
+
+    FS_InputActionRates &operator+=(const FS_InputActionRates &Other)
+    {
+        Count1s += Other.Count1s;
+        Count10s += Other.Count10s;
+        Count60s += Other.Count60s;
+        return *this;
+    }
+};
+
+/**
+ * Bucketed sliding-window event counter with fixed memory
+ *
+ * - Fine ring: 10 x 100 ms buckets -> 1 s window
+ * - Coarse ring: 60 x 1 s buckets -> 10 s and 60 s windows
+ *
+ * Each window keeps a running sum, so Record() is a couple of increments and
+ * reads are O(1) once expired buckets are retired (at most 10 + 60 steps, and
+ * only after long idle gaps - a gap longer than a window clears it outright).
+ */
+struct FInputRateCounter
+{
+    static constexpr int32 FineBucketCount = 10;
+    static constexpr int32 CoarseBucketCount = 60;
+    static constexpr int32 MidWindowBuckets = 10;
+
+    /** Record one event at TimeSeconds */
+    void Record(double TimeSeconds)
+    {
+        Advance(TimeSeconds);
+        FineBuckets[FineTick % FineBucketCount]++;
+        CoarseBuckets[CoarseTick % CoarseBucketCount]++;
+        Sum1s++;
+        Sum10s++;
+        Sum60s++;
+    }
+
+    /** Retire expired buckets and return the window counts at TimeSeconds */
+    FS_InputActionRates Read(double TimeSeconds)
+    {
+        Advance(TimeSeconds);
+
+        FS_InputActionRates Rates;
+        Rates.Count1s = Sum1s;
+        Rates.Count10s = Sum10s;
+        Rates.Count60s = Sum60s;
+        return Rates;
+    }
+
+    void Reset()
+    {
+        *this = FInputRateCounter();
+    }
+
+private:
+    uint16 FineBuckets[FineBucketCount] = {};
+    uint16 CoarseBuckets[CoarseBucketCount] = {};
+    int64 FineTick = 0;
+    int64 CoarseTick = 0;
+    int32 Sum1s = 0;
+    int32 Sum10s = 0;
+    int32 Sum60s = 0;
+
+    void Advance(double TimeSeconds)
+    {
+        const int64 NewFineTick = FMath::FloorToInt64(TimeSeconds * 10.0);
+        if (NewFineTick > FineTick)
+        {
+            if (NewFineTick - FineTick >= FineBucketCount)
+            {
+                FMemory::Memzero(FineBuckets);
+                Sum1s = 0;
+            }
+            else
+            {
+                for (int64 Tick = FineTick + 1; Tick <= NewFineTick; ++Tick)
+                {
+                    uint16 &Bucket = FineBuckets[Tick % FineBucketCount];
+                    Sum1s -= Bucket;
+                    Bucket = 0;
+                }
+            }
+            FineTick = NewFineTick;
+        }
+
+        const int64 NewCoarseTick = FMath::FloorToInt64(TimeSeconds);
+        if (NewCoarseTick > CoarseTick)
+        {
+            if (NewCoarseTick - CoarseTick >= CoarseBucketCount)
+            {
+                FMemory::Memzero(CoarseBuckets);
+                Sum10s = 0;
+                Sum60s = 0;
+            }
+            else
+            {
+                for (int64 Tick = CoarseTick + 1; Tick <= NewCoarseTick; ++Tick)
+                {
+                    // Bucket Tick-10 leaves the 10 s window; bucket Tick (last used at Tick-60) leaves the 60 s window
+                    Sum10s -= CoarseBuckets[(Tick - MidWindowBuckets + CoarseBucketCount) % CoarseBucketCount];
+                    uint16 &Bucket = CoarseBuckets[Tick % CoarseBucketCount];
+                    Sum60s -= Bucket;
+                    Bucket = 0;
+                }
+            }
+            CoarseTick = NewCoarseTick;
+        }
+    }
+};
@@ -0,0 +1,77 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Command - Settings and counters for replicated per-frame input commands
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FS_InputCommand.generated.h"
+
+/**
+ * How input commands are packed
+ * Client and server must use the same settings (checked through the layout hash).
+ */
+USTRUCT(BlueprintType)
+struct P_MEIS_API FS_InputCommandSettings
+{
+    GENERATED_BODY()
+
+    /** Bits per quantized axis component (2-16) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Command", meta = (ClampMin = "2", ClampMax = "16"))
+    int32 AxisBits = 8;
+
+    /** Axis components are clamped to [-AxisRange, AxisRange] before quantizing */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Command", meta = (ClampMin = "0.01"))
+    float AxisRange = 1.0f;
+
+    /** Frames carried by every packet (newest plus older, unacknowledged ones) so single losses are recovered */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Command", meta = (ClampMin = "1", ClampMax = "8"))
+    int32 RedundantFrames = 3;
+};
+
+/**
+ * Traffic counters for one input command stream
+ */
+USTRUCT(BlueprintType)
+struct P_MEIS_API FS_InputCommandStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Input Command")
+    int32 PacketsSent = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Input Command")
+    int32 PacketsReceived = 0;
+
+    /** Payload bits sent (client) or received (server) */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Command")
+    int64 PayloadBits = 0;
+
+    /** Frames written as a delta against an acknowledged frame rather than from zero */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Command")
+    int32 DeltaFrames = 0;
+
+    /** Frames applied on the server */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Command")
+    int32 FramesApplied = 0;
+
+    /** Frames applied from a redundant copy because the packet carrying them first was lost */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Command")
+    int32 FramesRecovered = 0;
+
+    /** Frames lost for good (gap wider than the redundancy window) */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Command")
+    int32 FramesLost = 0;
+
+    /** Packets dropped because the sender's layout or baseline did not match */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Command")
+    int32 PacketsRejected = 0;
+
+    float GetAverageBitsPerPacket() const
+    {
+        const int32 Packets = PacketsSent + PacketsReceived;
+        return Packets > 0 ? static_cast<float>(PayloadBits) / Packets : 0.0f;
+    }
+};
@@ -0,0 +1,40 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Mapping Batch Stats - Counters for coalesced control-mapping rebuilds
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FS_InputMappingBatchStats.generated.h"
+
+/**
+ * Mapping context changes and control-mapping rebuilds since start (or the last reset)
+ * RebuildsRequested / RebuildsPerformed is how many rebuilds batching saved.
+ */
+USTRUCT(BlueprintType)
+struct P_MEIS_API FS_InputMappingBatchStats
+{
+    GENERATED_BODY()
+
+    /** Rebuilds asked for by mapping context adds, removes and content changes */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Mapping")
+    int32 RebuildsRequested = 0;
+
+    /** Rebuilds actually run (at most one per local player per frame) */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Mapping")
+    int32 RebuildsPerformed = 0;
+
+    /** Mapping contexts added to (or re-prioritised on) a local player */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Mapping")
+    int32 ContextsAdded = 0;
+
+    /** Mapping contexts removed from a local player */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Mapping")
+    int32 ContextsRemoved = 0;
+
+    /** Adds skipped because the context was already applied at that priority */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Mapping")
+    int32 RedundantAddsSkipped = 0;
+};
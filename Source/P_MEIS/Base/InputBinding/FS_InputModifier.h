@@ -311,4 +311,66 @@ struct P_MEIS_API FS_InputModifierConfig
         Config.CurveExponent = Exponent;
         return Config;
     }
+
+    // ==================== Comparison ====================
+    // Full-value identity, used to share modifier instances between mappings
+
+    bool operator==(const FS_InputModifierConfig &Other) const
+    {
+        return ModifierType == Other.ModifierType &&
+               bEnabled == Other.bEnabled &&
+               DeadZoneLower == Other.DeadZoneLower &&
+               DeadZoneUpper == Other.DeadZoneUpper &&
+               DeadZoneType == Other.DeadZoneType &&
+               ScaleVector == Other.ScaleVector &&
+               bNegateX == Other.bNegateX &&
+               bNegateY == Other.bNegateY &&
+               bNegateZ == Other.bNegateZ &&
+               SwizzleOrder == Other.SwizzleOrder &&
+               CurveExponent == Other.CurveExponent &&
+               SmoothingMethod == Other.SmoothingMethod &&
+               SmoothingSpeed == Other.SmoothingSpeed &&
+               EasingExponent == Other.EasingExponent &&
+               FOVScale == Other.FOVScale &&
+               ClampMin == Other.ClampMin &&
+               ClampMax == Other.ClampMax &&
+               CustomModifierClass == Other.CustomModifierClass;
+    }
+
+    bool operator!=(const FS_InputModifierConfig &Other) const
+    {
+        return !(*this == Other);
+    }
+
+    friend uint32 GetTypeHash(const FS_InputModifierConfig &Config)
+    {
+        uint32 Hash = GetTypeHash(static_cast<uint8>(Config.ModifierType));
+        Hash = HashCombine(Hash, GetTypeHash(Config.bEnabled));
+        Hash = HashCombine(Hash, GetTypeHash(Config.DeadZoneLower));
+        Hash = HashCombine(Hash, GetTypeHash(Config.DeadZoneUpper));
+        Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Config.DeadZoneType)));
+        Hash = HashCombine(Hash, GetTypeHash(Config.ScaleVector));
+        Hash = HashCombine(Hash, GetTypeHash((Config.bNegateX ? 1u : 0u) | (Config.bNegateY ? 2u : 0u) | (Config.bNegateZ ? 4u : 0u)));
+        Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Config.SwizzleOrder)));
+        Hash = HashCombine(Hash, GetTypeHash(Config.CurveExponent));
+        Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Config.SmoothingMethod)));
+        Hash = HashCombine(Hash, GetTypeHash(Config.SmoothingSpeed));
+        Hash = HashCombine(Hash, GetTypeHash(Config.EasingExponent));
+        Hash = HashCombine(Hash, GetTypeHash(Config.FOVScale));
+        Hash = HashCombine(Hash, GetTypeHash(Config.ClampMin));
+        Hash = HashCombine(Hash, GetTypeHash(Config.ClampMax));
+        Hash = HashCombine(Hash, GetTypeHash(Config.CustomModifierClass.Get()));
+        return Hash;
+    }
+
+    /**
+     * Whether a modifier of this type keeps per-frame state (smoothing history etc.)
+     * Stateful modifiers must never be shared between mappings
+     */
+    static bool IsStatefulType(EInputModifierType Type)
+    {
+        return Type == EInputModifierType::Smooth ||
+               Type == EInputModifierType::SmoothDelta ||
+               Type == EInputModifierType::Custom;
+    }
 };
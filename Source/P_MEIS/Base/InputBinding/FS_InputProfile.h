@@ -10,6 +10,7 @@
 #include "FS_InputActionBinding.h"
 #include "FS_InputAxisBinding.h"
 #include "FS_InputModifier.h"
+#include "FS_StickCalibration.h"
 #include "FS_InputProfile.generated.h"
 
 /**
@@ -26,6 +27,10 @@ struct FS_InputProfile
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Profile")
     FText ProfileDescription;
 
+    /** String table holding binding display text (DisplayNameKey / DescriptionKey); None uses the literal FText on each binding */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Profile")
+    FName DisplayStringTable;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Profile")
     TArray<FS_InputActionBinding> ActionBindings;
 
@@ -50,6 +55,14 @@ struct FS_InputProfile
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Profile")
     TMap<FName, bool> ToggleActionStates;
 
+    /** Estimate each gamepad's stick drift while it rests and replace the bindings' fixed stick dead zone */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Profile")
+    bool bAutoCalibrateSticks = false;
+
+    /** Stick calibrations per input device (kept up to date while bAutoCalibrateSticks is on) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Profile")
+    TArray<FS_DeviceStickCalibration> StickCalibrations;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Profile")
     FDateTime Timestamp = FDateTime::Now();
 
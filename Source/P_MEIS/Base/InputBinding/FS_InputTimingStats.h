@@ -0,0 +1,301 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Timing Stats - Streaming inter-press / hold-duration statistics per action
+ *               Flags machine-like timing (macros, turbo) with fixed memory per action
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FS_InputTimingStats.generated.h"
+
+/**
+ * Timing anomalies that can be flagged for an action (bitmask)
+ */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EP_MEIS_TimingAnomaly : uint8
+{
+    None = 0 UMETA(Hidden),
+    // Press-to-press intervals are too regular
+    LowIntervalVariance = 0x01 UMETA(DisplayName = "Low Interval Variance"),
+    // Press-to-press intervals fall into too few histogram bins
+    LowIntervalEntropy = 0x02 UMETA(DisplayName = "Low Interval Entropy"),
+    // The same interval repeated many presses in a row
+    RepeatedInterval = 0x04 UMETA(DisplayName = "Repeated Interval"),
+    // Hold durations are too regular
+    LowHoldVariance = 0x08 UMETA(DisplayName = "Low Hold Variance")
+};
+ENUM_CLASS_FLAGS(EP_MEIS_TimingAnomaly)
+
+/**
+ * Thresholds for timing anomaly detection
+ * A check only runs once it has MinSamples samples
+ */
+USTRUCT(BlueprintType)
+struct P_MEIS_API FS_InputTimingThresholds
+{
+    GENERATED_BODY()
+
+    /** Collect timing stats at all (off by default) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Timing")
+    bool bEnabled = false;
+
+    /** Samples required before interval/hold checks run */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Timing", meta = (ClampMin = "2"))
+    int32 MinSamples = 20;
+
+    /** Flag when press-to-press standard deviation drops below this (ms). 0 disables */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Timing", meta = (ClampMin = "0.0"))
+    float MinIntervalStdDevMs = 3.0f;
+
+    /** Flag when interval histogram entropy drops below this (bits). 0 disables */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Timing", meta = (ClampMin = "0.0"))
+    float MinIntervalEntropyBits = 1.0f;
+
+    /** Flag when this many consecutive intervals match within RepeatToleranceMs. 0 disables */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Timing", meta = (ClampMin = "0"))
+    int32 MaxRepeatedIntervals = 12;
+
+    /** Two intervals closer than this count as a repeat (ms) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Timing", meta = (ClampMin = "0.0"))
+    float RepeatToleranceMs = 0.5f;
+
+    /** Flag when hold-duration standard deviation drops below this (ms). 0 disables */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Timing", meta = (ClampMin = "0.0"))
+    float MinHoldStdDevMs = 2.0f;
+
+    /** Gaps longer than this are pauses, not intervals, and are not sampled (seconds) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Timing", meta = (ClampMin = "0.01"))
+    float MaxIntervalSeconds = 1.0f;
+};
+
+/**
+ * Snapshot of one action's timing statistics
+ */
+USTRUCT(BlueprintType)
+struct P_MEIS_API FS_InputTimingReport
+{
+    GENERATED_BODY()
+
+    /** EP_MEIS_TimingAnomaly flags currently tripped */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Timing", meta = (Bitmask, BitmaskEnum = "/Script/P_MEIS.EP_MEIS_TimingAnomaly"))
+    int32 AnomalyFlags = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Input Timing")
+    int32 IntervalSamples = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Input Timing")
+    float IntervalMeanMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Input Timing")
+    float IntervalStdDevMs = 0.0f;
+
+    /** Shannon entropy of the interval histogram (8 ms bins) */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Timing")
+    float IntervalEntropyBits = 0.0f;
+
+    /** Consecutive intervals matching the previous one */
+    UPROPERTY(BlueprintReadOnly, Category = "Input Timing")
+    int32 RepeatedIntervalStreak = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Input Timing")
+    int32 HoldSamples = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Input Timing")
+    float HoldMeanMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Input Timing")
+    float HoldStdDevMs = 0.0f;
+
+    bool HasAnomaly(EP_MEIS_TimingAnomaly Anomaly) const
+    {
+        return (AnomalyFlags & static_cast<int32>(Anomaly)) != 0;
+    }
+};
+
+/**
+ * Welford running mean/variance
+ * Weight is capped: past MaxWeight samples the history is halved, so the stats
+ * keep following the player instead of freezing on an hour of old data.
+ */
+struct FInputRunningStats
+{
+    static constexpr int32 MaxWeight = 256;
+
+    int32 Count = 0;
+    double Mean = 0.0;
+    double M2 = 0.0;
+
+    void Add(double Sample)
+    {
+        if (Count >= MaxWeight)
+        {
+            Count /= 2;
+            M2 *= 0.5;
+        }
+
+        Count++;
+        const double Delta = Sample - Mean;
+        Mean += Delta / Count;
+        M2 += Delta * (Sample - Mean);
+    }
+
+    double GetVariance() const { return Count > 1 ? M2 / (Count - 1) : 0.0; }
+    double GetStdDev() const { return FMath::Sqrt(GetVariance()); }
+};
+
+/**
+ * Fixed-bin interval histogram with incrementally maintained entropy
+ *
+ * Keeps S = sum(n * log2 n) so H = log2(N) - S / N costs two logs per sample
+ * instead of a pass over the bins. Bins are halved once MaxTotal is reached.
+ */
+struct FInputIntervalHistogram
+{
+    static constexpr int32 BinCount = 64;
+    static constexpr double BinWidthMs = 8.0;
+    static constexpr int32 MaxTotal = 512;
+
+    void Add(double IntervalMs)
+    {
+        if (Total >= MaxTotal)
+        {
+            Decay();
+        }
+
+        const int32 Bin = FMath::Clamp(FMath::FloorToInt32(IntervalMs / BinWidthMs), 0, BinCount - 1);
+        const int32 N = Bins[Bin];
+        SumNLogN += NLogN(N + 1) - NLogN(N);
+        Bins[Bin] = static_cast<uint16>(N + 1);
+        Total++;
+    }
+
+    double GetEntropyBits() const
+    {
+        return Total > 0 ? FMath::Log2(static_cast<double>(Total)) - SumNLogN / Total : 0.0;
+    }
+
+private:
+    uint16 Bins[BinCount] = {};
+    int32 Total = 0;
+    double SumNLogN = 0.0;
+
+    static double NLogN(int32 N)
+    {
+        return N > 1 ? N * FMath::Log2(static_cast<double>(N)) : 0.0;
+    }
+
+    void Decay()
+    {
+        Total = 0;
+        SumNLogN = 0.0;
+        for (uint16 &Bin : Bins)
+        {
+            Bin /= 2;
+            Total += Bin;
+            SumNLogN += NLogN(Bin);
+        }
+    }
+};
+
+/**
+ * Per-action timing tracker fed from press/release timestamps
+ */
+struct FInputTimingTracker
+{
+    FInputRunningStats Intervals;
+    FInputRunningStats Holds;
+    FInputIntervalHistogram IntervalHistogram;
+
+    /** Flags already reported; only newly tripped flags are broadcast */
+    EP_MEIS_TimingAnomaly ReportedAnomalies = EP_MEIS_TimingAnomaly::None;
+
+    void RecordPress(double TimeSeconds, const FS_InputTimingThresholds &Thresholds)
+    {
+        if (LastPressTime >= 0.0)
+        {
+            const double Interval = TimeSeconds - LastPressTime;
+            if (Interval <= Thresholds.MaxIntervalSeconds)
+            {
+                const double IntervalMs = Interval * 1000.0;
+                Intervals.Add(IntervalMs);
+                IntervalHistogram.Add(IntervalMs);
+
+                RepeatStreak = (LastIntervalMs >= 0.0 && FMath::Abs(IntervalMs - LastIntervalMs) <= Thresholds.RepeatToleranceMs) ? RepeatStreak + 1 : 0;
+                LastIntervalMs = IntervalMs;
+            }
+            else
+            {
+                // A pause breaks the rhythm
+                RepeatStreak = 0;
+                LastIntervalMs = -1.0;
+            }
+        }
+        LastPressTime = TimeSeconds;
+        PressStartTime = TimeSeconds;
+    }
+
+    void RecordRelease(double TimeSeconds)
+    {
+        if (PressStartTime >= 0.0)
+        {
+            Holds.Add((TimeSeconds - PressStartTime) * 1000.0);
+            PressStartTime = -1.0;
+        }
+    }
+
+    EP_MEIS_TimingAnomaly Evaluate(const FS_InputTimingThresholds &Thresholds) const
+    {
+        EP_MEIS_TimingAnomaly Flags = EP_MEIS_TimingAnomaly::None;
+
+        if (Intervals.Count >= Thresholds.MinSamples)
+        {
+            if (Thresholds.MinIntervalStdDevMs > 0.0f && Intervals.GetStdDev() < Thresholds.MinIntervalStdDevMs)
+            {
+                Flags |= EP_MEIS_TimingAnomaly::LowIntervalVariance;
+            }
+            if (Thresholds.MinIntervalEntropyBits > 0.0f && IntervalHistogram.GetEntropyBits() < Thresholds.MinIntervalEntropyBits)
+            {
+                Flags |= EP_MEIS_TimingAnomaly::LowIntervalEntropy;
+            }
+        }
+
+        if (Thresholds.MaxRepeatedIntervals > 0 && RepeatStreak >= Thresholds.MaxRepeatedIntervals)
+        {
+            Flags |= EP_MEIS_TimingAnomaly::RepeatedInterval;
+        }
+
+        if (Holds.Count >= Thresholds.MinSamples && Thresholds.MinHoldStdDevMs > 0.0f && Holds.GetStdDev() < Thresholds.MinHoldStdDevMs)
+        {
+            Flags |= EP_MEIS_TimingAnomaly::LowHoldVariance;
+        }
+        return Flags;
+    }
+
+    FS_InputTimingReport MakeReport(EP_MEIS_TimingAnomaly Flags) const
+    {
+        FS_InputTimingReport Report;
+        Report.AnomalyFlags = static_cast<int32>(Flags);
+        Report.IntervalSamples = Intervals.Count;
+        Report.IntervalMeanMs = static_cast<float>(Intervals.Mean);
+        Report.IntervalStdDevMs = static_cast<float>(Intervals.GetStdDev());
+        Report.IntervalEntropyBits = static_cast<float>(IntervalHistogram.GetEntropyBits());
+        Report.RepeatedIntervalStreak = RepeatStreak;
+        Report.HoldSamples = Holds.Count;
+        Report.HoldMeanMs = static_cast<float>(Holds.Mean);
+        Report.HoldStdDevMs = static_cast<float>(Holds.GetStdDev());
+        return Report;
+    }
+
+    void Reset()
+    {
+        *this = FInputTimingTracker();
+    }
+
+private:
+    double LastPressTime = -1.0;
+    double PressStartTime = -1.0;
+    double LastIntervalMs = -1.0;
+    int32 RepeatStreak = 0;
+};
@@ -220,4 +220,57 @@ struct P_MEIS_API FS_InputTriggerConfig
         Config.ChordActionName = RequiredActionName;
         return Config;
     }
+
+    // ==================== Comparison ====================
+    // Full-value identity, used to share trigger instances between mappings
+
+    bool operator==(const FS_InputTriggerConfig &Other) const
+    {
+        return TriggerType == Other.TriggerType &&
+               bEnabled == Other.bEnabled &&
+               ActuationThreshold == Other.ActuationThreshold &&
+               HoldTimeThreshold == Other.HoldTimeThreshold &&
+               bIsOneShot == Other.bIsOneShot &&
+               bAffectedByTimeDilation == Other.bAffectedByTimeDilation &&
+               TapReleaseTimeThreshold == Other.TapReleaseTimeThreshold &&
+               bTriggerOnStart == Other.bTriggerOnStart &&
+               PulseInterval == Other.PulseInterval &&
+               PulseTriggerLimit == Other.PulseTriggerLimit &&
+               ChordActionName == Other.ChordActionName &&
+               CustomTriggerClass == Other.CustomTriggerClass;
+    }
+
+    bool operator!=(const FS_InputTriggerConfig &Other) const
+    {
+        return !(*this == Other);
+    }
+
+    friend uint32 GetTypeHash(const FS_InputTriggerConfig &Config)
+    {
+        uint32 Hash = GetTypeHash(static_cast<uint8>(Config.TriggerType));
+        Hash = HashCombine(Hash, GetTypeHash(Config.bEnabled));
+        Hash = HashCombine(Hash, GetTypeHash(Config.ActuationThreshold));
+        Hash = HashCombine(Hash, GetTypeHash(Config.HoldTimeThreshold));
+        Hash = HashCombine(Hash, GetTypeHash((Config.bIsOneShot ? 1u : 0u) | (Config.bAffectedByTimeDilation ? 2u : 0u) | (Config.bTriggerOnStart ? 4u : 0u)));
+        Hash = HashCombine(Hash, GetTypeHash(Config.TapReleaseTimeThreshold));
+        Hash = HashCombine(Hash, GetTypeHash(Config.PulseInterval));
+        Hash = HashCombine(Hash, GetTypeHash(Config.PulseTriggerLimit));
+        Hash = HashCombine(Hash, GetTypeHash(Config.ChordActionName));
+        Hash = HashCombine(Hash, GetTypeHash(Config.CustomTriggerClass.Get()));
+        return Hash;
+    }
+
+    /**
+     * Whether a trigger of this type tracks time or sequence state between evaluations
+     * Stateful triggers must never be shared between mappings
+     */
+    static bool IsStatefulType(EInputTriggerType Type)
+    {
+        return Type == EInputTriggerType::Hold ||
+               Type == EInputTriggerType::HoldAndRelease ||
+               Type == EInputTriggerType::Tap ||
+               Type == EInputTriggerType::Pulse ||
+               Type == EInputTriggerType::Combo ||
+               Type == EInputTriggerType::Custom;
+    }
 };
\ No newline at end of file
@@ -33,6 +33,13 @@ struct FS_PlayerInputData
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Player Input")
     FName LoadedTemplateName = NAME_None;
 
+    /** Identity of the user behind the controller (unique net id or platform user), used by the departed-player cache */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Player Input")
+    FString CacheKey;
+
+    /** Action id -> index in ActiveProfile.ActionBindings, checked against the binding's name on use */
+    TMap<int32, int32> ActionBindingIndexById;
+
     /** Default constructor */
     FS_PlayerInputData()
         : Integration(nullptr)
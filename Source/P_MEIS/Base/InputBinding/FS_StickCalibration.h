@@ -0,0 +1,94 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Stick Calibration - Per-device resting offset and dead zone of gamepad sticks
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FS_StickCalibration.generated.h"
+
+/**
+ * Calibration of one stick, estimated from samples taken while the stick was at rest
+ */
+USTRUCT(BlueprintType)
+struct FS_StickCalibration
+{
+    GENERATED_BODY()
+
+    /** Stick's 2D key name (Gamepad_Left2D / Gamepad_Right2D) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stick Calibration")
+    FName Stick;
+
+    /** Mean resting position, subtracted from every reading */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stick Calibration")
+    FVector2D CenterOffset = FVector2D::ZeroVector;
+
+    /** Spread of resting readings around CenterOffset */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stick Calibration")
+    float NoiseRadius = 0.0f;
+
+    /** Dead zone applied after the offset (NoiseRadius plus margin, clamped) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stick Calibration")
+    float DeadZone = 0.0f;
+
+    /** Resting samples behind the estimate (capped by the estimator's window) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stick Calibration")
+    int32 SampleCount = 0;
+};
+
+/**
+ * Stick calibrations of one kind of input device
+ *
+ * Keyed by hardware identity rather than FInputDeviceId: runtime device ids are handed out in
+ * connection order and name a different pad (or none) in the next session.
+ */
+USTRUCT(BlueprintType)
+struct FS_DeviceStickCalibration
+{
+    GENERATED_BODY()
+
+    /** Input class and hardware identifier of the device (see FInputStickCalibration::GetHardwareId) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stick Calibration")
+    FName HardwareId;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stick Calibration")
+    TArray<FS_StickCalibration> Sticks;
+
+    const FS_StickCalibration *FindStick(FName Stick) const
+    {
+        return Sticks.FindByPredicate([Stick](const FS_StickCalibration &Entry)
+                                      { return Entry.Stick == Stick; });
+    }
+
+    /** Find the calibration of a device's stick in a list */
+    static const FS_StickCalibration *Find(const TArray<FS_DeviceStickCalibration> &Devices, FName HardwareId, FName Stick)
+    {
+        const FS_DeviceStickCalibration *Device = Devices.FindByPredicate([HardwareId](const FS_DeviceStickCalibration &Entry)
+                                                                          { return Entry.HardwareId == HardwareId; });
+        return Device ? Device->FindStick(Stick) : nullptr;
+    }
+
+    /** Add or replace the calibration of a device's stick in a list */
+    static void Store(TArray<FS_DeviceStickCalibration> &Devices, FName HardwareId, const FS_StickCalibration &Calibration)
+    {
+        FS_DeviceStickCalibration *Device = Devices.FindByPredicate([HardwareId](const FS_DeviceStickCalibration &Entry)
+                                                                    { return Entry.HardwareId == HardwareId; });
+        if (!Device)
+        {
+            Device = &Devices.AddDefaulted_GetRef();
+            Device->HardwareId = HardwareId;
+        }
+
+        for (FS_StickCalibration &Entry : Device->Sticks)
+        {
+            if (Entry.Stick == Calibration.Stick)
+            {
+                Entry = Calibration;
+                return;
+            }
+        }
+        Device->Sticks.Add(Calibration);
+    }
+};
@@ -0,0 +1,88 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Display Text Cache Implementation
+ * @Date: 19/10/2026
+ */
+
+#include "InputBinding/InputDisplayTextCache.h"
+#include "Internationalization/Internationalization.h"
+#include "Internationalization/StringTableCore.h"
+#include "Internationalization/StringTableRegistry.h"
+
+FInputDisplayTextCache &FInputDisplayTextCache::Get()
+{
+    static FInputDisplayTextCache Cache;
+    return Cache;
+}
+
+FInputDisplayTextCache::FInputDisplayTextCache()
+{
+    CultureChangedHandle = FInternationalization::Get().OnCultureChanged().AddRaw(this, &FInputDisplayTextCache::HandleCultureChanged);
+}
+
+FInputDisplayTextCache::~FInputDisplayTextCache()
+{
+    if (FInternationalization::IsAvailable())
+    {
+        FInternationalization::Get().OnCultureChanged().Remove(CultureChangedHandle);
+    }
+}
+
+FText FInputDisplayTextCache::Resolve(FName TableId, FName Key, const FText &Fallback)
+{
+    if (TableId.IsNone() || Key.IsNone())
+    {
+        return Fallback;
+    }
+
+    const TPair<FName, FName> CacheKey(TableId, Key);
+    if (const TOptional<FText> *Cached = Resolved.Find(CacheKey))
+    {
+        return Cached->IsSet() ? Cached->GetValue() : Fallback;
+    }
+
+    // FromStringTable loads the table asset if needed; the registry tells us whether the key exists
+    const FString KeyString = Key.ToString();
+    FText Text = FText::FromStringTable(TableId, KeyString, EStringTableLoadingPolicy::FindOrLoad);
+
+    const FStringTableConstPtr Table = FStringTableRegistry::Get().FindStringTable(TableId);
+    if (!Table.IsValid() || !Table->FindEntry(KeyString).IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: String table entry '%s' not found in '%s', using literal text"), *KeyString, *TableId.ToString());
+        Resolved.Add(CacheKey, TOptional<FText>());
+        return Fallback;
+    }
+
+    Resolved.Add(CacheKey, Text);
+    return Text;
+}
+
+FText FInputDisplayTextCache::GetDisplayName(const FS_InputProfile &Profile, const FS_InputActionBinding &Binding)
+{
+    return Get().Resolve(Profile.DisplayStringTable, Binding.DisplayNameKey, Binding.DisplayName);
+}
+
+FText FInputDisplayTextCache::GetDescription(const FS_InputProfile &Profile, const FS_InputActionBinding &Binding)
+{
+    return Get().Resolve(Profile.DisplayStringTable, Binding.DescriptionKey, Binding.Description);
+}
+
+FText FInputDisplayTextCache::GetDisplayName(const FS_InputProfile &Profile, const FS_InputAxisBinding &Binding)
+{
+    return Get().Resolve(Profile.DisplayStringTable, Binding.DisplayNameKey, Binding.DisplayName);
+}
+
+FText FInputDisplayTextCache::GetDescription(const FS_InputProfile &Profile, const FS_InputAxisBinding &Binding)
+{
+    return Get().Resolve(Profile.DisplayStringTable, Binding.DescriptionKey, Binding.Description);
+}
+
+void FInputDisplayTextCache::Reset()
+{
+    Resolved.Reset();
+}
+
+void FInputDisplayTextCache::HandleCultureChanged()
+{
+    Reset();
+}
@@ -0,0 +1,57 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Display Text Cache - String-table backed binding display text, resolved lazily and shared by all players
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FS_InputProfile.h"
+
+/**
+ * Resolves binding display text from string-table keys
+ *
+ * Profiles name a string table (FS_InputProfile::DisplayStringTable) and bindings carry only
+ * DisplayNameKey / DescriptionKey, so templates, player profiles and saved JSON hold two FNames
+ * instead of FText copies. Each table/key pair is resolved once, the first time it is asked for,
+ * and the result is shared by every player. The cache is dropped when the culture changes.
+ *
+ * A binding without a key, or a key missing from the table, falls back to the literal FText.
+ */
+class P_MEIS_API FInputDisplayTextCache
+{
+public:
+    static FInputDisplayTextCache &Get();
+
+    ~FInputDisplayTextCache();
+
+    /**
+     * Text for Key in TableId, or Fallback if either is None or the entry does not exist
+     * @param TableId String table id (asset path or registered id)
+     * @param Key Entry key in the table
+     * @param Fallback Literal text stored on the binding
+     */
+    FText Resolve(FName TableId, FName Key, const FText &Fallback);
+
+    /** Display name / description of a binding in a profile */
+    static FText GetDisplayName(const FS_InputProfile &Profile, const FS_InputActionBinding &Binding);
+    static FText GetDescription(const FS_InputProfile &Profile, const FS_InputActionBinding &Binding);
+    static FText GetDisplayName(const FS_InputProfile &Profile, const FS_InputAxisBinding &Binding);
+    static FText GetDescription(const FS_InputProfile &Profile, const FS_InputAxisBinding &Binding);
+
+    /** Drop every resolved entry (string tables reloaded, etc.) */
+    void Reset();
+
+    /** Number of table/key pairs resolved for the current culture (including misses) */
+    int32 Num() const { return Resolved.Num(); }
+
+private:
+    FInputDisplayTextCache();
+
+    void HandleCultureChanged();
+
+    /** Resolved text per table/key; unset optional marks a key missing from its table */
+    TMap<TPair<FName, FName>, TOptional<FText>> Resolved;
+    FDelegateHandle CultureChangedHandle;
+};
@@ -43,6 +43,35 @@ UAsyncAction_WaitForInputAction *UAsyncAction_WaitForInputAction::WaitForInputAc
     return Action;
 }
 
+UAsyncAction_WaitForInputAction *UAsyncAction_WaitForInputAction::WaitForInputActionFiltered(
+    UObject *WorldContextObject,
+    APlayerController *PlayerController,
+    FName ActionName,
+    const FS_InputActionWaitFilter &Filter,
+    bool bOnlyTriggerOnce)
+{
+    UAsyncAction_WaitForInputAction *Action = WaitForInputAction(WorldContextObject, PlayerController, ActionName, bOnlyTriggerOnce);
+    if (Action)
+    {
+        Action->SetFilter(Filter);
+    }
+    return Action;
+}
+
+void UAsyncAction_WaitForInputAction::SetFilter(const FS_InputActionWaitFilter &InFilter)
+{
+    Filter = InFilter;
+    FilterDirection = Filter.Direction.GetSafeNormal();
+    CosConeHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(Filter.ConeHalfAngle, 0.0f, 180.0f)));
+    MinMagnitudeSquared = FMath::Square(Filter.MinMagnitude);
+    MaxMagnitudeSquared = FMath::Square(Filter.MaxMagnitude);
+
+    if (Filter.bUseDirectionCone && FilterDirection.IsZero())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS Async: Direction cone filter for '%s' has a zero direction and will never pass"), *ActionName.ToString());
+    }
+}
+
 void UAsyncAction_WaitForInputAction::Activate()
 {
     if (bIsActive)
@@ -127,6 +156,64 @@ void UAsyncAction_WaitForInputAction::UnregisterFromIntegration()
     IntegrationPtr.Reset();
 }
 
+bool UAsyncAction_WaitForInputAction::PassesFilter(ETriggerEvent TriggerEvent, const FInputActionValue &Value, double TimeSeconds)
+{
+    // Track the press window first - it must see every event, including ones filtered out below
+    double HeldTime = 0.0;
+    if (TriggerEvent == ETriggerEvent::Started || (PressStartTime < 0.0 && TriggerEvent != ETriggerEvent::Completed && TriggerEvent != ETriggerEvent::Canceled))
+    {
+        PressStartTime = TimeSeconds;
+    }
+    if (PressStartTime >= 0.0)
+    {
+        HeldTime = TimeSeconds - PressStartTime;
+    }
+    if (TriggerEvent == ETriggerEvent::Completed || TriggerEvent == ETriggerEvent::Canceled)
+    {
+        PressStartTime = -1.0;
+    }
+
+    if (Filter.bMatchTriggerEvent && TriggerEvent != Filter.TriggerEvent)
+    {
+        return false;
+    }
+
+    if (Filter.MinHoldTime > 0.0f && HeldTime < Filter.MinHoldTime)
+    {
+        return false;
+    }
+
+    if (Filter.bUseValueThreshold)
+    {
+        const float X = Value.Get<FVector>().X;
+        if (Filter.ValueThreshold >= 0.0f ? X < Filter.ValueThreshold : X > Filter.ValueThreshold)
+        {
+            return false;
+        }
+    }
+
+    if (Filter.bUseMagnitudeRange)
+    {
+        const float MagnitudeSquared = Value.GetMagnitudeSq();
+        if (MagnitudeSquared < MinMagnitudeSquared || MagnitudeSquared > MaxMagnitudeSquared)
+        {
+            return false;
+        }
+    }
+
+    if (Filter.bUseDirectionCone)
+    {
+        const FVector2D Axis = Value.Get<FVector2D>();
+        const float AxisSize = Axis.Size();
+        if (AxisSize <= KINDA_SMALL_NUMBER || FVector2D::DotProduct(Axis, FilterDirection) < CosConeHalfAngle * AxisSize)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void UAsyncAction_WaitForInputAction::HandleInputEvent(FName InActionName, ETriggerEvent TriggerEvent, const FInputActionValue &Value)
 {
     // Filter by action name
@@ -147,12 +234,6 @@ void UAsyncAction_WaitForInputAction::HandleInputEvent(FName InActionName, ETrig
     case ETriggerEvent::Triggered:
         OnTriggered.Broadcast(Value);
         bHasTriggered = true;
-
-        // If only trigger once and this was the main Triggered event, cancel
-        if (bOnlyTriggerOnce)
-        {
-            Cancel();
-        }
         break;
 
     case ETriggerEvent::Started:
@@ -174,4 +255,11 @@ void UAsyncAction_WaitForInputAction::HandleInputEvent(FName InActionName, ETrig
     default:
         break;
     }
+
+    // If only trigger once, cancel after the main Triggered event (or the event the filter waits for)
+    if (bOnlyTriggerOnce && bIsActive && (TriggerEvent == ETriggerEvent::Triggered || Filter.bMatchTriggerEvent))
+    {
+        bHasTriggered = true;
+        Cancel();
+    }
 }
@@ -24,6 +24,61 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInputActionEventPin, FInputAction
 // Delegate for when the async action is stopped
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAsyncActionStopped);
 
+/**
+ * Native conditions for a Wait For Input Action node
+ *
+ * Evaluated in C++ before any output pin fires, so Blueprint only runs when the
+ * condition is met instead of on every frame of axis motion. Disabled checks are skipped.
+ *
+ * Examples:
+ * - Stick pushed past 0.8 up: bUseDirectionCone, Direction (0,1), bUseMagnitudeRange, MinMagnitude 0.8
+ * - Trigger fully pressed: bUseValueThreshold, ValueThreshold 0.95
+ * - Held for one second: MinHoldTime 1.0, TriggerEvent Triggered
+ */
+USTRUCT(BlueprintType)
+struct P_MEIS_API FS_InputActionWaitFilter
+{
+    GENERATED_BODY()
+
+    /** Only fire for one specific trigger event */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter")
+    bool bMatchTriggerEvent = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter", meta = (EditCondition = "bMatchTriggerEvent"))
+    ETriggerEvent TriggerEvent = ETriggerEvent::Triggered;
+
+    /** Require the X component to reach ValueThreshold (or fall below it when negative) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter")
+    bool bUseValueThreshold = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter", meta = (EditCondition = "bUseValueThreshold"))
+    float ValueThreshold = 0.5f;
+
+    /** Require a 2D value to point within ConeHalfAngle degrees of Direction */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter")
+    bool bUseDirectionCone = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter", meta = (EditCondition = "bUseDirectionCone"))
+    FVector2D Direction = FVector2D(0.0f, 1.0f);
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter", meta = (EditCondition = "bUseDirectionCone", ClampMin = "0.0", ClampMax = "180.0"))
+    float ConeHalfAngle = 30.0f;
+
+    /** Require the value magnitude to be within [MinMagnitude, MaxMagnitude] */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter")
+    bool bUseMagnitudeRange = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter", meta = (EditCondition = "bUseMagnitudeRange", ClampMin = "0.0"))
+    float MinMagnitude = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter", meta = (EditCondition = "bUseMagnitudeRange", ClampMin = "0.0"))
+    float MaxMagnitude = 1.0f;
+
+    /** Seconds the action must have been held (since Started) before events pass; 0 = off */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter", meta = (ClampMin = "0.0"))
+    float MinHoldTime = 0.0f;
+};
+
 /**
  * Async Blueprint action that waits for a specific Input Action to fire
  *
@@ -62,6 +117,27 @@ public:
         FName ActionName,
         bool bOnlyTriggerOnce = false);
 
+    /**
+     * Wait for a specific Input Action, firing only when the filter conditions are met
+     *
+     * @param WorldContextObject World context for the async action
+     * @param PlayerController The player controller to listen for input from
+     * @param ActionName Name of the action to listen for (e.g., "IA_Jump")
+     * @param Filter Conditions evaluated natively before any pin fires
+     * @param bOnlyTriggerOnce If true, stop after the first matching event
+     * @return The async action instance
+     */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Async",
+              meta = (BlueprintInternalUseOnly = "true",
+                      WorldContext = "WorldContextObject",
+                      DisplayName = "Wait For Input Action (Filtered)"))
+    static UAsyncAction_WaitForInputAction *WaitForInputActionFiltered(
+        UObject *WorldContextObject,
+        APlayerController *PlayerController,
+        FName ActionName,
+        const FS_InputActionWaitFilter &Filter,
+        bool bOnlyTriggerOnce = false);
+
     // ==================== Output Execution Pins ====================
 
     /** Fires when the action is TRIGGERED (main event - fires repeatedly while held for axis) */
@@ -113,6 +189,16 @@ public:
     /** Called by UCPP_EnhancedInputIntegration when an action event fires */
     void HandleInputEvent(FName InActionName, ETriggerEvent TriggerEvent, const FInputActionValue &Value);
 
+    /**
+     * Evaluate the filter for an event (also tracks press start for MinHoldTime)
+     * Called for every event of the action, whether or not it passes
+     * @param TriggerEvent The event that fired
+     * @param Value The action value
+     * @param TimeSeconds Current world time
+     * @return True if the event should reach the output pins
+     */
+    bool PassesFilter(ETriggerEvent TriggerEvent, const FInputActionValue &Value, double TimeSeconds);
+
 protected:
     /** Clean up when the action is destroyed */
     virtual void BeginDestroy() override;
@@ -143,4 +229,19 @@ private:
 
     /** Whether we've triggered at least once (for bOnlyTriggerOnce) */
     bool bHasTriggered;
+
+    /** Native conditions (all disabled for the unfiltered node) */
+    FS_InputActionWaitFilter Filter;
+
+    /** Precomputed from Filter so per-event checks avoid trig and square roots */
+    FVector2D FilterDirection = FVector2D::ZeroVector;
+    float CosConeHalfAngle = 1.0f;
+    float MinMagnitudeSquared = 0.0f;
+    float MaxMagnitudeSquared = 0.0f;
+
+    /** World time the current press started, or negative when released */
+    double PressStartTime = -1.0;
+
+    /** Cache derived filter values */
+    void SetFilter(const FS_InputActionWaitFilter &InFilter);
 };
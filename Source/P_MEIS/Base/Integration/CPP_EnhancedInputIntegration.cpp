@@ -5,8 +5,18 @@
  */
 
 #include "Integration/CPP_EnhancedInputIntegration.h"
+#include "Integration/CPP_InputActionAssetRegistry.h"
+#include "Integration/CPP_AsyncAction_WaitForInputAction.h"
+#include "Integration/InputMappingRebuildBatcher.h"
+#include "Integration/InputLateLatch.h"
+#include "Integration/InputStickCalibration.h"
+#include "Integration/CPP_InputModifierStickCalibration.h"
+#include "InputBinding/InputDisplayTextCache.h"
+#include "Manager/CPP_InputAnalytics.h"
+#include "P_MEIS_Memory.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
+#include "EnhancedPlayerInput.h"
 #include "InputActionValue.h"
 #include "InputMappingContext.h"
 #include "InputAction.h"
@@ -15,11 +25,20 @@
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Controller.h"
 #include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "Algo/BinarySearch.h"
+#include "Misc/MemStack.h"
 
 // ==================== Profile Application ====================
 
 bool UCPP_EnhancedInputIntegration::ApplyProfile(const FS_InputProfile &Profile)
 {
+    return ApplyProfileWithHash(Profile, ComputeProfileHash(Profile));
+}
+
+bool UCPP_EnhancedInputIntegration::ApplyProfileWithHash(const FS_InputProfile &Profile, uint32 ProfileHash)
+{
+    LLM_SCOPE_BYTAG(PMEIS_UObjects);
     if (!EnsureMappingContext())
     {
         UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to create mapping context"));
@@ -29,6 +48,19 @@ bool UCPP_EnhancedInputIntegration::ApplyProfile(const FS_InputProfile &Profile)
     // Clear existing mappings
     MappingContext->UnmapAll();
     CreatedInputActions.Empty();
+    AuthoredActions.Empty();
+    ResetFlyweightCache();
+    StickCalibrationModifiers.Reset();
+    AppliedProfileHash = 0;
+    DisplayStringTable = Profile.DisplayStringTable;
+
+    // Group membership comes from the new profile; which groups are disabled is kept
+    SuppressedMappings.Reset();
+    for (TPair<FName, FInputActionDispatchState> &Pair : ActionDispatchStates)
+    {
+        Pair.Value.GroupMask = 0;
+    }
+    PendingGroupMasks.Reset();
 
     // Apply all action bindings
     for (const FS_InputActionBinding &ActionBinding : Profile.ActionBindings)
@@ -36,7 +68,9 @@ bool UCPP_EnhancedInputIntegration::ApplyProfile(const FS_InputProfile &Profile)
         if (!ApplyActionBinding(ActionBinding))
         {
             UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to apply action binding: %s"), *ActionBinding.InputActionName.ToString());
+            continue;
         }
+        AssignActionGroups(ActionBinding.InputActionName, ActionBinding.Category, ActionBinding.ActionGroups);
     }
 
     // Apply all axis bindings
@@ -48,8 +82,21 @@ bool UCPP_EnhancedInputIntegration::ApplyProfile(const FS_InputProfile &Profile)
         if (!ApplyAxisBinding(AxisBinding))
         {
             UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to apply axis binding: %s"), *AxisBinding.InputAxisName.ToString());
+            continue;
         }
+        AssignActionGroups(AxisBinding.InputAxisName, AxisBinding.Category, AxisBinding.ActionGroups);
+    }
+
+    if (SuppressedGroupMask != 0)
+    {
+        SuppressGroupMappings(SuppressedGroupMask);
     }
+    RefreshStickCalibrationModifiers();
+
+    UE_LOG(LogTemp, Log, TEXT("P_MEIS: Profile modifiers/triggers - %d requested, %d created, %d instances saved by sharing"),
+           FlyweightStats.ModifierRequests + FlyweightStats.TriggerRequests,
+           FlyweightStats.ModifierInstances + FlyweightStats.TriggerInstances,
+           FlyweightStats.GetInstancesSaved());
 
     // Apply mapping context to local player's Enhanced Input subsystem (players only)
     // For AI / non-local controllers there is no LocalPlayer subsystem, so we skip this.
@@ -67,9 +114,102 @@ bool UCPP_EnhancedInputIntegration::ApplyProfile(const FS_InputProfile &Profile)
     // This hooks up the OnActionTriggered, OnActionStarted, etc. delegates
     BindAllActionEvents();
 
+    AppliedProfileHash = ProfileHash;
+    AppliedActionBindings = Profile.ActionBindings;
+    AppliedAxisBindings = Profile.AxisBindings;
     return true;
 }
 
+namespace
+{
+    uint32 HashBindingText(uint32 Hash, FName Key, const FText &Text)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Key));
+        return HashCombine(Hash, GetTypeHash(Text.ToString()));
+    }
+
+    uint32 HashBindingGroups(uint32 Hash, FName Category, const TArray<FName> &Groups)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Category));
+        for (const FName &Group : Groups)
+        {
+            Hash = HashCombine(Hash, GetTypeHash(Group));
+        }
+        return Hash;
+    }
+
+    /** Property-wise comparison through reflection, so new binding fields are covered without touching this */
+    template <typename BindingType>
+    bool AreBindingsIdentical(const TArray<BindingType> &A, const TArray<BindingType> &B)
+    {
+        if (A.Num() != B.Num())
+        {
+            return false;
+        }
+
+        const UScriptStruct *Struct = BindingType::StaticStruct();
+        for (int32 Index = 0; Index < A.Num(); ++Index)
+        {
+            if (!Struct->CompareScriptStruct(&A[Index], &B[Index], PPF_None))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+uint32 UCPP_EnhancedInputIntegration::ComputeProfileHash(const FS_InputProfile &Profile)
+{
+    // Only the bindings shape the mapping context
+    uint32 Hash = GetTypeHash(Profile.DisplayStringTable);
+
+    for (const FS_InputActionBinding &Binding : Profile.ActionBindings)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Binding.InputActionName));
+        Hash = HashCombine(Hash, GetTypeHash((Binding.bEnabled ? 1u : 0u)));
+        Hash = HashCombine(Hash, GetTypeHash(Binding.Priority));
+        Hash = HashBindingGroups(Hash, Binding.Category, Binding.ActionGroups);
+        Hash = HashBindingText(Hash, Binding.DisplayNameKey, Binding.DisplayName);
+        Hash = HashBindingText(Hash, Binding.DescriptionKey, Binding.Description);
+        for (const FS_KeyBinding &KeyBinding : Binding.KeyBindings)
+        {
+            Hash = HashCombine(Hash, GetTypeHash(KeyBinding.Key));
+            Hash = HashCombine(Hash, GetTypeHash(KeyBinding.Value));
+            Hash = HashCombine(Hash, GetTypeHash((KeyBinding.bShift ? 1u : 0u) | (KeyBinding.bCtrl ? 2u : 0u) | (KeyBinding.bAlt ? 4u : 0u) | (KeyBinding.bCmd ? 8u : 0u)));
+        }
+    }
+
+    for (const FS_InputAxisBinding &Binding : Profile.AxisBindings)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Binding.InputAxisName));
+        Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Binding.ValueType)));
+        Hash = HashCombine(Hash, GetTypeHash((Binding.bEnabled ? 1u : 0u) | (Binding.bInvert ? 2u : 0u)));
+        Hash = HashCombine(Hash, GetTypeHash(Binding.DeadZone));
+        Hash = HashCombine(Hash, GetTypeHash(Binding.Sensitivity));
+        Hash = HashCombine(Hash, GetTypeHash(Binding.Priority));
+        Hash = HashBindingGroups(Hash, Binding.Category, Binding.ActionGroups);
+        Hash = HashBindingText(Hash, Binding.DisplayNameKey, Binding.DisplayName);
+        Hash = HashBindingText(Hash, Binding.DescriptionKey, Binding.Description);
+        for (const FS_AxisKeyBinding &KeyBinding : Binding.AxisBindings)
+        {
+            Hash = HashCombine(Hash, GetTypeHash(KeyBinding.Key));
+            Hash = HashCombine(Hash, GetTypeHash(KeyBinding.Scale));
+            Hash = HashCombine(Hash, GetTypeHash(KeyBinding.bSwizzleYXZ));
+        }
+    }
+
+    // 0 means "nothing applied"
+    return Hash != 0 ? Hash : 1;
+}
+
+bool UCPP_EnhancedInputIntegration::IsProfileApplied(const FS_InputProfile &Profile, uint32 ProfileHash) const
+{
+    // The hash only rules profiles out; equal hashes are confirmed against the bindings that were applied
+    return AppliedProfileHash != 0 && AppliedProfileHash == ProfileHash && DisplayStringTable == Profile.DisplayStringTable &&
+           AreBindingsIdentical(AppliedActionBindings, Profile.ActionBindings) && AreBindingsIdentical(AppliedAxisBindings, Profile.AxisBindings);
+}
+
 bool UCPP_EnhancedInputIntegration::ApplyActionBinding(const FS_InputActionBinding &ActionBinding)
 {
     if (!ActionBinding.bEnabled)
@@ -82,6 +222,8 @@ bool UCPP_EnhancedInputIntegration::ApplyActionBinding(const FS_InputActionBindi
         return false;
     }
 
+    AppliedProfileHash = 0;
+
     // Create or get the Input Action
     UInputAction *Action = CreateInputAction(ActionBinding.InputActionName, EInputActionValueType::Boolean);
     if (!Action)
@@ -90,8 +232,11 @@ bool UCPP_EnhancedInputIntegration::ApplyActionBinding(const FS_InputActionBindi
         return false;
     }
 
-    // Set action description
-    Action->ActionDescription = ActionBinding.DisplayName;
+    // Set action description (authored assets are shared and keep their own)
+    if (!IsAuthoredAction(ActionBinding.InputActionName))
+    {
+        Action->ActionDescription = FInputDisplayTextCache::Get().Resolve(DisplayStringTable, ActionBinding.DisplayNameKey, ActionBinding.DisplayName);
+    }
 
     // Map all keys to this action
     for (const FS_KeyBinding &KeyBinding : ActionBinding.KeyBindings)
@@ -121,6 +266,8 @@ bool UCPP_EnhancedInputIntegration::ApplyAxisBinding(const FS_InputAxisBinding &
         return false;
     }
 
+    AppliedProfileHash = 0;
+
     // Use the value type specified in the binding (defaults to Axis1D for backward compatibility)
     EInputActionValueType ValueType = AxisBinding.ValueType;
 
@@ -135,11 +282,21 @@ bool UCPP_EnhancedInputIntegration::ApplyAxisBinding(const FS_InputAxisBinding &
         return false;
     }
 
-    // Set action description
-    Action->ActionDescription = AxisBinding.DisplayName;
+    // Authored assets are shared by every player, so binding-wide modifiers go on each mapping instead
+    const bool bAuthored = IsAuthoredAction(AxisBinding.InputAxisName);
+    TArray<UInputModifier *, TInlineAllocator<4>> BindingModifiers;
+    if (bAuthored)
+    {
+        GatherAxisModifiers(AxisBinding, BindingModifiers);
+    }
+    else
+    {
+        // Set action description
+        Action->ActionDescription = FInputDisplayTextCache::Get().Resolve(DisplayStringTable, AxisBinding.DisplayNameKey, AxisBinding.DisplayName);
 
-    // Apply axis modifiers to the action
-    ApplyAxisModifiers(Action, AxisBinding);
+        // Apply axis modifiers to the action
+        ApplyAxisModifiers(Action, AxisBinding);
+    }
 
     // Map all keys/axes to this action
     for (const FS_AxisKeyBinding &KeyBinding : AxisBinding.AxisBindings)
@@ -148,37 +305,42 @@ bool UCPP_EnhancedInputIntegration::ApplyAxisBinding(const FS_InputAxisBinding &
         {
             FEnhancedActionKeyMapping &Mapping = MappingContext->MapKey(Action, KeyBinding.Key);
 
+            // Calibration needs the raw stick reading, so it runs before every other mapping modifier
+            if (UCPP_InputModifierStickCalibration *StickCalibration = GetStickCalibrationModifier(KeyBinding.Key, AxisBinding.DeadZone))
+            {
+                Mapping.Modifiers.Add(StickCalibration);
+            }
+
+            // Modifiers below are shared flyweights - WASD-style bindings reuse the same few instances
+
             // Apply swizzle modifier first (YXZ swaps X and Y, so X input goes to Y output)
             if (KeyBinding.bSwizzleYXZ)
             {
-                UInputModifierSwizzleAxis *SwizzleModifier = NewObject<UInputModifierSwizzleAxis>(Action);
-                SwizzleModifier->Order = EInputAxisSwizzle::YXZ;
-                Mapping.Modifiers.Add(SwizzleModifier);
+                Mapping.Modifiers.Add(GetOrCreateModifier(FS_InputModifierConfig::MakeSwizzle(EP_MEIS_SwizzleOrder::YXZ)));
             }
 
             // Apply negate if scale is negative
             if (KeyBinding.Scale < 0.0f)
             {
-                UInputModifierNegate *NegateModifier = NewObject<UInputModifierNegate>(Action);
-                Mapping.Modifiers.Add(NegateModifier);
+                Mapping.Modifiers.Add(GetOrCreateModifier(FS_InputModifierConfig::MakeNegate(true, true, true)));
             }
 
             // Apply scale modifier if not 1.0 (use absolute value since negate handles sign)
             float AbsScale = FMath::Abs(KeyBinding.Scale);
             if (!FMath::IsNearlyEqual(AbsScale, 1.0f))
             {
-                UInputModifierScalar *ScaleModifier = NewObject<UInputModifierScalar>(Action);
-                ScaleModifier->Scalar = FVector(AbsScale, AbsScale, AbsScale);
-                Mapping.Modifiers.Add(ScaleModifier);
+                Mapping.Modifiers.Add(GetOrCreateModifier(FS_InputModifierConfig::MakeUniformScale(AbsScale)));
             }
 
             // Apply invert if set on the axis binding
             if (AxisBinding.bInvert)
             {
-                UInputModifierNegate *NegateModifier = NewObject<UInputModifierNegate>(Action);
-                Mapping.Modifiers.Add(NegateModifier);
+                Mapping.Modifiers.Add(GetOrCreateModifier(FS_InputModifierConfig::MakeNegate(true, true, true)));
             }
 
+            // Action-level modifiers run after mapping modifiers, so appending keeps the same order
+            Mapping.Modifiers.Append(BindingModifiers);
+
             UE_LOG(LogTemp, Log, TEXT("P_MEIS: Mapped axis key '%s' (scale: %.2f, swizzle: %d) to action '%s'"),
                    *KeyBinding.Key.ToString(), KeyBinding.Scale, KeyBinding.bSwizzleYXZ, *AxisBinding.InputAxisName.ToString());
         }
@@ -201,6 +363,49 @@ void UCPP_EnhancedInputIntegration::SetPlayerController(APlayerController *InPla
     }
 }
 
+void UCPP_EnhancedInputIntegration::DetachController()
+{
+    if (IsValid(PlayerController) && MappingContext)
+    {
+        if (ULocalPlayer *LocalPlayer = PlayerController->GetLocalPlayer())
+        {
+            if (UEnhancedInputLocalPlayerSubsystem *Subsystem = LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>())
+            {
+                FInputMappingRebuildBatcher::Get().RemoveMappingContext(Subsystem, MappingContext);
+            }
+        }
+    }
+
+    if (UEnhancedInputComponent *EnhancedInputComponent = BoundEnhancedInputComponent.Get())
+    {
+        EnhancedInputComponent->ClearBindingsForObject(this);
+    }
+    BoundEnhancedInputComponent.Reset();
+    BoundActions.Reset();
+    PendingBindActions.Reset();
+
+    // Presses in flight belonged to the old controller
+    for (TPair<FName, FInputActionDispatchState> &Pair : ActionDispatchStates)
+    {
+        Pair.Value.bHeld = false;
+        Pair.Value.LastValue = FInputActionValue();
+    }
+
+    PlayerController = nullptr;
+    OwningController = nullptr;
+}
+
+void UCPP_EnhancedInputIntegration::ReattachPlayerController(APlayerController *InPlayerController)
+{
+    // Re-adds the existing mapping context; actions and modifiers are reused as built
+    SetPlayerController(InPlayerController);
+
+    if (CreatedInputActions.Num() > 0)
+    {
+        BindAllActionEvents();
+    }
+}
+
 void UCPP_EnhancedInputIntegration::SetController(AController *InController)
 {
     OwningController = InController;
@@ -222,6 +427,28 @@ UInputAction *UCPP_EnhancedInputIntegration::CreateInputAction(const FName &Acti
         return *ExistingAction;
     }
 
+    // Prefer an authored asset with a matching name - shared by all players and left untouched
+    if (ActionAssetRegistry)
+    {
+        if (UInputAction *AuthoredAction = ActionAssetRegistry->FindActionAsset(ActionName))
+        {
+            if (AuthoredAction->ValueType != ValueType)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Authored Input Action '%s' has ValueType %d, binding requested %d - using the asset's type"),
+                       *ActionName.ToString(), static_cast<int32>(AuthoredAction->ValueType), static_cast<int32>(ValueType));
+            }
+
+            CreatedInputActions.Add(ActionName, AuthoredAction);
+            AuthoredActions.Add(ActionName);
+
+            // A transient action with this name may have been bound before the asset resolved
+            BoundActions.Remove(ActionName);
+
+            UE_LOG(LogTemp, Log, TEXT("P_MEIS: Using authored Input Action asset %s for '%s'"), *AuthoredAction->GetPathName(), *ActionName.ToString());
+            return AuthoredAction;
+        }
+    }
+
     // Create new Input Action
     UInputAction *NewAction = NewObject<UInputAction>(this, UInputAction::StaticClass(), ActionName);
     if (!NewAction)
@@ -263,6 +490,11 @@ void UCPP_EnhancedInputIntegration::GetAllInputActions(TArray<UInputAction *> &O
     CreatedInputActions.GenerateValueArray(OutActions);
 }
 
+void UCPP_EnhancedInputIntegration::GetAllInputActionNames(TArray<FName> &OutNames) const
+{
+    CreatedInputActions.GenerateKeyArray(OutNames);
+}
+
 // ==================== Key Mapping ====================
 
 bool UCPP_EnhancedInputIntegration::MapKeyToAction(const FName &ActionName, const FKey &Key)
@@ -290,8 +522,9 @@ bool UCPP_EnhancedInputIntegration::MapKeyToAction(const FName &ActionName, cons
         return false;
     }
 
-    // Map the key
+    // Map the key; the mappings no longer match the applied profile
     MappingContext->MapKey(Action, Key);
+    AppliedProfileHash = 0;
 
     // Refresh mapping context if we have a player
     if (PlayerController)
@@ -328,8 +561,9 @@ bool UCPP_EnhancedInputIntegration::MapKeyBindingToAction(const FName &ActionNam
         return false;
     }
 
-    // Map the key
+    // Map the key; the mappings no longer match the applied profile
     FEnhancedActionKeyMapping &Mapping = MappingContext->MapKey(Action, KeyBinding.Key);
+    AppliedProfileHash = 0;
 
     // Add modifier key triggers if any modifiers are specified
     // For modifier keys, we use chord triggers
@@ -339,7 +573,6 @@ bool UCPP_EnhancedInputIntegration::MapKeyBindingToAction(const FName &ActionNam
         if (KeyBinding.bShift)
         {
             // Add a chord trigger that requires Shift to be held
-            UInputTriggerChordAction *ChordTrigger = NewObject<UInputTriggerChordAction>(this);
             // Create a shift action if needed
             UInputAction *ShiftAction = GetInputAction(FName("ModifierShift"));
             if (!ShiftAction)
@@ -349,13 +582,12 @@ bool UCPP_EnhancedInputIntegration::MapKeyBindingToAction(const FName &ActionNam
                 MappingContext->MapKey(ShiftAction, EKeys::LeftShift);
                 MappingContext->MapKey(ShiftAction, EKeys::RightShift);
             }
-            ChordTrigger->ChordAction = ShiftAction;
-            Mapping.Triggers.Add(ChordTrigger);
+            // Shared chord trigger - every Shift+<Key> mapping uses the same instance
+            Mapping.Triggers.Add(GetOrCreateTrigger(FS_InputTriggerConfig::MakeChord(FName("ModifierShift"))));
         }
 
         if (KeyBinding.bCtrl)
         {
-            UInputTriggerChordAction *ChordTrigger = NewObject<UInputTriggerChordAction>(this);
             UInputAction *CtrlAction = GetInputAction(FName("ModifierCtrl"));
             if (!CtrlAction)
             {
@@ -363,13 +595,11 @@ bool UCPP_EnhancedInputIntegration::MapKeyBindingToAction(const FName &ActionNam
                 MappingContext->MapKey(CtrlAction, EKeys::LeftControl);
                 MappingContext->MapKey(CtrlAction, EKeys::RightControl);
             }
-            ChordTrigger->ChordAction = CtrlAction;
-            Mapping.Triggers.Add(ChordTrigger);
+            Mapping.Triggers.Add(GetOrCreateTrigger(FS_InputTriggerConfig::MakeChord(FName("ModifierCtrl"))));
         }
 
         if (KeyBinding.bAlt)
         {
-            UInputTriggerChordAction *ChordTrigger = NewObject<UInputTriggerChordAction>(this);
             UInputAction *AltAction = GetInputAction(FName("ModifierAlt"));
             if (!AltAction)
             {
@@ -377,13 +607,11 @@ bool UCPP_EnhancedInputIntegration::MapKeyBindingToAction(const FName &ActionNam
                 MappingContext->MapKey(AltAction, EKeys::LeftAlt);
                 MappingContext->MapKey(AltAction, EKeys::RightAlt);
             }
-            ChordTrigger->ChordAction = AltAction;
-            Mapping.Triggers.Add(ChordTrigger);
+            Mapping.Triggers.Add(GetOrCreateTrigger(FS_InputTriggerConfig::MakeChord(FName("ModifierAlt"))));
         }
 
         if (KeyBinding.bCmd)
         {
-            UInputTriggerChordAction *ChordTrigger = NewObject<UInputTriggerChordAction>(this);
             UInputAction *CmdAction = GetInputAction(FName("ModifierCmd"));
             if (!CmdAction)
             {
@@ -391,8 +619,7 @@ bool UCPP_EnhancedInputIntegration::MapKeyBindingToAction(const FName &ActionNam
                 MappingContext->MapKey(CmdAction, EKeys::LeftCommand);
                 MappingContext->MapKey(CmdAction, EKeys::RightCommand);
             }
-            ChordTrigger->ChordAction = CmdAction;
-            Mapping.Triggers.Add(ChordTrigger);
+            Mapping.Triggers.Add(GetOrCreateTrigger(FS_InputTriggerConfig::MakeChord(FName("ModifierCmd"))));
         }
 
         UE_LOG(LogTemp, Log, TEXT("P_MEIS: Mapped key '%s' with modifiers (Shift:%d Ctrl:%d Alt:%d Cmd:%d) to action '%s'"),
@@ -446,6 +673,7 @@ bool UCPP_EnhancedInputIntegration::UnmapKeyFromAction(const FName &ActionName,
     }
 
     MappingContext->UnmapKey(Action, Key);
+    AppliedProfileHash = 0;
 
     // Refresh mapping context
     if (PlayerController)
@@ -471,6 +699,7 @@ bool UCPP_EnhancedInputIntegration::UnmapAllKeysFromAction(const FName &ActionNa
     }
 
     MappingContext->UnmapAllKeysFromAction(Action);
+    AppliedProfileHash = 0;
 
     // Refresh mapping context
     if (PlayerController)
@@ -490,6 +719,9 @@ void UCPP_EnhancedInputIntegration::ClearAllMappings()
     }
 
     CreatedInputActions.Empty();
+    AuthoredActions.Empty();
+    ResetFlyweightCache();
+    AppliedProfileHash = 0;
 
     if (PlayerController)
     {
@@ -706,9 +938,8 @@ bool UCPP_EnhancedInputIntegration::ApplyMappingContextToPlayer()
         return false;
     }
 
-    // Remove existing P_MEIS context if present, then re-add
-    Subsystem->RemoveMappingContext(MappingContext);
-    Subsystem->AddMappingContext(MappingContext, 0);
+    // Add (or keep) the P_MEIS context; the control-mapping rebuild is coalesced per player per frame
+    FInputMappingRebuildBatcher::Get().AddMappingContext(Subsystem, MappingContext, 0);
 
     UE_LOG(LogTemp, Log, TEXT("P_MEIS: Applied mapping context to player"));
     return true;
@@ -724,29 +955,188 @@ void UCPP_EnhancedInputIntegration::ApplyAxisModifiers(UInputAction *Action, con
     // Clear existing modifiers
     Action->Modifiers.Empty();
 
-    // Add dead zone modifier
-    if (AxisBinding.DeadZone > 0.0f)
+    TArray<UInputModifier *, TInlineAllocator<4>> Modifiers;
+    GatherAxisModifiers(AxisBinding, Modifiers);
+    Action->Modifiers.Append(Modifiers);
+}
+
+void UCPP_EnhancedInputIntegration::GatherAxisModifiers(const FS_InputAxisBinding &AxisBinding, TArray<UInputModifier *, TInlineAllocator<4>> &OutModifiers)
+{
+    // Add dead zone modifier (shared by every axis with the same threshold); calibrated sticks bring their own
+    if (AxisBinding.DeadZone > 0.0f && !IsStickCalibrated(AxisBinding))
     {
-        UInputModifierDeadZone *DeadZoneModifier = NewObject<UInputModifierDeadZone>(Action);
-        DeadZoneModifier->LowerThreshold = AxisBinding.DeadZone;
-        DeadZoneModifier->UpperThreshold = 1.0f;
-        DeadZoneModifier->Type = EDeadZoneType::Radial;
-        Action->Modifiers.Add(DeadZoneModifier);
+        OutModifiers.Add(GetOrCreateModifier(FS_InputModifierConfig::MakeDeadZone(AxisBinding.DeadZone, 1.0f, EP_MEIS_DeadZoneType::Radial)));
     }
 
     // Add sensitivity/scale modifier
     if (!FMath::IsNearlyEqual(AxisBinding.Sensitivity, 1.0f))
     {
-        UInputModifierScalar *ScaleModifier = NewObject<UInputModifierScalar>(Action);
-        ScaleModifier->Scalar = FVector(AxisBinding.Sensitivity, AxisBinding.Sensitivity, AxisBinding.Sensitivity);
-        Action->Modifiers.Add(ScaleModifier);
+        OutModifiers.Add(GetOrCreateModifier(FS_InputModifierConfig::MakeUniformScale(AxisBinding.Sensitivity)));
     }
 
     // Add negate modifier if inverted
     if (AxisBinding.bInvert)
     {
-        UInputModifierNegate *NegateModifier = NewObject<UInputModifierNegate>(Action);
-        Action->Modifiers.Add(NegateModifier);
+        OutModifiers.Add(GetOrCreateModifier(FS_InputModifierConfig::MakeNegate(true, true, true)));
+    }
+}
+
+// ==================== Stick Drift Calibration ====================
+
+namespace
+{
+    /** 2D key of the stick a raw gamepad stick key belongs to (NAME_None for other keys) */
+    FName GetCalibratedStick(const FKey &Key)
+    {
+        if (Key == EKeys::Gamepad_Left2D || Key == EKeys::Gamepad_LeftX || Key == EKeys::Gamepad_LeftY)
+        {
+            return EKeys::Gamepad_Left2D.GetFName();
+        }
+        if (Key == EKeys::Gamepad_Right2D || Key == EKeys::Gamepad_RightX || Key == EKeys::Gamepad_RightY)
+        {
+            return EKeys::Gamepad_Right2D.GetFName();
+        }
+        return NAME_None;
+    }
+}
+
+bool UCPP_EnhancedInputIntegration::SetStickCalibration(bool bEnable, const TArray<FS_DeviceStickCalibration> &Calibrations)
+{
+    StickCalibrations = Calibrations;
+
+    const bool bChanged = bEnable != bStickCalibration;
+    bStickCalibration = bEnable;
+    if (bEnable && PlayerController && PlayerController->IsLocalController())
+    {
+        FInputStickCalibration::Get().Register(this);
+    }
+    else
+    {
+        FInputStickCalibration::Get().Unregister(this);
+    }
+
+    if (bChanged)
+    {
+        // Stick mappings gain or lose their calibration modifier on the next apply
+        AppliedProfileHash = 0;
+    }
+    else
+    {
+        RefreshStickCalibrationModifiers();
+        RequestMappingRebuild();
+    }
+    return bChanged;
+}
+
+bool UCPP_EnhancedInputIntegration::GetStickCalibration(FName Stick, FS_StickCalibration &OutCalibration) const
+{
+    const FS_StickCalibration *Calibration = FS_DeviceStickCalibration::Find(StickCalibrations, CalibrationDevice, Stick);
+    if (!Calibration)
+    {
+        return false;
+    }
+
+    OutCalibration = *Calibration;
+    return true;
+}
+
+void UCPP_EnhancedInputIntegration::SetStickCalibrationDevice(FName HardwareId)
+{
+    if (HardwareId != CalibrationDevice)
+    {
+        CalibrationDevice = HardwareId;
+        RefreshStickCalibrationModifiers();
+        RequestMappingRebuild();
+    }
+}
+
+void UCPP_EnhancedInputIntegration::UpdateStickCalibration(FName HardwareId, const FS_StickCalibration &Calibration)
+{
+    FS_DeviceStickCalibration::Store(StickCalibrations, HardwareId, Calibration);
+
+    if (HardwareId == CalibrationDevice)
+    {
+        bool bUpdated = false;
+        for (UCPP_InputModifierStickCalibration *Modifier : StickCalibrationModifiers)
+        {
+            if (Modifier && GetCalibratedStick(Modifier->StickKey) == Calibration.Stick)
+            {
+                Modifier->SetCalibration(&Calibration);
+                bUpdated = true;
+            }
+        }
+        if (bUpdated)
+        {
+            RequestMappingRebuild();
+        }
+    }
+
+    OnStickCalibrationUpdated.Broadcast(HardwareId, Calibration);
+}
+
+UCPP_InputModifierStickCalibration *UCPP_EnhancedInputIntegration::GetStickCalibrationModifier(const FKey &Key, float DefaultDeadZone)
+{
+    if (!bStickCalibration || GetCalibratedStick(Key).IsNone())
+    {
+        return nullptr;
+    }
+
+    // The fallback dead zone is per binding, so only bindings that agree on it share an instance
+    const float DeadZone = FMath::Clamp(DefaultDeadZone, 0.0f, 0.95f);
+    for (UCPP_InputModifierStickCalibration *Modifier : StickCalibrationModifiers)
+    {
+        if (Modifier && Modifier->StickKey == Key && Modifier->DefaultDeadZone == DeadZone)
+        {
+            return Modifier;
+        }
+    }
+
+    UCPP_InputModifierStickCalibration *Modifier = NewObject<UCPP_InputModifierStickCalibration>(this);
+    Modifier->StickKey = Key;
+    Modifier->bStick2D = Key.IsAxis2D();
+    Modifier->bYAxis = Key == EKeys::Gamepad_LeftY || Key == EKeys::Gamepad_RightY;
+    Modifier->DefaultDeadZone = DeadZone;
+    Modifier->SetCalibration(FS_DeviceStickCalibration::Find(StickCalibrations, CalibrationDevice, GetCalibratedStick(Key)));
+    StickCalibrationModifiers.Add(Modifier);
+    return Modifier;
+}
+
+bool UCPP_EnhancedInputIntegration::IsStickCalibrated(const FS_InputAxisBinding &AxisBinding) const
+{
+    if (!bStickCalibration)
+    {
+        return false;
+    }
+
+    return AxisBinding.AxisBindings.ContainsByPredicate([](const FS_AxisKeyBinding &KeyBinding)
+                                                        { return !GetCalibratedStick(KeyBinding.Key).IsNone(); });
+}
+
+void UCPP_EnhancedInputIntegration::RefreshStickCalibrationModifiers()
+{
+    for (UCPP_InputModifierStickCalibration *Modifier : StickCalibrationModifiers)
+    {
+        if (Modifier)
+        {
+            Modifier->SetCalibration(FS_DeviceStickCalibration::Find(StickCalibrations, CalibrationDevice, GetCalibratedStick(Modifier->StickKey)));
+        }
+    }
+}
+
+void UCPP_EnhancedInputIntegration::RequestMappingRebuild()
+{
+    if (!MappingContext || !PlayerController || !PlayerController->IsLocalController())
+    {
+        return;
+    }
+
+    if (ULocalPlayer *LocalPlayer = PlayerController->GetLocalPlayer())
+    {
+        UEnhancedInputLocalPlayerSubsystem *Subsystem = LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>();
+        if (Subsystem && Subsystem->HasMappingContext(MappingContext))
+        {
+            FInputMappingRebuildBatcher::Get().RequestRebuild(Subsystem);
+        }
     }
 }
 
@@ -836,117 +1226,794 @@ void UCPP_EnhancedInputIntegration::BindAllActionEvents()
 }
 
 // ==================== Async Listener Management (Approach C) ====================
-// TODO: Implement when UAsyncAction_WaitForInputAction class is created (Section 0.8.3 of PLAN.md)
 
 void UCPP_EnhancedInputIntegration::RegisterAsyncListener(UAsyncAction_WaitForInputAction *Listener)
 {
-    // TODO: Implement async listener registration
-    // Requires UAsyncAction_WaitForInputAction implementation
+    if (!Listener)
+    {
+        return;
+    }
+
+    AsyncListeners.AddUnique(Listener);
 }
 
 void UCPP_EnhancedInputIntegration::UnregisterAsyncListener(UAsyncAction_WaitForInputAction *Listener)
 {
-    // TODO: Implement async listener unregistration
-    // Requires UAsyncAction_WaitForInputAction implementation
+    AsyncListeners.RemoveSingleSwap(Listener);
 }
 
 void UCPP_EnhancedInputIntegration::NotifyAsyncListeners(FName ActionName, ETriggerEvent TriggerEvent, const FInputActionValue &Value)
 {
-    // TODO: Implement async listener notification
-    // Requires UAsyncAction_WaitForInputAction implementation
-}
-
-// ==================== Internal Event Handlers ====================
-
-void UCPP_EnhancedInputIntegration::HandleActionEvent(const FInputActionInstance &ActionInstance, FName ActionName)
-{
-    // This is a generic handler - not used directly, but available for future use
-    FInputActionValue Value = ActionInstance.GetValue();
-
-    // Broadcast legacy delegate
-    OnDynamicInputAction.Broadcast(ActionName, Value);
-}
-
-void UCPP_EnhancedInputIntegration::OnActionTriggeredInternal(const FInputActionInstance &ActionInstance, FName ActionName)
-{
-    FInputActionValue Value = ActionInstance.GetValue();
+    if (AsyncListeners.Num() == 0)
+    {
+        return;
+    }
 
-    // Approach A: Broadcast to global dispatcher
-    OnActionTriggered.Broadcast(ActionName, Value);
+    const UWorld *World = OwningController ? OwningController->GetWorld() : nullptr;
+    const double TimeSeconds = World ? World->GetTimeSeconds() : FPlatformTime::Seconds();
 
-    // Legacy support
-    OnDynamicInputAction.Broadcast(ActionName, Value);
+    // Listeners may cancel (and unregister) while being notified, so walk a snapshot
+    TArray<TWeakObjectPtr<UAsyncAction_WaitForInputAction>, TInlineAllocator<8>> Listeners(AsyncListeners);
+    for (const TWeakObjectPtr<UAsyncAction_WaitForInputAction> &ListenerPtr : Listeners)
+    {
+        UAsyncAction_WaitForInputAction *Listener = ListenerPtr.Get();
+        if (!Listener || !Listener->IsActive() || Listener->GetActionName() != ActionName)
+        {
+            continue;
+        }
 
-    // TODO: Approach C async listeners - uncomment when UAsyncAction_WaitForInputAction is implemented
-    // NotifyAsyncListeners(ActionName, ETriggerEvent::Triggered, Value);
+        // Filters run here so Blueprint only wakes up when the condition is met
+        if (Listener->PassesFilter(TriggerEvent, Value, TimeSeconds))
+        {
+            Listener->HandleInputEvent(ActionName, TriggerEvent, Value);
+        }
+    }
 
-    UE_LOG(LogTemp, Verbose, TEXT("P_MEIS: Action '%s' TRIGGERED"), *ActionName.ToString());
+    // Drop listeners that were destroyed without unregistering
+    AsyncListeners.RemoveAllSwap([](const TWeakObjectPtr<UAsyncAction_WaitForInputAction> &ListenerPtr)
+                                 { return !ListenerPtr.IsValid(); });
 }
 
-void UCPP_EnhancedInputIntegration::OnActionStartedInternal(const FInputActionInstance &ActionInstance, FName ActionName)
-{
-    FInputActionValue Value = ActionInstance.GetValue();
-
-    // Approach A: Broadcast to global dispatcher
-    OnActionStarted.Broadcast(ActionName, Value);
+// ==================== Listener Chains (Approach D) ====================
 
-    // TODO: Approach C async listeners - uncomment when UAsyncAction_WaitForInputAction is implemented
-    // NotifyAsyncListeners(ActionName, ETriggerEvent::Started, Value);
+int32 UCPP_EnhancedInputIntegration::AddActionListener(FName ActionName, int32 Priority, FOnInputActionChainEvent Handler)
+{
+    if (ActionName.IsNone() || !Handler.IsBound())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: AddActionListener - invalid action name or unbound handler"));
+        return INDEX_NONE;
+    }
 
-    UE_LOG(LogTemp, Verbose, TEXT("P_MEIS: Action '%s' STARTED"), *ActionName.ToString());
+    FInputActionChainListener Listener;
+    Listener.Priority = Priority;
+    Listener.Delegate = Handler;
+    return AddChainListener(ActionName, MoveTemp(Listener));
 }
 
-void UCPP_EnhancedInputIntegration::OnActionOngoingInternal(const FInputActionInstance &ActionInstance, FName ActionName)
+int32 UCPP_EnhancedInputIntegration::AddActionListenerNative(FName ActionName, int32 Priority, FInputActionChainFunction Handler)
 {
-    FInputActionValue Value = ActionInstance.GetValue();
-
-    // Approach A: Broadcast to global dispatcher
-    OnActionOngoing.Broadcast(ActionName, Value);
-
-    // TODO: Approach C async listeners - uncomment when UAsyncAction_WaitForInputAction is implemented
-    // NotifyAsyncListeners(ActionName, ETriggerEvent::Ongoing, Value);
+    if (ActionName.IsNone() || !Handler)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: AddActionListenerNative - invalid action name or empty handler"));
+        return INDEX_NONE;
+    }
 
-    // Note: Ongoing fires very frequently, so we use Verbose level
-    UE_LOG(LogTemp, VeryVerbose, TEXT("P_MEIS: Action '%s' ONGOING"), *ActionName.ToString());
+    FInputActionChainListener Listener;
+    Listener.Priority = Priority;
+    Listener.Function = MoveTemp(Handler);
+    return AddChainListener(ActionName, MoveTemp(Listener));
 }
 
-void UCPP_EnhancedInputIntegration::OnActionCompletedInternal(const FInputActionInstance &ActionInstance, FName ActionName)
+int32 UCPP_EnhancedInputIntegration::AddChainListener(FName ActionName, FInputActionChainListener &&Listener)
 {
-    FInputActionValue Value = ActionInstance.GetValue();
+    const int32 Handle = NextActionListenerHandle++;
+    Listener.Handle = Handle;
+    ActionListenerHandles.Add(Handle, ActionName);
 
-    // Approach A: Broadcast to global dispatcher
-    OnActionCompleted.Broadcast(ActionName, Value);
-
-    // TODO: Approach C async listeners - uncomment when UAsyncAction_WaitForInputAction is implemented
-    // NotifyAsyncListeners(ActionName, ETriggerEvent::Completed, Value);
+    // Never reshuffle a chain (or grow the state map) while a dispatch is walking it
+    if (ChainDispatchDepth > 0)
+    {
+        PendingChainAdds.Emplace(ActionName, MoveTemp(Listener));
+    }
+    else
+    {
+        InsertChainListener(ActionName, MoveTemp(Listener));
+    }
 
-    UE_LOG(LogTemp, Verbose, TEXT("P_MEIS: Action '%s' COMPLETED"), *ActionName.ToString());
+    return Handle;
 }
 
-void UCPP_EnhancedInputIntegration::OnActionCanceledInternal(const FInputActionInstance &ActionInstance, FName ActionName)
+void UCPP_EnhancedInputIntegration::InsertChainListener(FName ActionName, FInputActionChainListener &&Listener)
 {
-    FInputActionValue Value = ActionInstance.GetValue();
-
-    // Approach A: Broadcast to global dispatcher
-    OnActionCanceled.Broadcast(ActionName, Value);
+    TArray<FInputActionChainListener, TInlineAllocator<2>> &Listeners = ActionDispatchStates.FindOrAdd(ActionName).Listeners;
 
-    // TODO: Approach C async listeners - uncomment when UAsyncAction_WaitForInputAction is implemented
-    // NotifyAsyncListeners(ActionName, ETriggerEvent::Canceled, Value);
-
-    UE_LOG(LogTemp, Verbose, TEXT("P_MEIS: Action '%s' CANCELED"), *ActionName.ToString());
+    // Upper bound keeps equal priorities in subscription order
+    const int32 InsertIndex = Algo::UpperBoundBy(Listeners, Listener.Priority, &FInputActionChainListener::Priority, TGreater<int32>());
+    Listeners.Insert(MoveTemp(Listener), InsertIndex);
 }
 
-// ==================== UI / Virtual Device Injection ====================
-
-void UCPP_EnhancedInputIntegration::InjectActionStarted(const FName &ActionName)
+bool UCPP_EnhancedInputIntegration::RemoveActionListener(int32 Handle)
 {
-    if (!PlayerController || !PlayerController->IsLocalController())
+    FName ActionName;
+    if (!ActionListenerHandles.RemoveAndCopyValue(Handle, ActionName))
     {
-        return;
+        return false;
     }
 
-    const FInputActionValue Value(true);
-    OnActionStarted.Broadcast(ActionName, Value);
+    // Still waiting to be inserted
+    const int32 PendingIndex = PendingChainAdds.IndexOfByPredicate([Handle](const TPair<FName, FInputActionChainListener> &Pending)
+                                                                   { return Pending.Value.Handle == Handle; });
+    if (PendingIndex != INDEX_NONE)
+    {
+        PendingChainAdds.RemoveAt(PendingIndex);
+        return true;
+    }
+
+    FInputActionDispatchState *State = ActionDispatchStates.Find(ActionName);
+    if (!State)
+    {
+        return false;
+    }
+
+    const int32 Index = State->Listeners.IndexOfByPredicate([Handle](const FInputActionChainListener &Listener)
+                                                            { return Listener.Handle == Handle; });
+    if (Index == INDEX_NONE)
+    {
+        return false;
+    }
+
+    if (ChainDispatchDepth > 0)
+    {
+        State->Listeners[Index].bPendingRemove = true;
+        bChainsNeedCompaction = true;
+    }
+    else
+    {
+        State->Listeners.RemoveAt(Index);
+    }
+    return true;
+}
+
+int32 UCPP_EnhancedInputIntegration::RemoveActionListenersForObject(UObject *Object)
+{
+    if (!Object)
+    {
+        return 0;
+    }
+
+    TArray<int32, TInlineAllocator<8>> Handles;
+    for (const TPair<FName, FInputActionDispatchState> &Pair : ActionDispatchStates)
+    {
+        for (const FInputActionChainListener &Listener : Pair.Value.Listeners)
+        {
+            if (!Listener.bPendingRemove && Listener.Delegate.GetUObject() == Object)
+            {
+                Handles.Add(Listener.Handle);
+            }
+        }
+    }
+
+    for (const TPair<FName, FInputActionChainListener> &Pending : PendingChainAdds)
+    {
+        if (Pending.Value.Delegate.GetUObject() == Object)
+        {
+            Handles.Add(Pending.Value.Handle);
+        }
+    }
+
+    for (int32 Handle : Handles)
+    {
+        RemoveActionListener(Handle);
+    }
+    return Handles.Num();
+}
+
+int32 UCPP_EnhancedInputIntegration::GetActionListenerCount(FName ActionName) const
+{
+    const FInputActionDispatchState *State = ActionDispatchStates.Find(ActionName);
+    if (!State)
+    {
+        return 0;
+    }
+
+    int32 Count = 0;
+    for (const FInputActionChainListener &Listener : State->Listeners)
+    {
+        if (!Listener.bPendingRemove)
+        {
+            Count++;
+        }
+    }
+    return Count;
+}
+
+// ==================== Action State ====================
+
+bool UCPP_EnhancedInputIntegration::IsActionHeld(FName ActionName) const
+{
+    const FInputActionDispatchState *State = ActionDispatchStates.Find(ActionName);
+    return State && State->bHeld;
+}
+
+FInputActionValue UCPP_EnhancedInputIntegration::GetActionValue(FName ActionName) const
+{
+    const FInputActionDispatchState *State = ActionDispatchStates.Find(ActionName);
+    return State ? State->LastValue : FInputActionValue();
+}
+
+// ==================== Action Groups ====================
+
+bool UCPP_EnhancedInputIntegration::SetActionGroupEnabled(FName GroupName, bool bEnabled, bool bSuppressMappings)
+{
+    // Bits are only handed out by applied bindings, so a misspelt group cannot use one up
+    const int32 *Bit = ActionGroupBits.Find(GroupName);
+    if (!Bit)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: SetActionGroupEnabled - no applied binding is in group '%s'"), *GroupName.ToString());
+        return false;
+    }
+
+    const uint64 GroupBit = uint64(1) << *Bit;
+    if (bEnabled)
+    {
+        DisabledGroupMask &= ~GroupBit;
+        if (SuppressedGroupMask & GroupBit)
+        {
+            RestoreGroupMappings(GroupBit);
+        }
+        return true;
+    }
+
+    DisabledGroupMask |= GroupBit;
+    if (bSuppressMappings && !(SuppressedGroupMask & GroupBit))
+    {
+        SuppressGroupMappings(GroupBit);
+    }
+    return true;
+}
+
+bool UCPP_EnhancedInputIntegration::IsActionGroupEnabled(FName GroupName) const
+{
+    const int32 *Bit = ActionGroupBits.Find(GroupName);
+    return !Bit || !(DisabledGroupMask & (uint64(1) << *Bit));
+}
+
+bool UCPP_EnhancedInputIntegration::IsActionEnabled(FName ActionName) const
+{
+    const FInputActionDispatchState *State = ActionDispatchStates.Find(ActionName);
+    return !State || !(State->GroupMask & DisabledGroupMask);
+}
+
+void UCPP_EnhancedInputIntegration::EnableAllActionGroups()
+{
+    DisabledGroupMask = 0;
+    if (SuppressedGroupMask != 0)
+    {
+        RestoreGroupMappings(SuppressedGroupMask);
+    }
+}
+
+void UCPP_EnhancedInputIntegration::GetActionGroups(TArray<FName> &OutGroups) const
+{
+    ActionGroupBits.GenerateKeyArray(OutGroups);
+}
+
+int32 UCPP_EnhancedInputIntegration::FindOrAddActionGroupBit(FName GroupName)
+{
+    if (GroupName.IsNone())
+    {
+        return INDEX_NONE;
+    }
+
+    if (const int32 *Bit = ActionGroupBits.Find(GroupName))
+    {
+        return *Bit;
+    }
+
+    const int32 NewBit = ActionGroupBits.Num();
+    if (NewBit >= 64)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Action group '%s' ignored - a player can have at most 64 groups"), *GroupName.ToString());
+        return INDEX_NONE;
+    }
+
+    ActionGroupBits.Add(GroupName, NewBit);
+    return NewBit;
+}
+
+void UCPP_EnhancedInputIntegration::AssignActionGroups(FName ActionName, FName Category, const TArray<FName> &Groups)
+{
+    uint64 Mask = 0;
+    const int32 CategoryBit = FindOrAddActionGroupBit(Category);
+    if (CategoryBit != INDEX_NONE)
+    {
+        Mask |= uint64(1) << CategoryBit;
+    }
+    for (const FName &Group : Groups)
+    {
+        const int32 Bit = FindOrAddActionGroupBit(Group);
+        if (Bit != INDEX_NONE)
+        {
+            Mask |= uint64(1) << Bit;
+        }
+    }
+
+    // A listener applying a profile mid-dispatch must not add map keys under the chain being walked
+    if (FInputActionDispatchState *State = ActionDispatchStates.Find(ActionName))
+    {
+        State->GroupMask = Mask;
+    }
+    else if (ChainDispatchDepth > 0)
+    {
+        PendingGroupMasks.Emplace(ActionName, Mask);
+    }
+    else
+    {
+        ActionDispatchStates.Add(ActionName).GroupMask = Mask;
+    }
+}
+
+uint64 UCPP_EnhancedInputIntegration::GetGroupMaskForAction(const UInputAction *Action) const
+{
+    for (const TPair<FName, UInputAction *> &Pair : CreatedInputActions)
+    {
+        if (Pair.Value == Action)
+        {
+            const FInputActionDispatchState *State = ActionDispatchStates.Find(Pair.Key);
+            return State ? State->GroupMask : 0;
+        }
+    }
+    return 0;
+}
+
+void UCPP_EnhancedInputIntegration::SuppressGroupMappings(uint64 GroupMask)
+{
+    SuppressedGroupMask |= GroupMask;
+    if (!MappingContext)
+    {
+        return;
+    }
+
+    // Pulled mappings keep their modifiers/triggers and go back unchanged on restore
+    bool bChanged = false;
+    TArray<FEnhancedActionKeyMapping, TInlineAllocator<8>> Suppressed;
+    for (const FEnhancedActionKeyMapping &Mapping : MappingContext->GetMappings())
+    {
+        if (GetGroupMaskForAction(Mapping.Action) & GroupMask)
+        {
+            Suppressed.Add(Mapping);
+        }
+    }
+    for (const FEnhancedActionKeyMapping &Mapping : Suppressed)
+    {
+        MappingContext->UnmapKey(Mapping.Action, Mapping.Key);
+        SuppressedMappings.Add(Mapping);
+        bChanged = true;
+    }
+
+    if (!bChanged)
+    {
+        return;
+    }
+
+    // No key reaches these actions any more, so no release will either
+    TArray<FName, TInlineAllocator<8>> HeldActions;
+    for (const TPair<FName, FInputActionDispatchState> &Pair : ActionDispatchStates)
+    {
+        if (Pair.Value.bHeld && (Pair.Value.GroupMask & GroupMask))
+        {
+            HeldActions.Add(Pair.Key);
+        }
+    }
+    for (const FName &ActionName : HeldActions)
+    {
+        DispatchActionEvent(ActionName, ETriggerEvent::Canceled, FInputActionValue());
+    }
+
+    if (PlayerController)
+    {
+        ApplyMappingContextToPlayer();
+    }
+}
+
+void UCPP_EnhancedInputIntegration::RestoreGroupMappings(uint64 GroupMask)
+{
+    SuppressedGroupMask &= ~GroupMask;
+    if (!MappingContext)
+    {
+        return;
+    }
+
+    // A mapping stays out while another of its action's groups is still suppressed
+    bool bChanged = false;
+    for (int32 Index = SuppressedMappings.Num() - 1; Index >= 0; --Index)
+    {
+        const FEnhancedActionKeyMapping &Saved = SuppressedMappings[Index];
+        if (GetGroupMaskForAction(Saved.Action) & SuppressedGroupMask)
+        {
+            continue;
+        }
+
+        if (Saved.Action)
+        {
+            MappingContext->MapKey(Saved.Action, Saved.Key) = Saved;
+        }
+        SuppressedMappings.RemoveAt(Index, 1, EAllowShrinking::No);
+        bChanged = true;
+    }
+
+    if (bChanged && PlayerController)
+    {
+        ApplyMappingContextToPlayer();
+    }
+}
+
+// ==================== Action Rates ====================
+
+FS_InputActionRates UCPP_EnhancedInputIntegration::GetActionRates(FName ActionName)
+{
+    FInputActionDispatchState *State = ActionDispatchStates.Find(ActionName);
+    return State ? State->Rate.Read(FPlatformTime::Seconds()) : FS_InputActionRates();
+}
+
+FS_InputActionRates UCPP_EnhancedInputIntegration::GetPlayerRates()
+{
+    return PlayerRate.Read(FPlatformTime::Seconds());
+}
+
+int32 UCPP_EnhancedInputIntegration::GetActionsPerMinute()
+{
+    return GetPlayerRates().Count60s;
+}
+
+void UCPP_EnhancedInputIntegration::ResetRateCounters()
+{
+    PlayerRate.Reset();
+    for (TPair<FName, FInputActionDispatchState> &Pair : ActionDispatchStates)
+    {
+        Pair.Value.Rate.Reset();
+    }
+}
+
+// ==================== Timing Anomaly Detection ====================
+
+void UCPP_EnhancedInputIntegration::SetTimingThresholds(const FS_InputTimingThresholds &NewThresholds)
+{
+    TimingThresholds = NewThresholds;
+    TimingThresholds.MinSamples = FMath::Max(TimingThresholds.MinSamples, 2);
+}
+
+FS_InputTimingReport UCPP_EnhancedInputIntegration::GetActionTimingReport(FName ActionName) const
+{
+    const FInputActionDispatchState *State = ActionDispatchStates.Find(ActionName);
+    if (!State)
+    {
+        return FS_InputTimingReport();
+    }
+    return State->Timing.MakeReport(State->Timing.Evaluate(TimingThresholds));
+}
+
+void UCPP_EnhancedInputIntegration::ResetTimingStats()
+{
+    for (TPair<FName, FInputActionDispatchState> &Pair : ActionDispatchStates)
+    {
+        Pair.Value.Timing.Reset();
+    }
+}
+
+void UCPP_EnhancedInputIntegration::RecordActionTiming(FName ActionName, FInputTimingTracker &Timing, bool bPress, double TimeSeconds)
+{
+    if (bPress)
+    {
+        Timing.RecordPress(TimeSeconds, TimingThresholds);
+    }
+    else
+    {
+        Timing.RecordRelease(TimeSeconds);
+    }
+
+    const EP_MEIS_TimingAnomaly Flags = Timing.Evaluate(TimingThresholds);
+    const EP_MEIS_TimingAnomaly NewFlags = Flags & ~Timing.ReportedAnomalies;
+    Timing.ReportedAnomalies = Flags;
+
+    if (NewFlags != EP_MEIS_TimingAnomaly::None)
+    {
+        const FS_InputTimingReport Report = Timing.MakeReport(Flags);
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Timing anomaly on '%s' (flags 0x%02x, interval sd %.2f ms, entropy %.2f bits, repeat streak %d)"),
+               *ActionName.ToString(), Report.AnomalyFlags, Report.IntervalStdDevMs, Report.IntervalEntropyBits, Report.RepeatedIntervalStreak);
+        OnTimingAnomaly.Broadcast(ActionName, Report);
+    }
+}
+
+// ==================== Late-Latched Look ====================
+
+/** Run modifiers that hold no per-frame state; smoothing would see a second sample in the frame and skew the gameplay value */
+static void ApplyStatelessModifiers(const TArray<TObjectPtr<UInputModifier>> &Modifiers, const UEnhancedPlayerInput *PlayerInput, FInputActionValue &Value, float DeltaSeconds)
+{
+    for (UInputModifier *Modifier : Modifiers)
+    {
+        if (!Modifier || Modifier->IsA<UInputModifierSmooth>() || Modifier->IsA<UInputModifierSmoothDelta>())
+        {
+            continue;
+        }
+        Value = Modifier->ModifyRaw(PlayerInput, Value, DeltaSeconds);
+    }
+}
+
+void UCPP_EnhancedInputIntegration::SetLateLatchedLook(FName ActionName, bool bEnable)
+{
+    if (bEnable)
+    {
+        LateLatchedLook.FindOrAdd(ActionName, FVector2D::ZeroVector);
+        FInputLateLatch::Get().Register(this);
+    }
+    else if (LateLatchedLook.Remove(ActionName) > 0 && LateLatchedLook.Num() == 0)
+    {
+        FInputLateLatch::Get().Unregister(this);
+    }
+}
+
+FVector2D UCPP_EnhancedInputIntegration::GetLateLatchedLookValue(FName ActionName) const
+{
+    const FVector2D *Value = LateLatchedLook.Find(ActionName);
+    return Value ? *Value : FVector2D::ZeroVector;
+}
+
+void UCPP_EnhancedInputIntegration::SampleLateLatchedLook(const FInputLateLatch &LateLatch, float DeltaSeconds)
+{
+    const ULocalPlayer *LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+    if (!LocalPlayer || !MappingContext)
+    {
+        return;
+    }
+
+    const int32 UserIndex = LocalPlayer->GetControllerId();
+    const UEnhancedPlayerInput *PlayerInput = Cast<UEnhancedPlayerInput>(PlayerController->PlayerInput);
+
+    for (TPair<FName, FVector2D> &Entry : LateLatchedLook)
+    {
+        const UInputAction *Action = GetInputAction(Entry.Key);
+        if (!Action)
+        {
+            Entry.Value = FVector2D::ZeroVector;
+            continue;
+        }
+
+        // Same order as Enhanced Input: per-mapping modifiers, mappings summed, then action modifiers
+        FVector2D Combined = FVector2D::ZeroVector;
+        for (const FEnhancedActionKeyMapping &Mapping : MappingContext->GetMappings())
+        {
+            if (Mapping.Action != Action)
+            {
+                continue;
+            }
+
+            FInputActionValue Value(EInputActionValueType::Axis2D, FVector(LateLatch.GetKeyValue(UserIndex, Mapping.Key), 0.0));
+            ApplyStatelessModifiers(Mapping.Modifiers, PlayerInput, Value, DeltaSeconds);
+            Combined += Value.Get<FVector2D>();
+        }
+
+        FInputActionValue ActionValue(Combined);
+        ApplyStatelessModifiers(Action->Modifiers, PlayerInput, ActionValue, DeltaSeconds);
+        Entry.Value = ActionValue.Get<FVector2D>();
+    }
+
+    // Listeners may toggle late latching, so broadcast from a copy
+    TArray<TPair<FName, FVector2D>, TInlineAllocator<4>> Sampled;
+    for (const TPair<FName, FVector2D> &Entry : LateLatchedLook)
+    {
+        Sampled.Add(Entry);
+    }
+    for (const TPair<FName, FVector2D> &Entry : Sampled)
+    {
+        OnLateLatchedLook.Broadcast(Entry.Key, Entry.Value);
+    }
+}
+
+bool UCPP_EnhancedInputIntegration::RunListenerChain(const FInputActionDispatchState &State, FName ActionName, ETriggerEvent TriggerEvent, const FInputActionValue &Value) const
+{
+    // Chains are sorted by priority, so the first consumer wins
+    for (const FInputActionChainListener &Listener : State.Listeners)
+    {
+        if (!Listener.bPendingRemove && Listener.Invoke(ActionName, TriggerEvent, Value))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void UCPP_EnhancedInputIntegration::FlushPendingChainChanges()
+{
+    if (bChainsNeedCompaction)
+    {
+        for (TPair<FName, FInputActionDispatchState> &Pair : ActionDispatchStates)
+        {
+            Pair.Value.Listeners.RemoveAll([](const FInputActionChainListener &Listener)
+                                           { return Listener.bPendingRemove; });
+        }
+        bChainsNeedCompaction = false;
+    }
+
+    for (const TPair<FName, uint64> &Pending : PendingGroupMasks)
+    {
+        ActionDispatchStates.FindOrAdd(Pending.Key).GroupMask = Pending.Value;
+    }
+    PendingGroupMasks.Reset();
+
+    TArray<TPair<FName, FInputActionChainListener>> Adds = MoveTemp(PendingChainAdds);
+    PendingChainAdds.Reset();
+    for (TPair<FName, FInputActionChainListener> &Pending : Adds)
+    {
+        InsertChainListener(Pending.Key, MoveTemp(Pending.Value));
+    }
+}
+
+// ==================== Internal Event Handlers ====================
+
+void UCPP_EnhancedInputIntegration::HandleActionEvent(const FInputActionInstance &ActionInstance, FName ActionName)
+{
+    // This is a generic handler - not used directly, but available for future use
+    FInputActionValue Value = ActionInstance.GetValue();
+
+    // Broadcast legacy delegate
+    OnDynamicInputAction.Broadcast(ActionName, Value);
+}
+
+void UCPP_EnhancedInputIntegration::OnActionTriggeredInternal(const FInputActionInstance &ActionInstance, FName ActionName)
+{
+    DispatchActionEvent(ActionName, ETriggerEvent::Triggered, ActionInstance.GetValue());
+
+    UE_LOG(LogTemp, Verbose, TEXT("P_MEIS: Action '%s' TRIGGERED"), *ActionName.ToString());
+}
+
+void UCPP_EnhancedInputIntegration::OnActionStartedInternal(const FInputActionInstance &ActionInstance, FName ActionName)
+{
+    DispatchActionEvent(ActionName, ETriggerEvent::Started, ActionInstance.GetValue());
+
+    UE_LOG(LogTemp, Verbose, TEXT("P_MEIS: Action '%s' STARTED"), *ActionName.ToString());
+}
+
+void UCPP_EnhancedInputIntegration::OnActionOngoingInternal(const FInputActionInstance &ActionInstance, FName ActionName)
+{
+    DispatchActionEvent(ActionName, ETriggerEvent::Ongoing, ActionInstance.GetValue());
+
+    // Note: Ongoing fires very frequently, so we use Verbose level
+    UE_LOG(LogTemp, VeryVerbose, TEXT("P_MEIS: Action '%s' ONGOING"), *ActionName.ToString());
+}
+
+void UCPP_EnhancedInputIntegration::OnActionCompletedInternal(const FInputActionInstance &ActionInstance, FName ActionName)
+{
+    DispatchActionEvent(ActionName, ETriggerEvent::Completed, ActionInstance.GetValue());
+
+    UE_LOG(LogTemp, Verbose, TEXT("P_MEIS: Action '%s' COMPLETED"), *ActionName.ToString());
+}
+
+void UCPP_EnhancedInputIntegration::OnActionCanceledInternal(const FInputActionInstance &ActionInstance, FName ActionName)
+{
+    DispatchActionEvent(ActionName, ETriggerEvent::Canceled, ActionInstance.GetValue());
+
+    UE_LOG(LogTemp, Verbose, TEXT("P_MEIS: Action '%s' CANCELED"), *ActionName.ToString());
+}
+
+// ==================== Event Dispatch ====================
+
+void UCPP_EnhancedInputIntegration::DispatchActionEvent(FName ActionName, ETriggerEvent TriggerEvent, const FInputActionValue &Value)
+{
+    LLM_SCOPE_BYTAG(PMEIS);
+    // Action state, rate counters and timing stats see every event, including ones a chain listener consumes
+    const bool bPress = TriggerEvent == ETriggerEvent::Started;
+    const bool bRelease = TriggerEvent == ETriggerEvent::Completed || TriggerEvent == ETriggerEvent::Canceled;
+
+    // Disabled action groups: drop the event, except the release of a press that already went out
+    if (DisabledGroupMask != 0)
+    {
+        const FInputActionDispatchState *GroupState = ActionDispatchStates.Find(ActionName);
+        if (GroupState && (GroupState->GroupMask & DisabledGroupMask) && !(bRelease && GroupState->bHeld))
+        {
+            return;
+        }
+    }
+
+    if (Analytics && (bPress || bRelease))
+    {
+        bPress ? Analytics->RecordActionPress(ActionName, AnalyticsContext) : Analytics->RecordActionRelease(ActionName);
+    }
+
+    const double Now = bPress || (bRelease && TimingThresholds.bEnabled) ? FPlatformTime::Seconds() : 0.0;
+    if (bPress)
+    {
+        PlayerRate.Record(Now);
+    }
+
+    // No new map keys mid-dispatch - an outer chain may still be walking a state
+    FInputActionDispatchState *StatsState = ChainDispatchDepth == 0 ? &ActionDispatchStates.FindOrAdd(ActionName) : ActionDispatchStates.Find(ActionName);
+    if (StatsState)
+    {
+        StatsState->LastValue = Value;
+        if (bPress)
+        {
+            StatsState->bHeld = true;
+            StatsState->Rate.Record(Now);
+        }
+        else if (bRelease)
+        {
+            StatsState->bHeld = false;
+        }
+
+        if (TimingThresholds.bEnabled && (bPress || bRelease))
+        {
+            // May broadcast; StatsState is not touched afterwards
+            RecordActionTiming(ActionName, StatsState->Timing, bPress, Now);
+        }
+    }
+
+    // Approach D: priority-ordered listener chain - a consuming listener stops propagation here
+    if (const FInputActionDispatchState *State = ActionDispatchStates.Find(ActionName))
+    {
+        if (State->Listeners.Num() > 0)
+        {
+            ChainDispatchDepth++;
+            const bool bConsumed = RunListenerChain(*State, ActionName, TriggerEvent, Value);
+            ChainDispatchDepth--;
+
+            if (ChainDispatchDepth == 0 && (PendingChainAdds.Num() > 0 || PendingGroupMasks.Num() > 0 || bChainsNeedCompaction))
+            {
+                FlushPendingChainChanges();
+            }
+
+            if (bConsumed)
+            {
+                UE_LOG(LogTemp, VeryVerbose, TEXT("P_MEIS: Action '%s' consumed by listener chain"), *ActionName.ToString());
+                return;
+            }
+        }
+    }
+
+    // Approach A: Broadcast to global dispatchers
+    switch (TriggerEvent)
+    {
+    case ETriggerEvent::Triggered:
+        OnActionTriggered.Broadcast(ActionName, Value);
+
+        // Legacy support
+        OnDynamicInputAction.Broadcast(ActionName, Value);
+        break;
+
+    case ETriggerEvent::Started:
+        OnActionStarted.Broadcast(ActionName, Value);
+        break;
+
+    case ETriggerEvent::Ongoing:
+        OnActionOngoing.Broadcast(ActionName, Value);
+        break;
+
+    case ETriggerEvent::Completed:
+        OnActionCompleted.Broadcast(ActionName, Value);
+        break;
+
+    case ETriggerEvent::Canceled:
+        OnActionCanceled.Broadcast(ActionName, Value);
+        break;
+
+    default:
+        break;
+    }
+
+    // Approach C: Per-action async listeners (filters evaluated natively)
+    NotifyAsyncListeners(ActionName, TriggerEvent, Value);
+}
+
+// ==================== UI / Virtual Device Injection ====================
+
+void UCPP_EnhancedInputIntegration::InjectActionStarted(const FName &ActionName)
+{
+    if (!PlayerController || !PlayerController->IsLocalController())
+    {
+        return;
+    }
+
+    DispatchActionEvent(ActionName, ETriggerEvent::Started, FInputActionValue(true));
 }
 
 void UCPP_EnhancedInputIntegration::InjectActionTriggered(const FName &ActionName)
@@ -956,9 +2023,7 @@ void UCPP_EnhancedInputIntegration::InjectActionTriggered(const FName &ActionNam
         return;
     }
 
-    const FInputActionValue Value(true);
-    OnActionTriggered.Broadcast(ActionName, Value);
-    OnDynamicInputAction.Broadcast(ActionName, Value);
+    DispatchActionEvent(ActionName, ETriggerEvent::Triggered, FInputActionValue(true));
 }
 
 void UCPP_EnhancedInputIntegration::InjectActionCompleted(const FName &ActionName)
@@ -968,8 +2033,7 @@ void UCPP_EnhancedInputIntegration::InjectActionCompleted(const FName &ActionNam
         return;
     }
 
-    const FInputActionValue Value(false);
-    OnActionCompleted.Broadcast(ActionName, Value);
+    DispatchActionEvent(ActionName, ETriggerEvent::Completed, FInputActionValue(false));
 }
 
 void UCPP_EnhancedInputIntegration::InjectAxis2D(const FName &AxisName, const FVector2D &Value)
@@ -979,9 +2043,17 @@ void UCPP_EnhancedInputIntegration::InjectAxis2D(const FName &AxisName, const FV
         return;
     }
 
-    const FInputActionValue InputValue(Value);
-    OnActionTriggered.Broadcast(AxisName, InputValue);
-    OnDynamicInputAction.Broadcast(AxisName, InputValue);
+    DispatchActionEvent(AxisName, ETriggerEvent::Triggered, FInputActionValue(Value));
+}
+
+void UCPP_EnhancedInputIntegration::InjectActionEvent(const FName &ActionName, ETriggerEvent TriggerEvent, const FInputActionValue &Value)
+{
+    if (!OwningController || (!OwningController->IsLocalController() && !OwningController->HasAuthority()))
+    {
+        return;
+    }
+
+    DispatchActionEvent(ActionName, TriggerEvent, Value);
 }
 
 // ==================== Section 0.9: Dynamic Input Modifiers & Triggers ====================
@@ -990,7 +2062,11 @@ void UCPP_EnhancedInputIntegration::InjectAxis2D(const FName &AxisName, const FV
 int32 UCPP_EnhancedInputIntegration::TryBindPendingActions()
 {
     int32 BoundCount = 0;
-    TSet<FName> SuccessfullyBound;
+
+    // Scratch on the thread's mem stack, released when Mark goes out of scope
+    FMemMark Mark(FMemStack::Get());
+    TArray<FName, TMemStackAllocator<>> SuccessfullyBound;
+    SuccessfullyBound.Reserve(PendingBindActions.Num());
 
     for (const FName &ActionName : PendingBindActions)
     {
@@ -1028,15 +2104,22 @@ UInputAction *UCPP_EnhancedInputIntegration::CreateDynamicInputActionWithModifie
         return nullptr;
     }
 
+    if (IsAuthoredAction(ActionName))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: '%s' is an authored Input Action asset - action-level modifiers were not added"), *ActionName.ToString());
+        return Action;
+    }
+
     // Set the value type
     Action->ValueType = ValueType;
+    AppliedProfileHash = 0;
 
     // Add modifiers
     for (const FS_InputModifierConfig &ModConfig : Modifiers)
     {
         if (ModConfig.bEnabled)
         {
-            UInputModifier *Modifier = CreateUInputModifier(ModConfig, Action);
+            UInputModifier *Modifier = GetOrCreateModifier(ModConfig);
             if (Modifier)
             {
                 Action->Modifiers.Add(Modifier);
@@ -1062,7 +2145,13 @@ bool UCPP_EnhancedInputIntegration::AddModifierToAction(const FName &ActionName,
         return false;
     }
 
-    UInputModifier *Modifier = CreateUInputModifier(ModifierConfig, Action);
+    if (IsAuthoredAction(ActionName))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: AddModifierToAction - '%s' is an authored asset shared by all players, use key mapping modifiers instead"), *ActionName.ToString());
+        return false;
+    }
+
+    UInputModifier *Modifier = GetOrCreateModifier(ModifierConfig);
     if (!Modifier)
     {
         UE_LOG(LogTemp, Warning, TEXT("P_MEIS: AddModifierToAction - failed to create modifier"));
@@ -1070,6 +2159,7 @@ bool UCPP_EnhancedInputIntegration::AddModifierToAction(const FName &ActionName,
     }
 
     Action->Modifiers.Add(Modifier);
+    AppliedProfileHash = 0;
     UE_LOG(LogTemp, Log, TEXT("P_MEIS: Added modifier to action '%s'"), *ActionName.ToString());
     return true;
 }
@@ -1098,7 +2188,14 @@ bool UCPP_EnhancedInputIntegration::ClearActionModifiers(const FName &ActionName
         return false;
     }
 
+    if (IsAuthoredAction(ActionName))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: ClearActionModifiers - '%s' is an authored asset shared by all players"), *ActionName.ToString());
+        return false;
+    }
+
     Action->Modifiers.Empty();
+    AppliedProfileHash = 0;
     UE_LOG(LogTemp, Log, TEXT("P_MEIS: Cleared all modifiers from action '%s'"), *ActionName.ToString());
     return true;
 }
@@ -1457,3 +2554,81 @@ UInputTrigger *UCPP_EnhancedInputIntegration::CreateUInputTrigger(const FS_Input
         return nullptr;
     }
 }
+
+// ==================== Shared Modifier/Trigger Instances ====================
+
+UInputModifier *UCPP_EnhancedInputIntegration::GetOrCreateModifier(const FS_InputModifierConfig &ModifierConfig)
+{
+    if (!ModifierConfig.bEnabled)
+    {
+        return nullptr;
+    }
+
+    FlyweightStats.ModifierRequests++;
+
+    const bool bShareable = !FS_InputModifierConfig::IsStatefulType(ModifierConfig.ModifierType);
+    if (bShareable)
+    {
+        if (UInputModifier **Existing = SharedModifiers.Find(ModifierConfig))
+        {
+            return *Existing;
+        }
+    }
+
+    UInputModifier *Modifier = CreateUInputModifier(ModifierConfig, this);
+    if (!Modifier)
+    {
+        FlyweightStats.ModifierRequests--;
+        return nullptr;
+    }
+
+    FlyweightStats.ModifierInstances++;
+    FlyweightInstances.Add(Modifier);
+    if (bShareable)
+    {
+        SharedModifiers.Add(ModifierConfig, Modifier);
+    }
+    return Modifier;
+}
+
+UInputTrigger *UCPP_EnhancedInputIntegration::GetOrCreateTrigger(const FS_InputTriggerConfig &TriggerConfig)
+{
+    if (!TriggerConfig.bEnabled)
+    {
+        return nullptr;
+    }
+
+    FlyweightStats.TriggerRequests++;
+
+    const bool bShareable = !FS_InputTriggerConfig::IsStatefulType(TriggerConfig.TriggerType);
+    if (bShareable)
+    {
+        if (UInputTrigger **Existing = SharedTriggers.Find(TriggerConfig))
+        {
+            return *Existing;
+        }
+    }
+
+    UInputTrigger *Trigger = CreateUInputTrigger(TriggerConfig, this, this);
+    if (!Trigger)
+    {
+        FlyweightStats.TriggerRequests--;
+        return nullptr;
+    }
+
+    FlyweightStats.TriggerInstances++;
+    FlyweightInstances.Add(Trigger);
+    if (bShareable)
+    {
+        SharedTriggers.Add(TriggerConfig, Trigger);
+    }
+    return Trigger;
+}
+
+void UCPP_EnhancedInputIntegration::ResetFlyweightCache()
+{
+    SharedModifiers.Reset();
+    SharedTriggers.Reset();
+    FlyweightInstances.Reset();
+    FlyweightStats = FS_InputFlyweightStats();
+}
@@ -18,6 +18,9 @@
 #include "InputBinding/FS_InputActionBinding.h"
 #include "InputBinding/FS_InputModifier.h"
 #include "InputBinding/FS_InputTriggerConfig.h"
+#include "InputBinding/FS_InputActionRate.h"
+#include "InputBinding/FS_InputTimingStats.h"
+#include "InputBinding/FS_StickCalibration.h"
 #include "CPP_EnhancedInputIntegration.generated.h"
 
 class APlayerController;
@@ -30,6 +33,10 @@ class UInputTrigger;
 class UInputModifierDeadZone;
 class UInputModifierNegate;
 class UInputModifierScalar;
+class UCPP_InputActionAssetRegistry;
+class UCPP_InputModifierStickCalibration;
+class UCPP_InputAnalytics;
+class FInputLateLatch;
 
 // ==================== Delegate Declarations ====================
 
@@ -40,9 +47,98 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnDynamicInputAction, FName, Actio
 // These fire for ALL actions, Blueprint can filter by ActionName
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInputActionEvent, FName, ActionName, FInputActionValue, Value);
 
+// Priority-ordered listener chain handler (Approach D) - return true to consume the event
+DECLARE_DYNAMIC_DELEGATE_RetVal_ThreeParams(bool, FOnInputActionChainEvent, FName, ActionName, ETriggerEvent, TriggerEvent, FInputActionValue, Value);
+
+// Fires when an action's press/hold timing newly trips an anomaly threshold
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInputTimingAnomaly, FName, ActionName, const FS_InputTimingReport &, Report);
+
+// Fires right before the camera update with a late-latched look action's freshly sampled value
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLateLatchedLook, FName, ActionName, FVector2D, Value);
+
+// Fires when a device's stick calibration estimate changes (the manager stores it in the player's profile)
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnStickCalibrationUpdated, FName /*HardwareId*/, const FS_StickCalibration &);
+
+/** Native chain handler - return true to consume the event */
+using FInputActionChainFunction = TFunction<bool(FName ActionName, ETriggerEvent TriggerEvent, const FInputActionValue &Value)>;
+
 // Forward declaration for async action
 class UAsyncAction_WaitForInputAction;
 
+/** One listener in an action's chain */
+struct FInputActionChainListener
+{
+    int32 Handle = INDEX_NONE;
+    int32 Priority = 0;
+    FOnInputActionChainEvent Delegate;
+    FInputActionChainFunction Function;
+
+    /** Set when removed mid-dispatch; compacted once dispatch unwinds */
+    bool bPendingRemove = false;
+
+    bool Invoke(FName ActionName, ETriggerEvent TriggerEvent, const FInputActionValue &Value) const
+    {
+        if (Function)
+        {
+            return Function(ActionName, TriggerEvent, Value);
+        }
+        return Delegate.IsBound() && Delegate.Execute(ActionName, TriggerEvent, Value);
+    }
+};
+
+/**
+ * Per-action runtime dispatch state
+ * Looked up once per event in DispatchActionEvent
+ */
+struct FInputActionDispatchState
+{
+    /** Listener chain sorted by descending priority (ties keep subscription order); most actions have one or two */
+    TArray<FInputActionChainListener, TInlineAllocator<2>> Listeners;
+
+    /** Latest value seen for the action (real or injected) */
+    FInputActionValue LastValue;
+
+    /** Between Started and Completed/Canceled */
+    bool bHeld = false;
+
+    /** Started events over the trailing 1s / 10s / 60s */
+    FInputRateCounter Rate;
+
+    /** Press interval / hold duration statistics (only fed while timing checks are enabled) */
+    FInputTimingTracker Timing;
+
+    /** Bits of the action groups the action belongs to (see UCPP_EnhancedInputIntegration::SetActionGroupEnabled) */
+    uint64 GroupMask = 0;
+};
+
+/**
+ * Flyweight cache statistics for one integration
+ * Requests counts every modifier/trigger asked for; Instances counts objects actually created
+ */
+USTRUCT(BlueprintType)
+struct P_MEIS_API FS_InputFlyweightStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Flyweight")
+    int32 ModifierRequests = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Flyweight")
+    int32 ModifierInstances = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Flyweight")
+    int32 TriggerRequests = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Flyweight")
+    int32 TriggerInstances = 0;
+
+    /** Objects not created because an identical stateless instance was reused */
+    int32 GetInstancesSaved() const
+    {
+        return (ModifierRequests - ModifierInstances) + (TriggerRequests - TriggerInstances);
+    }
+};
+
 /**
  * Integration layer with UE5 Enhanced Input System
  * Creates Input Actions, Mapping Contexts, and key bindings dynamically at runtime
@@ -59,6 +155,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Input Binding|Integration")
     bool ApplyProfile(const FS_InputProfile &Profile);
 
+    /** ApplyProfile with ComputeProfileHash(Profile) already known (shared profiles applied to many players) */
+    bool ApplyProfileWithHash(const FS_InputProfile &Profile, uint32 ProfileHash);
+
     /** Apply a single action binding - creates Input Action if needed */
     UFUNCTION(BlueprintCallable, Category = "Input Binding|Integration")
     bool ApplyActionBinding(const FS_InputActionBinding &ActionBinding);
@@ -85,12 +184,47 @@ public:
     UFUNCTION(BlueprintPure, Category = "Input Binding|Integration")
     APlayerController *GetPlayerController() const { return PlayerController; }
 
+    /**
+     * Let go of the current controller but keep the built mapping context, actions and modifiers
+     * Used when a departed player's Integration is cached for their return
+     */
+    void DetachController();
+
+    /** Attach a new player controller to an already built Integration and rebind its action events */
+    void ReattachPlayerController(APlayerController *InPlayerController);
+
+    /** Fingerprint of the bindings last applied by ApplyProfile (0 if none, or if mappings were edited since) */
+    uint32 GetAppliedProfileHash() const { return AppliedProfileHash; }
+
+    /** Fingerprint of a profile's action/axis bindings (ignores name, description and timestamp); never 0 */
+    static uint32 ComputeProfileHash(const FS_InputProfile &Profile);
+
+    /**
+     * True if the mapping context is still exactly what ApplyProfile built from these bindings
+     * ProfileHash is ComputeProfileHash(Profile); a match is confirmed against the applied bindings.
+     */
+    bool IsProfileApplied(const FS_InputProfile &Profile, uint32 ProfileHash) const;
+
     // ==================== Dynamic Input Action Creation ====================
 
-    /** Create a new Input Action dynamically at runtime */
+    /**
+     * Create a new Input Action dynamically at runtime
+     * If the asset registry has an authored asset with a matching name, that asset is returned instead
+     */
     UFUNCTION(BlueprintCallable, Category = "Input Binding|Integration")
     UInputAction *CreateInputAction(const FName &ActionName, EInputActionValueType ValueType = EInputActionValueType::Boolean);
 
+    /** Set the registry used to resolve authored Input Action assets (set by the manager on registration) */
+    void SetActionAssetRegistry(UCPP_InputActionAssetRegistry *InRegistry) { ActionAssetRegistry = InRegistry; }
+
+    /**
+     * Check if an action is bound to an authored asset (shared, never modified by P_MEIS)
+     * @param ActionName Name of the action
+     * @return True if the action is an authored asset rather than a transient dynamic action
+     */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Integration")
+    bool IsAuthoredAction(const FName &ActionName) const { return AuthoredActions.Contains(ActionName); }
+
     /** Get an existing Input Action by name, or nullptr if not found */
     UFUNCTION(BlueprintPure, Category = "Input Binding|Integration")
     UInputAction *GetInputAction(const FName &ActionName) const;
@@ -103,6 +237,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Input Binding|Integration")
     void GetAllInputActions(TArray<UInputAction *> &OutActions) const;
 
+    /** Get the names of all created Input Actions */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Integration")
+    void GetAllInputActionNames(TArray<FName> &OutNames) const;
+
     // ==================== Key Mapping ====================
 
     /** Map a key to an action (creates action if needed) */
@@ -203,6 +341,84 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "P_MEIS|Action Events")
     FOnInputActionEvent OnActionCanceled;
 
+    // ==================== Listener Chains (Approach D) ====================
+    // Per-action handlers ordered by priority (highest first). A handler returning true consumes
+    // the event: lower-priority handlers, the global dispatchers and async listeners do not run.
+    // Example: UI at priority 100, vehicle at 50, character at 0.
+
+    /**
+     * Add a handler to an action's listener chain
+     * @param ActionName Action to listen to
+     * @param Priority Higher runs first; equal priorities run in subscription order
+     * @param Handler Returns true to consume the event
+     * @return Handle used to remove the listener
+     */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Listener Chains")
+    int32 AddActionListener(FName ActionName, int32 Priority, FOnInputActionChainEvent Handler);
+
+    /** Native variant of AddActionListener */
+    int32 AddActionListenerNative(FName ActionName, int32 Priority, FInputActionChainFunction Handler);
+
+    /**
+     * Remove a listener from its chain
+     * @param Handle Handle returned by AddActionListener
+     * @return True if the listener was found
+     */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Listener Chains")
+    bool RemoveActionListener(int32 Handle);
+
+    /**
+     * Remove every chain listener bound to an object (e.g. a widget being destroyed)
+     * @param Object Object whose Blueprint handlers should be removed
+     * @return Number of listeners removed
+     */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Listener Chains")
+    int32 RemoveActionListenersForObject(UObject *Object);
+
+    /** Number of chain listeners registered for an action */
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Listener Chains")
+    int32 GetActionListenerCount(FName ActionName) const;
+
+    // ==================== Action State ====================
+
+    /** True between an action's Started and Completed/Canceled events (real or injected) */
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Action State")
+    bool IsActionHeld(FName ActionName) const;
+
+    /** Latest value dispatched for an action (zero if it has not fired) */
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Action State")
+    FInputActionValue GetActionValue(FName ActionName) const;
+
+    // ==================== Action Groups ====================
+    // Every binding belongs to the group named by its Category plus any listed in ActionGroups.
+    // Up to 64 groups per player; a disabled group is one bit in a mask checked on dispatch,
+    // so toggling it rebuilds nothing and leaves the profile untouched.
+
+    /**
+     * Enable or disable every action in a group for this player
+     * Events of a disabled action are dropped on dispatch; a release of an action already held still goes out.
+     * @param bSuppressMappings Also pull the group's key mappings out of the mapping context, so its keys
+     *        reach lower-priority contexts (costs one mapping rebuild; held actions are canceled)
+     * @return False if no applied binding belongs to the group (its Category or ActionGroups)
+     */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Action Groups")
+    bool SetActionGroupEnabled(FName GroupName, bool bEnabled, bool bSuppressMappings = false);
+
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Action Groups")
+    bool IsActionGroupEnabled(FName GroupName) const;
+
+    /** False while any group the action belongs to is disabled */
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Action Groups")
+    bool IsActionEnabled(FName ActionName) const;
+
+    /** Re-enable every group (restores suppressed mappings) */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Action Groups")
+    void EnableAllActionGroups();
+
+    /** Groups seen in applied profiles or toggled so far */
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Action Groups")
+    void GetActionGroups(TArray<FName> &OutGroups) const;
+
     // ==================== UI / Virtual Device Injection ====================
 
     /** Inject an action as STARTED (press down) for this player (local-only). */
@@ -221,6 +437,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "P_MEIS|Injection")
     void InjectAxis2D(const FName &AxisName, const FVector2D &Value);
 
+    /**
+     * Inject any trigger event with an explicit value
+     * Unlike the local-only helpers above this is also accepted on the authority,
+     * so a server can drive a registered controller from replicated input commands.
+     */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Injection")
+    void InjectActionEvent(const FName &ActionName, ETriggerEvent TriggerEvent, const FInputActionValue &Value);
+
     // ==================== Async Action Listener Management (Approach C) ====================
 
     /** Register an async action listener for specific action events */
@@ -479,7 +703,151 @@ public:
     UFUNCTION(BlueprintCallable, Category = "P_MEIS|Factory")
     static UInputTrigger *CreateUInputTrigger(const FS_InputTriggerConfig &TriggerConfig, UObject *Outer, UCPP_EnhancedInputIntegration *Integration = nullptr);
 
+    // ==================== Shared Modifier/Trigger Instances ====================
+    // Identical stateless modifiers/triggers are created once per mapping context and shared
+    // by every mapping and action that uses them. Stateful types are always created fresh.
+
+    /**
+     * Get a modifier for this config, reusing an identical stateless instance when possible
+     * @param ModifierConfig The configuration to use
+     * @return Shared or freshly created modifier, or nullptr if invalid config
+     */
+    UInputModifier *GetOrCreateModifier(const FS_InputModifierConfig &ModifierConfig);
+
+    /**
+     * Get a trigger for this config, reusing an identical stateless instance when possible
+     * @param TriggerConfig The configuration to use
+     * @return Shared or freshly created trigger, or nullptr if invalid config
+     */
+    UInputTrigger *GetOrCreateTrigger(const FS_InputTriggerConfig &TriggerConfig);
+
+    /** Modifier/trigger request and instance counts since the cache was last reset */
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Factory")
+    FS_InputFlyweightStats GetFlyweightStats() const { return FlyweightStats; }
+
+    /** Number of modifier/trigger objects saved by sharing */
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Factory")
+    int32 GetFlyweightInstancesSaved() const { return FlyweightStats.GetInstancesSaved(); }
+
+    // ==================== Action Rates ====================
+    // Every Started event is counted per action and for the whole player in fixed-size
+    // bucketed windows (1s at 100 ms resolution, 10s/60s at 1 s resolution).
+    // Reads are non-const because they retire expired buckets first.
+
+    /**
+     * Get Started-event counts for one action
+     * @param ActionName Name of the action
+     * @return Counts over the trailing 1s / 10s / 60s (all zero if the action never fired)
+     */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Rates")
+    FS_InputActionRates GetActionRates(FName ActionName);
+
+    /** Get Started-event counts across every action of this player */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Rates")
+    FS_InputActionRates GetPlayerRates();
+
+    /** Actions per minute (Started events across all actions in the last 60 seconds) */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Rates")
+    int32 GetActionsPerMinute();
+
+    /** Clear every rate counter (player and per-action) */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Rates")
+    void ResetRateCounters();
+
+    // ==================== Timing Anomaly Detection ====================
+    // Streaming press-interval and hold-duration statistics per action, for flagging
+    // macro/turbo input in ranked play. Also fed by Inject* so a server can run it.
+
+    /** Fires once per newly tripped anomaly flag (flags re-arm when they clear) */
+    UPROPERTY(BlueprintAssignable, Category = "P_MEIS|Timing")
+    FOnInputTimingAnomaly OnTimingAnomaly;
+
+    /** Set detection thresholds; bEnabled turns collection on or off */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Timing")
+    void SetTimingThresholds(const FS_InputTimingThresholds &NewThresholds);
+
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Timing")
+    FS_InputTimingThresholds GetTimingThresholds() const { return TimingThresholds; }
+
+    /**
+     * Get the current timing statistics for an action
+     * @param ActionName Name of the action
+     * @return Report with the currently tripped flags (empty if the action has no samples)
+     */
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Timing")
+    FS_InputTimingReport GetActionTimingReport(FName ActionName) const;
+
+    /** Clear timing statistics for every action */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Timing")
+    void ResetTimingStats();
+
+    // ==================== Late-Latched Look ====================
+    // Low-latency camera look: 2D look actions re-sampled from raw input right before the
+    // camera update (FInputLateLatch). Gameplay events for the action are unchanged; the camera
+    // should read the late value instead of the one delivered during input processing.
+
+    /** Opt a 2D look action in or out of late latching (local players only) */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Late Latch")
+    void SetLateLatchedLook(FName ActionName, bool bEnable);
+
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Late Latch")
+    bool IsLateLatchedLook(FName ActionName) const { return LateLatchedLook.Contains(ActionName); }
+
+    /**
+     * Look value sampled this frame just before the camera update, modifiers applied
+     * Mouse keys give the movement since the previous sample, sticks their latest position.
+     * @return Zero if the action is not late-latched
+     */
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Late Latch")
+    FVector2D GetLateLatchedLookValue(FName ActionName) const;
+
+    /** Fires once per late-latched action per frame, after the value was sampled */
+    UPROPERTY(BlueprintAssignable, Category = "P_MEIS|Late Latch")
+    FOnLateLatchedLook OnLateLatchedLook;
+
+    /** Re-sample every late-latched look action from raw input (called by FInputLateLatch) */
+    void SampleLateLatchedLook(const FInputLateLatch &LateLatch, float DeltaSeconds);
+
+    // ==================== Stick Drift Calibration ====================
+    // While enabled, every gamepad stick mapping gets a UCPP_InputModifierStickCalibration ahead of its
+    // other modifiers, and a binding's fixed DeadZone no longer applies to its stick keys. FInputStickCalibration
+    // estimates each device's resting offset and noise; the modifiers take the values of the device in use.
+
+    /**
+     * Turn calibration on/off and provide the saved per-device calibrations (from the player's profile)
+     * @return True if the on/off state changed; mappings then need a rebuild (the applied profile hash is cleared)
+     */
+    bool SetStickCalibration(bool bEnable, const TArray<FS_DeviceStickCalibration> &Calibrations);
+
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Stick Calibration")
+    bool IsStickCalibrationEnabled() const { return bStickCalibration; }
+
+    /** Calibration in use for a stick (Gamepad_Left2D / Gamepad_Right2D) on the current device */
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Stick Calibration")
+    bool GetStickCalibration(FName Stick, FS_StickCalibration &OutCalibration) const;
+
+    const TArray<FS_DeviceStickCalibration> &GetStickCalibrations() const { return StickCalibrations; }
+
+    /** Device whose calibration the modifiers use (called by FInputStickCalibration when the player's device changes) */
+    void SetStickCalibrationDevice(FName HardwareId);
+
+    /** Store a new estimate for a device's stick and update the modifiers in place (called by FInputStickCalibration) */
+    void UpdateStickCalibration(FName HardwareId, const FS_StickCalibration &Calibration);
+
+    FOnStickCalibrationUpdated OnStickCalibrationUpdated;
+
+    // ==================== Analytics ====================
+
+    /** Action presses/releases are recorded into Analytics while set (null stops recording) */
+    void SetAnalytics(UCPP_InputAnalytics *InAnalytics) { Analytics = InAnalytics; }
+
+    /** Context name that recorded action presses are attributed to (kept current by the context manager) */
+    void SetAnalyticsContext(FName Context) { AnalyticsContext = Context; }
+
 private:
+    /** Dispatches on integrations it creates and discards itself (non-shipping allocation check) */
+    friend class FP_MEIS_HotPathAllocationCheck;
+
     UPROPERTY()
     APlayerController *PlayerController;
 
@@ -494,10 +862,85 @@ private:
     UPROPERTY()
     TMap<FName, UInputAction *> CreatedInputActions;
 
+    /** Names in CreatedInputActions that resolved to authored assets (modifiers go on mappings instead) */
+    TSet<FName> AuthoredActions;
+
+    /** ComputeProfileHash of the profile the mapping context was last built from; reset by every direct mapping edit */
+    uint32 AppliedProfileHash = 0;
+
+    /** Bindings behind AppliedProfileHash, compared when a hash matches */
+    TArray<FS_InputActionBinding> AppliedActionBindings;
+    TArray<FS_InputAxisBinding> AppliedAxisBindings;
+
+    /** String table of the applied profile, used to resolve binding display text keys */
+    FName DisplayStringTable;
+
+    /** Registry of authored Input Action assets (owned by the manager) */
+    UPROPERTY()
+    UCPP_InputActionAssetRegistry *ActionAssetRegistry;
+
+    /** Per-action runtime state (listener chains, rate counters) */
+    TMap<FName, FInputActionDispatchState> ActionDispatchStates;
+
+    /** Started events across all actions */
+    FInputRateCounter PlayerRate;
+
+    FS_InputTimingThresholds TimingThresholds;
+
+    /** Late-latched look actions -> value sampled before this frame's camera update */
+    TMap<FName, FVector2D> LateLatchedLook;
+
+    /** Action group -> bit in FInputActionDispatchState::GroupMask; kept across profile applies */
+    TMap<FName, int32> ActionGroupBits;
+
+    /** Groups whose actions are not dispatched */
+    uint64 DisabledGroupMask = 0;
+
+    /** Disabled groups whose key mappings are also out of the mapping context */
+    uint64 SuppressedGroupMask = 0;
+
+    /** Key mappings pulled out of the mapping context by suppressed groups */
+    UPROPERTY()
+    TArray<FEnhancedActionKeyMapping> SuppressedMappings;
+
+    /** Recorder for action usage; set while the manager is recording analytics */
+    UPROPERTY()
+    UCPP_InputAnalytics *Analytics = nullptr;
+
+    FName AnalyticsContext = TEXT("Gameplay");
+
+    bool bStickCalibration = false;
+
+    /** Calibration modifier per raw stick key and binding dead zone; rebuilt on profile apply, updated in place */
+    UPROPERTY()
+    TArray<UCPP_InputModifierStickCalibration *> StickCalibrationModifiers;
+
+    /** Saved and estimated calibrations per device hardware id */
+    TArray<FS_DeviceStickCalibration> StickCalibrations;
+
+    /** Hardware id of the device the calibration modifiers currently follow */
+    FName CalibrationDevice;
+
+    /** Listener handle -> action it is registered on */
+    TMap<int32, FName> ActionListenerHandles;
+
+    int32 NextActionListenerHandle = 1;
+
+    /** Nesting depth of DispatchActionEvent; chains are only mutated in place at depth 0 */
+    int32 ChainDispatchDepth = 0;
+
+    /** Listeners added mid-dispatch, inserted once dispatch unwinds */
+    TArray<TPair<FName, FInputActionChainListener>> PendingChainAdds;
+
+    /** Group masks for actions that had no dispatch state when a profile was applied mid-dispatch */
+    TArray<TPair<FName, uint64>> PendingGroupMasks;
+
+    /** Set when a listener was flagged bPendingRemove mid-dispatch */
+    bool bChainsNeedCompaction = false;
+
     /** Set of registered async action listeners (Approach C)
-     *  Note: Not a UPROPERTY because UAsyncAction_WaitForInputAction is forward-declared only
      *  These are weak references - async actions manage their own lifetime */
-    TArray<UAsyncAction_WaitForInputAction *> AsyncListeners;
+    TArray<TWeakObjectPtr<UAsyncAction_WaitForInputAction>> AsyncListeners;
 
     /** Track which actions have been bound to avoid duplicate bindings */
     TSet<FName> BoundActions;
@@ -509,6 +952,19 @@ private:
      *  These will be bound when TryBindPendingActions() is called */
     TSet<FName> PendingBindActions;
 
+    /** Every modifier/trigger handed out by GetOrCreate* (keeps shared instances alive) */
+    UPROPERTY()
+    TArray<UObject *> FlyweightInstances;
+
+    /** Stateless instances by full config value (objects owned via FlyweightInstances) */
+    TMap<FS_InputModifierConfig, UInputModifier *> SharedModifiers;
+    TMap<FS_InputTriggerConfig, UInputTrigger *> SharedTriggers;
+
+    FS_InputFlyweightStats FlyweightStats;
+
+    /** Drop all shared instances (chord triggers reference actions that are about to be recreated) */
+    void ResetFlyweightCache();
+
     /** Create or get the mapping context */
     bool EnsureMappingContext();
 
@@ -518,6 +974,40 @@ private:
     /** Internal helper to create modifiers for axis bindings */
     void ApplyAxisModifiers(UInputAction *Action, const FS_InputAxisBinding &AxisBinding);
 
+    /** Collect the binding-wide axis modifiers (dead zone, sensitivity, invert) */
+    void GatherAxisModifiers(const FS_InputAxisBinding &AxisBinding, TArray<UInputModifier *, TInlineAllocator<4>> &OutModifiers);
+
+    /** Bit for a group, assigning the next free one; INDEX_NONE once all 64 are taken (only applied bindings add groups) */
+    int32 FindOrAddActionGroupBit(FName GroupName);
+
+    /** Record the groups of one applied binding in its dispatch state */
+    void AssignActionGroups(FName ActionName, FName Category, const TArray<FName> &Groups);
+
+    /** Move the key mappings of actions in GroupMask out of / back into the mapping context */
+    void SuppressGroupMappings(uint64 GroupMask);
+    void RestoreGroupMappings(uint64 GroupMask);
+
+    /** Action group mask of an Input Action owned by this integration (0 if unknown) */
+    uint64 GetGroupMaskForAction(const UInputAction *Action) const;
+
+    /**
+     * Calibration modifier for a stick key and dead zone (created on first use); null if calibration is off or Key is no stick
+     * Bindings with different dead zones on the same stick get their own instance.
+     */
+    UCPP_InputModifierStickCalibration *GetStickCalibrationModifier(const FKey &Key, float DefaultDeadZone);
+
+    /** True if calibration handles the binding's dead zone (it maps a stick key) */
+    bool IsStickCalibrated(const FS_InputAxisBinding &AxisBinding) const;
+
+    /** Push the current device's calibrations into every calibration modifier */
+    void RefreshStickCalibrationModifiers();
+
+    /**
+     * Queue a control-mapping rebuild for this player if the mapping context is applied
+     * Player input runs deep copies of the context's modifiers, so in-place changes only take effect after a rebuild.
+     */
+    void RequestMappingRebuild();
+
     /** Find a key mapping in the mapping context for a given action and key */
     FEnhancedActionKeyMapping *FindKeyMapping(const FName &ActionName, const FKey &Key);
 
@@ -543,6 +1033,27 @@ private:
     void OnActionCompletedInternal(const FInputActionInstance &ActionInstance, FName ActionName);
     void OnActionCanceledInternal(const FInputActionInstance &ActionInstance, FName ActionName);
 
+    /**
+     * Route one action event: listener chain first (may consume), then global dispatchers and async listeners
+     * All enhanced input events and injected events go through here
+     */
+    void DispatchActionEvent(FName ActionName, ETriggerEvent TriggerEvent, const FInputActionValue &Value);
+
+    /** Feed a press/release into an action's timing tracker and broadcast newly tripped anomalies */
+    void RecordActionTiming(FName ActionName, FInputTimingTracker &Timing, bool bPress, double TimeSeconds);
+
+    /** Run the chain for an action; returns true if a listener consumed the event */
+    bool RunListenerChain(const FInputActionDispatchState &State, FName ActionName, ETriggerEvent TriggerEvent, const FInputActionValue &Value) const;
+
+    /** Assign a handle and insert into the sorted chain (deferred while dispatching) */
+    int32 AddChainListener(FName ActionName, FInputActionChainListener &&Listener);
+
+    /** Insert into the sorted chain immediately */
+    void InsertChainListener(FName ActionName, FInputActionChainListener &&Listener);
+
+    /** Apply deferred adds/removals once no dispatch is walking any chain */
+    void FlushPendingChainChanges();
+
     /** Notify all async listeners about an action event */
     void NotifyAsyncListeners(FName ActionName, ETriggerEvent TriggerEvent, const FInputActionValue &Value);
 };
@@ -0,0 +1,114 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Action Asset Registry Implementation
+ * @Date: 19/10/2026
+ */
+
+#include "Integration/CPP_InputActionAssetRegistry.h"
+
+void UCPP_InputActionAssetRegistry::LoadAssetsAsync()
+{
+    TArray<FSoftObjectPath> PendingPaths;
+    for (const TSoftObjectPtr<UInputAction> &Asset : ActionAssets)
+    {
+        if (!Asset.IsNull() && !Asset.IsValid())
+        {
+            PendingPaths.AddUnique(Asset.ToSoftObjectPath());
+        }
+    }
+
+    // Anything already in memory is usable right away
+    ResolveLoadedAssets();
+
+    if (PendingPaths.Num() == 0)
+    {
+        OnAssetsResolved.Broadcast();
+        return;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("P_MEIS: Loading %d Input Action assets"), PendingPaths.Num());
+    LoadHandle = StreamableManager.RequestAsyncLoad(PendingPaths, FStreamableDelegate::CreateUObject(this, &UCPP_InputActionAssetRegistry::HandleAssetsLoaded));
+}
+
+void UCPP_InputActionAssetRegistry::RegisterActionAsset(const TSoftObjectPtr<UInputAction> &Asset)
+{
+    if (Asset.IsNull())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: RegisterActionAsset called with a null asset"));
+        return;
+    }
+
+    ActionAssets.AddUnique(Asset);
+
+    if (Asset.IsValid())
+    {
+        ResolveLoadedAssets();
+        OnAssetsResolved.Broadcast();
+        return;
+    }
+
+    StreamableManager.RequestAsyncLoad(Asset.ToSoftObjectPath(), FStreamableDelegate::CreateUObject(this, &UCPP_InputActionAssetRegistry::HandleAssetsLoaded));
+}
+
+UInputAction *UCPP_InputActionAssetRegistry::FindActionAsset(const FName &ActionName) const
+{
+    if (ActionName.IsNone() || ResolvedActions.Num() == 0)
+    {
+        return nullptr;
+    }
+
+    if (UInputAction *const *Found = ResolvedActions.Find(ActionName))
+    {
+        return *Found;
+    }
+
+    if (UInputAction *const *Found = ResolvedActions.Find(FName(*FString::Printf(TEXT("IA_%s"), *ActionName.ToString()))))
+    {
+        return *Found;
+    }
+
+    return nullptr;
+}
+
+void UCPP_InputActionAssetRegistry::ReleaseAssets()
+{
+    if (LoadHandle.IsValid())
+    {
+        LoadHandle->CancelHandle();
+        LoadHandle.Reset();
+    }
+
+    OnAssetsResolved.Clear();
+    ResolvedActions.Empty();
+}
+
+void UCPP_InputActionAssetRegistry::ResolveLoadedAssets()
+{
+    for (const TSoftObjectPtr<UInputAction> &Asset : ActionAssets)
+    {
+        UInputAction *Action = Asset.Get();
+        if (!Action)
+        {
+            continue;
+        }
+
+        const FName AssetName = Action->GetFName();
+        UInputAction *&Slot = ResolvedActions.FindOrAdd(AssetName);
+        if (Slot && Slot != Action)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Input Action asset name '%s' is used by more than one asset, keeping %s"),
+                   *AssetName.ToString(), *GetPathNameSafe(Slot));
+            continue;
+        }
+        Slot = Action;
+    }
+}
+
+void UCPP_InputActionAssetRegistry::HandleAssetsLoaded()
+{
+    const int32 PreviousCount = ResolvedActions.Num();
+    ResolveLoadedAssets();
+
+    UE_LOG(LogTemp, Log, TEXT("P_MEIS: Resolved %d Input Action assets (%d new)"), ResolvedActions.Num(), ResolvedActions.Num() - PreviousCount);
+    OnAssetsResolved.Broadcast();
+}
@@ -0,0 +1,85 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Action Asset Registry - Resolves authored UInputAction assets by name
+ *               so profiles bind to existing assets instead of creating transient actions
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputAction.h"
+#include "Engine/StreamableManager.h"
+#include "CPP_InputActionAssetRegistry.generated.h"
+
+DECLARE_MULTICAST_DELEGATE(FOnInputActionAssetsResolved);
+
+/**
+ * Registry of authored Input Action assets
+ *
+ * Assets are listed as soft references (project config or at runtime) and loaded
+ * asynchronously. Once resolved, UCPP_EnhancedInputIntegration::CreateInputAction
+ * returns the authored asset whenever a binding name matches, so every player shares
+ * the same UInputAction and existing BindAction code on pawns keeps working.
+ *
+ * A binding name matches an asset named exactly the same, or the same name with the
+ * "IA_" prefix (binding "Jump" -> asset "IA_Jump").
+ *
+ * Config (DefaultGame.ini):
+ * [/Script/P_MEIS.CPP_InputActionAssetRegistry]
+ * +ActionAssets=/Game/Input/Actions/IA_Jump.IA_Jump
+ */
+UCLASS(Config = Game, BlueprintType)
+class P_MEIS_API UCPP_InputActionAssetRegistry : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /** Authored Input Action assets to bind profiles to */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Input Binding|Assets")
+    TArray<TSoftObjectPtr<UInputAction>> ActionAssets;
+
+    /** Broadcast on the game thread each time a batch of assets finishes loading */
+    FOnInputActionAssetsResolved OnAssetsResolved;
+
+    /** Start loading every asset in ActionAssets (already loaded assets resolve immediately) */
+    void LoadAssetsAsync();
+
+    /**
+     * Add an authored asset at runtime
+     * @param Asset Soft reference to the Input Action asset
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Assets")
+    void RegisterActionAsset(const TSoftObjectPtr<UInputAction> &Asset);
+
+    /**
+     * Find the authored asset for a binding name
+     * @param ActionName Name used by the profile binding
+     * @return The resolved asset, or nullptr if none matches (or it is not loaded yet)
+     */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Assets")
+    UInputAction *FindActionAsset(const FName &ActionName) const;
+
+    /** True once no asset load is in flight */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Assets")
+    bool IsResolved() const { return !LoadHandle.IsValid() || LoadHandle->HasLoadCompleted(); }
+
+    /** Number of assets currently resolved */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Assets")
+    int32 GetResolvedCount() const { return ResolvedActions.Num(); }
+
+    /** Drop resolved assets and cancel any pending load */
+    void ReleaseAssets();
+
+private:
+    /** Asset name -> loaded asset (keeps authored assets alive while registered) */
+    UPROPERTY()
+    TMap<FName, UInputAction *> ResolvedActions;
+
+    FStreamableManager StreamableManager;
+    TSharedPtr<FStreamableHandle> LoadHandle;
+
+    /** Move every loaded soft reference into ResolvedActions */
+    void ResolveLoadedAssets();
+    void HandleAssetsLoaded();
+};
@@ -0,0 +1,41 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Stick Calibration Modifier Implementation
+ * @Date: 19/10/2026
+ */
+
+#include "Integration/CPP_InputModifierStickCalibration.h"
+
+void UCPP_InputModifierStickCalibration::SetCalibration(const FS_StickCalibration *Calibration)
+{
+    CenterOffset = Calibration ? Calibration->CenterOffset : FVector2D::ZeroVector;
+    DeadZone = FMath::Clamp(Calibration ? Calibration->DeadZone : DefaultDeadZone, 0.0f, 0.95f);
+}
+
+FInputActionValue UCPP_InputModifierStickCalibration::ModifyRaw_Implementation(const UEnhancedPlayerInput *PlayerInput, FInputActionValue CurrentValue, float DeltaTime)
+{
+    const EInputActionValueType ValueType = CurrentValue.GetValueType();
+    if (ValueType == EInputActionValueType::Boolean)
+    {
+        return CurrentValue;
+    }
+
+    const float Range = 1.0f - DeadZone;
+    FVector Value = CurrentValue.Get<FVector>();
+
+    // A 1D key fills only X whatever the action type, and an Axis1D action drops a 2D key's Y
+    if (!bStick2D || ValueType == EInputActionValueType::Axis1D)
+    {
+        const float Centered = Value.X - (bYAxis ? CenterOffset.Y : CenterOffset.X);
+        const float Magnitude = FMath::Abs(Centered);
+        Value.X = Magnitude <= DeadZone ? 0.0f : FMath::Sign(Centered) * FMath::Min((Magnitude - DeadZone) / Range, 1.0f);
+        return FInputActionValue(ValueType, Value);
+    }
+
+    FVector2D Centered(Value.X - CenterOffset.X, Value.Y - CenterOffset.Y);
+    const float Magnitude = Centered.Size();
+    Centered = Magnitude <= DeadZone ? FVector2D::ZeroVector : Centered * (FMath::Min((Magnitude - DeadZone) / Range, 1.0f) / Magnitude);
+    Value.X = Centered.X;
+    Value.Y = Centered.Y;
+    return FInputActionValue(ValueType, Value);
+}
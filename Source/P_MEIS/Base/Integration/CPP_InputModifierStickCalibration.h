@@ -0,0 +1,59 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Stick Calibration Modifier - Removes a stick's resting offset, then applies its calibrated dead zone
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputModifiers.h"
+#include "InputBinding/FS_StickCalibration.h"
+#include "CPP_InputModifierStickCalibration.generated.h"
+
+/**
+ * Mapping modifier for a raw gamepad stick key, kept up to date in place by FInputStickCalibration
+ * (the owning integration then requests a mapping rebuild so the player input's copies pick it up)
+ *
+ * One instance per stick key and binding dead zone per player; it runs before every other mapping modifier so it sees the
+ * raw reading. 2D keys use a radial dead zone, 1D keys (X or Y of a stick) an axial one; the range
+ * outside the dead zone is rescaled to 0..1.
+ */
+UCLASS(NotBlueprintable, meta = (DisplayName = "P_MEIS Stick Calibration"))
+class P_MEIS_API UCPP_InputModifierStickCalibration : public UInputModifier
+{
+    GENERATED_BODY()
+
+public:
+    /** Resting position of the stick */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+    FVector2D CenterOffset = FVector2D::ZeroVector;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", meta = (ClampMin = "0", ClampMax = "0.95"))
+    float DeadZone = 0.2f;
+
+    /** Dead zone while the device has no calibration (the binding's DeadZone) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", meta = (ClampMin = "0", ClampMax = "0.95"))
+    float DefaultDeadZone = 0.2f;
+
+    /** Raw stick key this instance is mapped to */
+    UPROPERTY(VisibleAnywhere, Category = "Settings")
+    FKey StickKey;
+
+    /**
+     * Key is a 2D stick key (Gamepad_Left2D / Gamepad_Right2D)
+     * Set from the key, not the action: a 1D key mapped to an Axis2D action still only carries X.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+    bool bStick2D = true;
+
+    /** 1D key that reads the stick's Y axis (offset Y applies instead of X) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+    bool bYAxis = false;
+
+    /** Take values from a calibration, or fall back to no offset and DefaultDeadZone when null */
+    void SetCalibration(const FS_StickCalibration *Calibration);
+
+protected:
+    virtual FInputActionValue ModifyRaw_Implementation(const UEnhancedPlayerInput *PlayerInput, FInputActionValue CurrentValue, float DeltaTime) override;
+};
@@ -0,0 +1,205 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Key Partition Router Implementation
+ * @Date: 19/10/2026
+ */
+
+#include "Integration/InputKeyPartitionRouter.h"
+#include "Framework/Application/IInputProcessor.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GameFramework/PlayerController.h"
+#include "GenericPlatform/GenericPlatformInputDeviceMapper.h"
+#include "Engine/LocalPlayer.h"
+
+/**
+ * Slate pre-processor holding the key -> owner table
+ * Lookups are one hash probe per key event; releases follow the player that received the press.
+ */
+class FKeyPartitionInputProcessor : public IInputProcessor
+{
+public:
+    TMap<FKey, TWeakObjectPtr<APlayerController>> KeyOwners;
+
+    /** Keys currently held on a non-keyboard player, so the release goes to the same player after a rebuild */
+    TMap<FKey, TWeakObjectPtr<APlayerController>> RoutedDownKeys;
+
+    virtual void Tick(const float DeltaTime, FSlateApplication &SlateApp, TSharedRef<ICursor> Cursor) override
+    {
+    }
+
+    virtual bool HandleKeyDownEvent(FSlateApplication &SlateApp, const FKeyEvent &InKeyEvent) override
+    {
+        const TWeakObjectPtr<APlayerController> *Owner = KeyOwners.Find(InKeyEvent.GetKey());
+        if (!Owner)
+        {
+            return false;
+        }
+
+        APlayerController *PlayerController = Owner->Get();
+        if (!ShouldReroute(PlayerController, InKeyEvent))
+        {
+            return false;
+        }
+
+        RoutedDownKeys.Add(InKeyEvent.GetKey(), PlayerController);
+        FeedKey(PlayerController, InKeyEvent.GetKey(), InKeyEvent.IsRepeat() ? IE_Repeat : IE_Pressed);
+        return true;
+    }
+
+    virtual bool HandleKeyUpEvent(FSlateApplication &SlateApp, const FKeyEvent &InKeyEvent) override
+    {
+        TWeakObjectPtr<APlayerController> Owner;
+        if (!RoutedDownKeys.RemoveAndCopyValue(InKeyEvent.GetKey(), Owner))
+        {
+            return false;
+        }
+
+        if (APlayerController *PlayerController = Owner.Get())
+        {
+            FeedKey(PlayerController, InKeyEvent.GetKey(), IE_Released);
+        }
+        return true;
+    }
+
+    virtual const TCHAR *GetDebugName() const override { return TEXT("P_MEIS_KeyPartitionRouter"); }
+
+private:
+    /** The keyboard already reaches the local player whose controller id matches the event's user */
+    static bool ShouldReroute(APlayerController *PlayerController, const FKeyEvent &InKeyEvent)
+    {
+        const ULocalPlayer *LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+        return LocalPlayer && LocalPlayer->GetControllerId() != static_cast<int32>(InKeyEvent.GetUserIndex());
+    }
+
+    static void FeedKey(APlayerController *PlayerController, const FKey &Key, EInputEvent Event)
+    {
+        const ULocalPlayer *LocalPlayer = PlayerController->GetLocalPlayer();
+        const FInputDeviceId DeviceId = IPlatformInputDeviceMapper::Get().GetPrimaryInputDeviceForUser(LocalPlayer->GetPlatformUserId());
+        PlayerController->InputKey(FInputKeyParams(Key, Event, Event == IE_Released ? 0.0 : 1.0, false, DeviceId));
+    }
+};
+
+FInputKeyPartitionRouter::FInputKeyPartitionRouter()
+    : Processor(MakeShared<FKeyPartitionInputProcessor>())
+{
+}
+
+FInputKeyPartitionRouter::~FInputKeyPartitionRouter()
+{
+    Disable();
+}
+
+bool FInputKeyPartitionRouter::Build(const TArray<FInputKeyPartition> &Partitions, TArray<FString> &OutConflicts)
+{
+    OutConflicts.Reset();
+
+    TMap<FKey, TWeakObjectPtr<APlayerController>> NewOwners;
+    TArray<FKey> Keys;
+    for (const FInputKeyPartition &Partition : Partitions)
+    {
+        if (!Partition.Player || !Partition.Profile)
+        {
+            continue;
+        }
+
+        GetKeyboardKeys(*Partition.Profile, Keys);
+        for (const FKey &Key : Keys)
+        {
+            TWeakObjectPtr<APlayerController> &Owner = NewOwners.FindOrAdd(Key);
+            if (!Owner.IsValid())
+            {
+                Owner = Partition.Player;
+            }
+            else if (Owner.Get() != Partition.Player)
+            {
+                OutConflicts.Add(FString::Printf(TEXT("Key '%s' is bound by both %s and %s"),
+                                                 *Key.GetDisplayName().ToString(), *Owner->GetName(), *Partition.Player->GetName()));
+            }
+        }
+    }
+
+    if (OutConflicts.Num() > 0)
+    {
+        for (const FString &Conflict : OutConflicts)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Shared keyboard partition overlap - %s"), *Conflict);
+        }
+        return false;
+    }
+
+    Processor->KeyOwners = MoveTemp(NewOwners);
+    return true;
+}
+
+void FInputKeyPartitionRouter::Enable()
+{
+    if (bEnabled || !FSlateApplication::IsInitialized())
+    {
+        return;
+    }
+
+    FSlateApplication::Get().RegisterInputPreProcessor(Processor, 0);
+    bEnabled = true;
+}
+
+void FInputKeyPartitionRouter::Disable()
+{
+    if (!bEnabled)
+    {
+        return;
+    }
+
+    if (FSlateApplication::IsInitialized())
+    {
+        FSlateApplication::Get().UnregisterInputPreProcessor(Processor);
+    }
+    Processor->RoutedDownKeys.Reset();
+    bEnabled = false;
+}
+
+void FInputKeyPartitionRouter::Reset()
+{
+    Disable();
+    Processor->KeyOwners.Reset();
+}
+
+APlayerController *FInputKeyPartitionRouter::GetKeyOwner(const FKey &Key) const
+{
+    const TWeakObjectPtr<APlayerController> *Owner = Processor->KeyOwners.Find(Key);
+    return Owner ? Owner->Get() : nullptr;
+}
+
+int32 FInputKeyPartitionRouter::GetOwnedKeyCount() const
+{
+    return Processor->KeyOwners.Num();
+}
+
+void FInputKeyPartitionRouter::GetKeyboardKeys(const FS_InputProfile &Profile, TArray<FKey> &OutKeys)
+{
+    OutKeys.Reset();
+
+    // Keyboard keys are digital; analog keys cover mouse movement and wheel axes, which are no mouse buttons
+    auto AddKey = [&OutKeys](const FKey &Key)
+    {
+        if (Key.IsValid() && !Key.IsGamepadKey() && !Key.IsMouseButton() && !Key.IsTouch() && !Key.IsGesture() && !Key.IsAnalog())
+        {
+            OutKeys.AddUnique(Key);
+        }
+    };
+
+    for (const FS_InputActionBinding &Binding : Profile.ActionBindings)
+    {
+        for (const FS_KeyBinding &KeyBinding : Binding.KeyBindings)
+        {
+            AddKey(KeyBinding.Key);
+        }
+    }
+
+    for (const FS_InputAxisBinding &Binding : Profile.AxisBindings)
+    {
+        for (const FS_AxisKeyBinding &KeyBinding : Binding.AxisBindings)
+        {
+            AddKey(KeyBinding.Key);
+        }
+    }
+}
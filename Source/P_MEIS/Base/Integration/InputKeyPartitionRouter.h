@@ -0,0 +1,74 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Key Partition Router - Splits one shared keyboard between local players by key ownership
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputCoreTypes.h"
+#include "InputBinding/FS_InputProfile.h"
+
+class APlayerController;
+class FKeyPartitionInputProcessor;
+
+/**
+ * One player's claim on the shared keyboard: every keyboard key in their profile
+ */
+struct FInputKeyPartition
+{
+    APlayerController *Player = nullptr;
+    const FS_InputProfile *Profile = nullptr;
+};
+
+/**
+ * Routes keyboard keys to the player that owns them
+ *
+ * The keyboard only ever feeds the local player it belongs to (normally player 1). The router
+ * owns a key -> player table built from each player's profile and registers a Slate input
+ * pre-processor: an owned key whose owner is not the keyboard's player is consumed and fed to
+ * the owner's PlayerController, so it is mapped by that player's own IMC. Keys nobody owns and
+ * keys owned by the keyboard's player pass through untouched; mappings are never duplicated.
+ *
+ * Modifier keys (Shift/Ctrl/Alt/Cmd) stay with the keyboard's player unless a profile binds them directly.
+ */
+class P_MEIS_API FInputKeyPartitionRouter
+{
+public:
+    FInputKeyPartitionRouter();
+    ~FInputKeyPartitionRouter();
+
+    /**
+     * Build the owner table from each partition's keyboard keys
+     * The previous table is kept if any key is claimed by more than one player.
+     * @param Partitions One entry per player sharing the keyboard
+     * @param OutConflicts One message per key claimed by more than one player
+     * @return True if the partitions are disjoint and the table was replaced
+     */
+    bool Build(const TArray<FInputKeyPartition> &Partitions, TArray<FString> &OutConflicts);
+
+    /** Register the input pre-processor (no-op without Slate, e.g. dedicated server) */
+    void Enable();
+
+    /** Unregister the input pre-processor; the owner table is kept */
+    void Disable();
+
+    bool IsEnabled() const { return bEnabled; }
+
+    /** Drop the owner table and unregister */
+    void Reset();
+
+    /** Player owning Key, or nullptr if Key is not partitioned */
+    APlayerController *GetKeyOwner(const FKey &Key) const;
+
+    /** Number of keyboard keys in the owner table */
+    int32 GetOwnedKeyCount() const;
+
+    /** Keys in a profile that come from the keyboard (gamepad, mouse buttons and axes, touch and gesture keys are never partitioned) */
+    static void GetKeyboardKeys(const FS_InputProfile &Profile, TArray<FKey> &OutKeys);
+
+private:
+    TSharedPtr<FKeyPartitionInputProcessor> Processor;
+    bool bEnabled = false;
+};
@@ -0,0 +1,374 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Late Latch Implementation
+ * @Date: 19/10/2026
+ */
+
+#include "Integration/InputLateLatch.h"
+#include "Integration/CPP_EnhancedInputIntegration.h"
+#include "Framework/Application/IInputProcessor.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "GenericPlatform/GenericApplication.h"
+#include "GenericPlatform/GenericApplicationMessageHandler.h"
+#include "Misc/CoreDelegates.h"
+#include "CoreGlobals.h"
+
+/**
+ * Slate pre-processor accumulating raw look input per user (never consumes events)
+ */
+class FLateLatchInputProcessor : public IInputProcessor
+{
+public:
+    struct FUserInput
+    {
+        /** Cursor delta since the last sample (Slate space, Y down) */
+        FVector2D MouseDelta = FVector2D::ZeroVector;
+
+        /** Latest value of every analog key seen */
+        TMap<FKey, float> AxisValues;
+    };
+
+    TMap<int32, FUserInput> Users;
+
+    /** Set between a world's pre- and post-actor tick, when events arrive too late for the normal path */
+    bool bInLateWindow = false;
+    int32 LateEvents = 0;
+
+    virtual void Tick(const float DeltaTime, FSlateApplication &SlateApp, TSharedRef<ICursor> Cursor) override
+    {
+    }
+
+    virtual bool HandleMouseMoveEvent(FSlateApplication &SlateApp, const FPointerEvent &MouseEvent) override
+    {
+        Users.FindOrAdd(MouseEvent.GetUserIndex()).MouseDelta += MouseEvent.GetCursorDelta();
+        LateEvents += bInLateWindow ? 1 : 0;
+        return false;
+    }
+
+    virtual bool HandleAnalogInputEvent(FSlateApplication &SlateApp, const FAnalogInputEvent &InAnalogInputEvent) override
+    {
+        Users.FindOrAdd(InAnalogInputEvent.GetUserIndex()).AxisValues.Add(InAnalogInputEvent.GetKey(), InAnalogInputEvent.GetAnalogValue());
+        LateEvents += bInLateWindow ? 1 : 0;
+        return false;
+    }
+
+    virtual const TCHAR *GetDebugName() const override { return TEXT("P_MEIS_LateLatch"); }
+
+    void RecordAnalog(int32 UserIndex, const FKey &Key, float Value)
+    {
+        Users.FindOrAdd(UserIndex).AxisValues.Add(Key, Value);
+        ++LateEvents;
+    }
+
+    /** Deltas restart from zero after every sample; analog values are state and are kept */
+    void EndSample()
+    {
+        for (TPair<int32, FUserInput> &User : Users)
+        {
+            User.Value.MouseDelta = FVector2D::ZeroVector;
+        }
+        bInLateWindow = false;
+    }
+};
+
+/**
+ * Message handler swapped in for the late device poll
+ *
+ * Pad events from that poll only update the late sample; they are held back and replayed into the real
+ * handler at the start of the next frame, which is when the normal poll would have delivered them.
+ * Nothing reaches Slate, the viewport or gameplay input in the middle of the world tick.
+ */
+class FLateLatchDeviceCapture : public FGenericApplicationMessageHandler
+{
+public:
+    struct FControllerEvent
+    {
+        enum class EType : uint8
+        {
+            Analog,
+            Pressed,
+            Released
+        };
+
+        EType Type = EType::Analog;
+        FGamepadKeyNames::Type KeyName;
+        FPlatformUserId PlatformUserId;
+        FInputDeviceId InputDeviceId;
+        float AnalogValue = 0.0f;
+        bool bIsRepeat = false;
+    };
+
+    /** Handler the platform application had before the swap */
+    TSharedPtr<FGenericApplicationMessageHandler> Target;
+    TSharedPtr<FLateLatchInputProcessor> Processor;
+    TArray<FControllerEvent> Deferred;
+
+    virtual bool OnControllerAnalog(FGamepadKeyNames::Type KeyName, FPlatformUserId PlatformUserId, FInputDeviceId InputDeviceId, float AnalogValue) override
+    {
+        const TOptional<int32> UserIndex = FSlateApplication::Get().GetUserIndexForInputDevice(InputDeviceId);
+        if (UserIndex.IsSet())
+        {
+            Processor->RecordAnalog(UserIndex.GetValue(), FKey(KeyName), AnalogValue);
+        }
+        Deferred.Add({FControllerEvent::EType::Analog, KeyName, PlatformUserId, InputDeviceId, AnalogValue, false});
+        return true;
+    }
+
+    virtual bool OnControllerButtonPressed(FGamepadKeyNames::Type KeyName, FPlatformUserId PlatformUserId, FInputDeviceId InputDeviceId, bool IsRepeat) override
+    {
+        Deferred.Add({FControllerEvent::EType::Pressed, KeyName, PlatformUserId, InputDeviceId, 0.0f, IsRepeat});
+        return true;
+    }
+
+    virtual bool OnControllerButtonReleased(FGamepadKeyNames::Type KeyName, FPlatformUserId PlatformUserId, FInputDeviceId InputDeviceId, bool IsRepeat) override
+    {
+        Deferred.Add({FControllerEvent::EType::Released, KeyName, PlatformUserId, InputDeviceId, 0.0f, IsRepeat});
+        return true;
+    }
+
+    virtual bool OnMotionDetected(const FVector &Tilt, const FVector &RotationRate, const FVector &Gravity, const FVector &Acceleration, FPlatformUserId PlatformUserId, FInputDeviceId InputDeviceId) override
+    {
+        // Motion is a continuous state stream and not look input; pass it straight on
+        return Target.IsValid() && Target->OnMotionDetected(Tilt, RotationRate, Gravity, Acceleration, PlatformUserId, InputDeviceId);
+    }
+
+    void Replay()
+    {
+        if (Target.IsValid())
+        {
+            for (const FControllerEvent &Event : Deferred)
+            {
+                switch (Event.Type)
+                {
+                case FControllerEvent::EType::Analog:
+                    Target->OnControllerAnalog(Event.KeyName, Event.PlatformUserId, Event.InputDeviceId, Event.AnalogValue);
+                    break;
+                case FControllerEvent::EType::Pressed:
+                    Target->OnControllerButtonPressed(Event.KeyName, Event.PlatformUserId, Event.InputDeviceId, Event.bIsRepeat);
+                    break;
+                case FControllerEvent::EType::Released:
+                    Target->OnControllerButtonReleased(Event.KeyName, Event.PlatformUserId, Event.InputDeviceId, Event.bIsRepeat);
+                    break;
+                }
+            }
+        }
+        Deferred.Reset();
+
+        // Not kept between frames: the static late latch must not hold Slate alive past its shutdown
+        Target.Reset();
+    }
+};
+
+FInputLateLatch &FInputLateLatch::Get()
+{
+    static FInputLateLatch LateLatch;
+    return LateLatch;
+}
+
+FInputLateLatch::FInputLateLatch()
+    : Processor(MakeShared<FLateLatchInputProcessor>()), DeviceCapture(MakeShared<FLateLatchDeviceCapture>())
+{
+    DeviceCapture->Processor = Processor;
+}
+
+void FInputLateLatch::Register(UCPP_EnhancedInputIntegration *Integration)
+{
+    if (!Integration)
+    {
+        return;
+    }
+
+    Integrations.AddUnique(Integration);
+    Enable();
+}
+
+void FInputLateLatch::Unregister(UCPP_EnhancedInputIntegration *Integration)
+{
+    Integrations.RemoveAll([Integration](const TWeakObjectPtr<UCPP_EnhancedInputIntegration> &Entry)
+                           { return !Entry.IsValid() || Entry.Get() == Integration; });
+    if (Integrations.Num() == 0)
+    {
+        Disable();
+    }
+}
+
+void FInputLateLatch::Enable()
+{
+    if (bEnabled || !FSlateApplication::IsInitialized())
+    {
+        return;
+    }
+
+    FSlateApplication::Get().RegisterInputPreProcessor(Processor);
+    PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddRaw(this, &FInputLateLatch::HandlePreActorTick);
+    PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddRaw(this, &FInputLateLatch::HandlePostActorTick);
+    BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddRaw(this, &FInputLateLatch::HandleBeginFrame);
+    bEnabled = true;
+}
+
+void FInputLateLatch::Disable()
+{
+    if (!bEnabled)
+    {
+        return;
+    }
+
+    if (FSlateApplication::IsInitialized())
+    {
+        FSlateApplication::Get().UnregisterInputPreProcessor(Processor);
+    }
+    FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+    FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+    FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+
+    // Held-back pad events still belong to the normal path
+    DeviceCapture->Replay();
+    Processor->Users.Reset();
+    Processor->bInLateWindow = false;
+    bEnabled = false;
+}
+
+FVector2D FInputLateLatch::GetKeyValue(int32 UserIndex, const FKey &Key) const
+{
+    const FLateLatchInputProcessor::FUserInput *User = Processor->Users.Find(UserIndex);
+    if (!User)
+    {
+        return FVector2D::ZeroVector;
+    }
+
+    // Slate's cursor delta is Y down; the viewport feeds MouseY inverted, so match it
+    if (Key == EKeys::Mouse2D)
+    {
+        return FVector2D(User->MouseDelta.X, -User->MouseDelta.Y);
+    }
+    if (Key == EKeys::MouseX)
+    {
+        return FVector2D(User->MouseDelta.X, 0.0);
+    }
+    if (Key == EKeys::MouseY)
+    {
+        return FVector2D(-User->MouseDelta.Y, 0.0);
+    }
+
+    if (Key.IsAxis2D())
+    {
+        FVector2D Value = FVector2D::ZeroVector;
+        for (const TPair<FKey, float> &Axis : User->AxisValues)
+        {
+            if (Axis.Key.GetPairedAxisKey() == Key)
+            {
+                (Axis.Key.GetPairedAxis() == EPairedAxis::Y ? Value.Y : Value.X) = Axis.Value;
+            }
+        }
+        return Value;
+    }
+
+    const float *Value = User->AxisValues.Find(Key);
+    return FVector2D(Value ? *Value : 0.0f, 0.0);
+}
+
+void FInputLateLatch::HandlePreActorTick(UWorld *World, ELevelTick TickType, float DeltaSeconds)
+{
+    // Slate has already routed this frame's input; anything from here on is picked up late
+    if (World && World->IsGameWorld())
+    {
+        Processor->bInLateWindow = true;
+    }
+}
+
+void FInputLateLatch::HandlePostActorTick(UWorld *World, ELevelTick TickType, float DeltaSeconds)
+{
+    if (!World || !World->IsGameWorld())
+    {
+        return;
+    }
+
+    bool bSampled = false;
+    for (int32 Index = Integrations.Num() - 1; Index >= 0; --Index)
+    {
+        UCPP_EnhancedInputIntegration *Integration = Integrations[Index].Get();
+        if (!Integration)
+        {
+            Integrations.RemoveAtSwap(Index);
+            continue;
+        }
+
+        const APlayerController *PlayerController = Cast<APlayerController>(Integration->GetController());
+        if (PlayerController && PlayerController->GetWorld() == World)
+        {
+            if (bResampleDevices && LastPollFrame != GFrameCounter)
+            {
+                LastPollFrame = GFrameCounter;
+                PollDevices();
+            }
+
+            Integration->SampleLateLatchedLook(*this, DeltaSeconds);
+            bSampled = true;
+        }
+    }
+
+    if (bSampled)
+    {
+        ++Stats.Samples;
+        Stats.LateEvents += Processor->LateEvents;
+        Processor->LateEvents = 0;
+        Processor->EndSample();
+    }
+
+    if (Integrations.Num() == 0)
+    {
+        Disable();
+    }
+}
+
+void FInputLateLatch::PollDevices()
+{
+    if (!FSlateApplication::IsInitialized())
+    {
+        return;
+    }
+
+    const TSharedPtr<GenericApplication> PlatformApplication = FSlateApplication::Get().GetPlatformApplication();
+    if (!PlatformApplication.IsValid())
+    {
+        return;
+    }
+
+    // Device state only, no message pump; the capture keeps the poll's events out of Slate until next frame
+    const TSharedRef<FGenericApplicationMessageHandler> MessageHandler = PlatformApplication->GetMessageHandler();
+    DeviceCapture->Target = MessageHandler;
+    PlatformApplication->SetMessageHandler(DeviceCapture.ToSharedRef());
+    PlatformApplication->PollGameDeviceState(FSlateApplication::Get().GetDeltaTime());
+    PlatformApplication->SetMessageHandler(MessageHandler);
+}
+
+void FInputLateLatch::HandleBeginFrame()
+{
+    // Before this frame's own poll and input routing, i.e. when the normal path would have seen them
+    DeviceCapture->Replay();
+}
+
+// ==================== Console ====================
+
+static void LateLatchStats(const TArray<FString> &Args)
+{
+    FInputLateLatch &LateLatch = FInputLateLatch::Get();
+    if (Args.Num() > 0)
+    {
+        LateLatch.SetResampleDevices(FCString::Atoi(*Args[0]) != 0);
+        LateLatch.ResetStats();
+    }
+
+    const FInputLateLatchStats &Stats = LateLatch.GetStats();
+    UE_LOG(LogTemp, Log, TEXT("P_MEIS: Late latch - resample %s, %d samples, %d late events (%.2f per sample)"),
+           LateLatch.GetResampleDevices() ? TEXT("on") : TEXT("off"), Stats.Samples, Stats.LateEvents,
+           Stats.Samples > 0 ? static_cast<float>(Stats.LateEvents) / Stats.Samples : 0.0f);
+}
+
+static FAutoConsoleCommand LateLatchStatsCommand(
+    TEXT("p_meis.LateLatch"),
+    TEXT("Report late-latch counters; with an argument (0/1) also turns device re-sampling off/on and resets them, for latency A/B runs"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&LateLatchStats));
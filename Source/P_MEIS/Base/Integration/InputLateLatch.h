@@ -0,0 +1,97 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Late Latch - Re-samples raw look input right before the camera update
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputCoreTypes.h"
+#include "Engine/EngineBaseTypes.h"
+
+class UWorld;
+class UCPP_EnhancedInputIntegration;
+class FLateLatchInputProcessor;
+class FLateLatchDeviceCapture;
+
+/**
+ * Counters for the late-latch path
+ */
+struct FInputLateLatchStats
+{
+    /** Post-tick samples taken */
+    int32 Samples = 0;
+
+    /** Raw events received after the world started ticking, i.e. one frame earlier than the normal path sees them */
+    int32 LateEvents = 0;
+};
+
+/**
+ * Samples look input as late as possible in the frame for integrations with late-latched look actions
+ *
+ * A Slate input pre-processor accumulates raw mouse deltas and the latest analog axis values per
+ * user; it never consumes events, so normal input processing and gameplay events are unchanged.
+ * On FWorldDelegates::OnWorldPostActorTick (after every actor has ticked, right before the
+ * world updates player cameras) game device state is polled once more, then each registered
+ * integration turns the accumulated values into its look actions' values.
+ *
+ * The late poll runs with a capturing message handler swapped onto the platform application: pad
+ * events from it only update the late sample and are replayed into Slate on the next
+ * FCoreDelegates::OnBeginFrame, so the viewport and gameplay input see them exactly when they would have
+ * without late latching. Device polling runs at most once per engine frame, however many game worlds tick.
+ *
+ * Only gamepad sticks gain latency. The platform message queue is never pumped here (that would re-enter
+ * window and focus handling in the middle of UWorld::Tick), so mouse mappings get the same delta the
+ * normal path already consumed this frame.
+ */
+class P_MEIS_API FInputLateLatch
+{
+public:
+    static FInputLateLatch &Get();
+
+    /** Start sampling for an integration (hooks the world tick and pre-processor on first use) */
+    void Register(UCPP_EnhancedInputIntegration *Integration);
+    void Unregister(UCPP_EnhancedInputIntegration *Integration);
+
+    /**
+     * Raw value of a key for a Slate user since the previous sample
+     * Mouse keys return the accumulated delta (Y up, as Enhanced Input sees it), analog keys their latest
+     * value; 2D keys combine their paired axes. Digital keys return zero.
+     */
+    FVector2D GetKeyValue(int32 UserIndex, const FKey &Key) const;
+
+    /** Poll game device state before sampling (on by default) */
+    void SetResampleDevices(bool bEnable) { bResampleDevices = bEnable; }
+    bool GetResampleDevices() const { return bResampleDevices; }
+
+    const FInputLateLatchStats &GetStats() const { return Stats; }
+    void ResetStats() { Stats = FInputLateLatchStats(); }
+
+private:
+    FInputLateLatch();
+
+    void Enable();
+    void Disable();
+
+    void HandlePreActorTick(UWorld *World, ELevelTick TickType, float DeltaSeconds);
+    void HandlePostActorTick(UWorld *World, ELevelTick TickType, float DeltaSeconds);
+    void HandleBeginFrame();
+
+    /** Poll game devices into the late sample without routing the events anywhere else this frame */
+    void PollDevices();
+
+    TSharedPtr<FLateLatchInputProcessor> Processor;
+    TSharedPtr<FLateLatchDeviceCapture> DeviceCapture;
+    TArray<TWeakObjectPtr<UCPP_EnhancedInputIntegration>> Integrations;
+    FDelegateHandle PreActorTickHandle;
+    FDelegateHandle PostActorTickHandle;
+    FDelegateHandle BeginFrameHandle;
+    FInputLateLatchStats Stats;
+
+    /** GFrameCounter of the last device poll */
+    uint64 LastPollFrame = MAX_uint64;
+
+    bool bResampleDevices = true;
+    bool bEnabled = false;
+};
@@ -0,0 +1,117 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Mapping Rebuild Batcher Implementation
+ * @Date: 19/10/2026
+ */
+
+#include "Integration/InputMappingRebuildBatcher.h"
+#include "EnhancedInputSubsystems.h"
+#include "InputMappingContext.h"
+
+namespace
+{
+/** Per-operation options: never rebuild here, the batcher does it once per frame */
+FModifyContextOptions MakeDeferredOptions()
+{
+    FModifyContextOptions Options;
+    Options.bForceImmediately = false;
+    Options.bNotifyUserSettings = false;
+    return Options;
+}
+}
+
+FInputMappingRebuildBatcher &FInputMappingRebuildBatcher::Get()
+{
+    static FInputMappingRebuildBatcher Batcher;
+    return Batcher;
+}
+
+void FInputMappingRebuildBatcher::AddMappingContext(UEnhancedInputLocalPlayerSubsystem *Subsystem, const UInputMappingContext *Context, int32 Priority)
+{
+    if (!Subsystem || !Context)
+    {
+        return;
+    }
+
+    int32 AppliedPriority = 0;
+    if (Subsystem->HasMappingContext(Context, AppliedPriority) && AppliedPriority == Priority)
+    {
+        Stats.RedundantAddsSkipped++;
+    }
+    else
+    {
+        Subsystem->AddMappingContext(Context, Priority, MakeDeferredOptions());
+        Stats.ContextsAdded++;
+    }
+
+    RequestRebuild(Subsystem);
+}
+
+void FInputMappingRebuildBatcher::RemoveMappingContext(UEnhancedInputLocalPlayerSubsystem *Subsystem, const UInputMappingContext *Context)
+{
+    if (!Subsystem || !Context || !Subsystem->HasMappingContext(Context))
+    {
+        return;
+    }
+
+    Subsystem->RemoveMappingContext(Context, MakeDeferredOptions());
+    Stats.ContextsRemoved++;
+
+    RequestRebuild(Subsystem);
+}
+
+void FInputMappingRebuildBatcher::RequestRebuild(UEnhancedInputLocalPlayerSubsystem *Subsystem)
+{
+    if (!Subsystem)
+    {
+        return;
+    }
+
+    Stats.RebuildsRequested++;
+    PendingRebuilds.AddUnique(Subsystem);
+
+    if (!TickHandle.IsValid())
+    {
+        TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FInputMappingRebuildBatcher::HandleTick));
+    }
+}
+
+void FInputMappingRebuildBatcher::Flush()
+{
+    if (PendingRebuilds.Num() == 0)
+    {
+        return;
+    }
+
+    // Same behaviour as an immediate add/remove: keys held through the change wait for release
+    FModifyContextOptions Options;
+    Options.bForceImmediately = true;
+    Options.bIgnoreAllPressedKeysUntilRelease = true;
+
+    // Swap out first so a rebuild that re-enters (mapping-changed callbacks) queues for the next frame
+    TArray<TWeakObjectPtr<UEnhancedInputLocalPlayerSubsystem>> Rebuilds = MoveTemp(PendingRebuilds);
+    PendingRebuilds.Reset();
+
+    for (const TWeakObjectPtr<UEnhancedInputLocalPlayerSubsystem> &WeakSubsystem : Rebuilds)
+    {
+        if (UEnhancedInputLocalPlayerSubsystem *Subsystem = WeakSubsystem.Get())
+        {
+            Subsystem->RequestRebuildControlMappings(Options);
+            Stats.RebuildsPerformed++;
+        }
+    }
+}
+
+bool FInputMappingRebuildBatcher::HandleTick(float DeltaTime)
+{
+    Flush();
+
+    if (PendingRebuilds.Num() > 0)
+    {
+        return true;
+    }
+
+    // Nothing queued - stop ticking until the next request
+    TickHandle.Reset();
+    return false;
+}
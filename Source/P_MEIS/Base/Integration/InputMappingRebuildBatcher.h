@@ -0,0 +1,55 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Mapping Rebuild Batcher - Coalesces mapping context changes into one control-mapping rebuild per local player per frame
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "InputBinding/FS_InputMappingBatchStats.h"
+
+class UEnhancedInputLocalPlayerSubsystem;
+class UInputMappingContext;
+
+/**
+ * Every P_MEIS mapping context add/remove goes through here
+ *
+ * Context changes are applied to the subsystem straight away with deferred-rebuild options, so
+ * HasMappingContext and friends stay accurate. The control-mapping rebuild itself is queued
+ * per local player and run once on the next core ticker tick, however many players, contexts or
+ * re-applies touched that player in the frame.
+ */
+class P_MEIS_API FInputMappingRebuildBatcher
+{
+public:
+    static FInputMappingRebuildBatcher &Get();
+
+    /**
+     * Add a context (or change its priority); already applied at Priority only queues a rebuild,
+     * which picks up changes to the context's mappings
+     */
+    void AddMappingContext(UEnhancedInputLocalPlayerSubsystem *Subsystem, const UInputMappingContext *Context, int32 Priority);
+
+    /** Remove a context if it is applied */
+    void RemoveMappingContext(UEnhancedInputLocalPlayerSubsystem *Subsystem, const UInputMappingContext *Context);
+
+    /** Queue a rebuild for a local player whose applied contexts changed content */
+    void RequestRebuild(UEnhancedInputLocalPlayerSubsystem *Subsystem);
+
+    /** Run queued rebuilds now (e.g. before reading the player's resolved mappings) */
+    void Flush();
+
+    int32 GetPendingRebuildCount() const { return PendingRebuilds.Num(); }
+
+    const FS_InputMappingBatchStats &GetStats() const { return Stats; }
+    void ResetStats() { Stats = FS_InputMappingBatchStats(); }
+
+private:
+    bool HandleTick(float DeltaTime);
+
+    TArray<TWeakObjectPtr<UEnhancedInputLocalPlayerSubsystem>> PendingRebuilds;
+    FTSTicker::FDelegateHandle TickHandle;
+    FS_InputMappingBatchStats Stats;
+};
@@ -0,0 +1,336 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Stick Calibration Implementation
+ * @Date: 19/10/2026
+ */
+
+#include "Integration/InputStickCalibration.h"
+#include "Integration/CPP_EnhancedInputIntegration.h"
+#include "Framework/Application/IInputProcessor.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GenericPlatform/GenericPlatformInputDeviceMapper.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/InputDeviceSubsystem.h"
+#include "HAL/IConsoleManager.h"
+
+/**
+ * Slate pre-processor keeping the latest stick readings per device (never consumes events)
+ */
+class FStickCalibrationInputProcessor : public IInputProcessor
+{
+public:
+    struct FStickState
+    {
+        FVector2D Latest = FVector2D::ZeroVector;
+
+        /** Reading at the previous rest check */
+        FVector2D Previous = FVector2D::ZeroVector;
+
+        FStreamingStickStats Stats;
+        int32 SamplesSincePublish = 0;
+    };
+
+    struct FDeviceState
+    {
+        FInputDeviceId DeviceId;
+
+        /** Persistent identity; resolved on the ticker once the device has sent input */
+        FName HardwareId;
+
+        /** Left, right */
+        FStickState Sticks[2];
+
+        /** Time both sticks have been resting */
+        float RestingTime = 0.0f;
+
+        /** Stick input arrived since the last check */
+        bool bSeen = false;
+    };
+
+    TArray<FDeviceState, TInlineAllocator<FInputStickCalibration::MaxDevices>> Devices;
+
+    static const FKey &GetStickKey(int32 StickIndex)
+    {
+        return StickIndex == 0 ? EKeys::Gamepad_Left2D : EKeys::Gamepad_Right2D;
+    }
+
+    virtual void Tick(const float DeltaTime, FSlateApplication &SlateApp, TSharedRef<ICursor> Cursor) override
+    {
+    }
+
+    virtual bool HandleAnalogInputEvent(FSlateApplication &SlateApp, const FAnalogInputEvent &InAnalogInputEvent) override
+    {
+        const FKey Key = InAnalogInputEvent.GetKey();
+        const int32 StickIndex = (Key == EKeys::Gamepad_LeftX || Key == EKeys::Gamepad_LeftY) ? 0 : (Key == EKeys::Gamepad_RightX || Key == EKeys::Gamepad_RightY) ? 1 : INDEX_NONE;
+        if (StickIndex == INDEX_NONE)
+        {
+            return false;
+        }
+
+        FDeviceState *Device = FindOrAddDevice(InAnalogInputEvent.GetInputDeviceId());
+        if (Device)
+        {
+            FVector2D &Latest = Device->Sticks[StickIndex].Latest;
+            (Key == EKeys::Gamepad_LeftY || Key == EKeys::Gamepad_RightY ? Latest.Y : Latest.X) = InAnalogInputEvent.GetAnalogValue();
+            Device->bSeen = true;
+        }
+        return false;
+    }
+
+    virtual const TCHAR *GetDebugName() const override { return TEXT("P_MEIS_StickCalibration"); }
+
+    FDeviceState *FindDevice(FInputDeviceId DeviceId)
+    {
+        return Devices.FindByPredicate([DeviceId](const FDeviceState &Device)
+                                       { return Device.DeviceId == DeviceId; });
+    }
+
+private:
+    FDeviceState *FindOrAddDevice(FInputDeviceId DeviceId)
+    {
+        if (FDeviceState *Device = FindDevice(DeviceId))
+        {
+            return Device;
+        }
+        if (!DeviceId.IsValid() || Devices.Num() >= FInputStickCalibration::MaxDevices)
+        {
+            return nullptr;
+        }
+
+        FDeviceState &Device = Devices.AddDefaulted_GetRef();
+        Device.DeviceId = DeviceId;
+        return &Device;
+    }
+};
+
+FInputStickCalibration &FInputStickCalibration::Get()
+{
+    static FInputStickCalibration StickCalibration;
+    return StickCalibration;
+}
+
+FInputStickCalibration::FInputStickCalibration()
+    : Processor(MakeShared<FStickCalibrationInputProcessor>())
+{
+}
+
+void FInputStickCalibration::Register(UCPP_EnhancedInputIntegration *Integration)
+{
+    if (!Integration)
+    {
+        return;
+    }
+
+    Integrations.AddUnique(Integration);
+    Enable();
+}
+
+void FInputStickCalibration::Unregister(UCPP_EnhancedInputIntegration *Integration)
+{
+    Integrations.RemoveAll([Integration](const TWeakObjectPtr<UCPP_EnhancedInputIntegration> &Entry)
+                           { return !Entry.IsValid() || Entry.Get() == Integration; });
+    if (Integrations.Num() == 0)
+    {
+        Disable();
+    }
+}
+
+void FInputStickCalibration::Enable()
+{
+    if (bEnabled || !FSlateApplication::IsInitialized())
+    {
+        return;
+    }
+
+    FSlateApplication::Get().RegisterInputPreProcessor(Processor);
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FInputStickCalibration::HandleTick), Settings.SampleInterval);
+    bEnabled = true;
+}
+
+void FInputStickCalibration::Disable()
+{
+    if (!bEnabled)
+    {
+        return;
+    }
+
+    if (FSlateApplication::IsInitialized())
+    {
+        FSlateApplication::Get().UnregisterInputPreProcessor(Processor);
+    }
+    if (TickHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+        TickHandle.Reset();
+    }
+
+    // Estimates are kept; integrations hold what was published and the profile persists it
+    for (FStickCalibrationInputProcessor::FDeviceState &Device : Processor->Devices)
+    {
+        Device.RestingTime = 0.0f;
+        Device.bSeen = false;
+    }
+    bEnabled = false;
+}
+
+bool FInputStickCalibration::HandleTick(float DeltaTime)
+{
+    Integrations.RemoveAll([](const TWeakObjectPtr<UCPP_EnhancedInputIntegration> &Entry)
+                           { return !Entry.IsValid(); });
+    if (Integrations.Num() == 0)
+    {
+        // Returning false removes the ticker
+        TickHandle.Reset();
+        Disable();
+        return false;
+    }
+
+    for (FStickCalibrationInputProcessor::FDeviceState &Device : Processor->Devices)
+    {
+        // Players switch pads; the integration then swaps in that device's saved calibration
+        if (Device.bSeen)
+        {
+            Device.HardwareId = GetHardwareId(Device.DeviceId);
+            NotifyIntegrations(Device.DeviceId, Device.HardwareId, nullptr);
+            Device.bSeen = false;
+        }
+
+        bool bResting = true;
+        for (FStickCalibrationInputProcessor::FStickState &Stick : Device.Sticks)
+        {
+            bResting &= Stick.Latest.Size() <= Settings.RestRadius && (Stick.Latest - Stick.Previous).Size() <= Settings.StableDelta;
+            Stick.Previous = Stick.Latest;
+        }
+        Device.RestingTime = bResting ? Device.RestingTime + DeltaTime : 0.0f;
+        if (Device.RestingTime < Settings.RestTime)
+        {
+            continue;
+        }
+
+        for (int32 StickIndex = 0; StickIndex < UE_ARRAY_COUNT(Device.Sticks); ++StickIndex)
+        {
+            FStickCalibrationInputProcessor::FStickState &Stick = Device.Sticks[StickIndex];
+
+            // Once an estimate exists, a reading well outside it is a resting thumb rather than drift
+            if (Stick.Stats.Count >= Settings.MinSamples && (Stick.Latest - Stick.Stats.Mean).Size() > Settings.MaxDeadZone)
+            {
+                continue;
+            }
+
+            Stick.Stats.Add(Stick.Latest, Settings.MaxSamples);
+            if (Stick.Stats.Count >= Settings.MinSamples && ++Stick.SamplesSincePublish >= Settings.PublishEvery)
+            {
+                Stick.SamplesSincePublish = 0;
+                const FS_StickCalibration Calibration = MakeCalibration(FStickCalibrationInputProcessor::GetStickKey(StickIndex).GetFName(), Stick.Stats);
+                NotifyIntegrations(Device.DeviceId, Device.HardwareId, &Calibration);
+            }
+        }
+    }
+    return true;
+}
+
+void FInputStickCalibration::NotifyIntegrations(FInputDeviceId DeviceId, FName HardwareId, const FS_StickCalibration *Calibration)
+{
+    const FPlatformUserId User = IPlatformInputDeviceMapper::Get().GetUserForInputDevice(DeviceId);
+    for (const TWeakObjectPtr<UCPP_EnhancedInputIntegration> &Entry : Integrations)
+    {
+        UCPP_EnhancedInputIntegration *Integration = Entry.Get();
+        const APlayerController *PlayerController = Integration ? Cast<APlayerController>(Integration->GetController()) : nullptr;
+        const ULocalPlayer *LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+        if (!LocalPlayer || LocalPlayer->GetPlatformUserId() != User)
+        {
+            continue;
+        }
+
+        if (Calibration)
+        {
+            Integration->UpdateStickCalibration(HardwareId, *Calibration);
+        }
+        else
+        {
+            Integration->SetStickCalibrationDevice(HardwareId);
+        }
+    }
+}
+
+FS_StickCalibration FInputStickCalibration::MakeCalibration(FName Stick, const FStreamingStickStats &Stats) const
+{
+    FS_StickCalibration Calibration;
+    Calibration.Stick = Stick;
+    Calibration.CenterOffset = Stats.Mean;
+    Calibration.NoiseRadius = Settings.NoiseScale * Stats.GetStdDev();
+    Calibration.DeadZone = FMath::Clamp(Calibration.NoiseRadius + Settings.DeadZoneMargin, Settings.MinDeadZone, Settings.MaxDeadZone);
+    Calibration.SampleCount = Stats.Count;
+    return Calibration;
+}
+
+bool FInputStickCalibration::GetEstimate(FInputDeviceId DeviceId, FName Stick, FS_StickCalibration &OutCalibration) const
+{
+    FStickCalibrationInputProcessor::FDeviceState *Device = Processor->FindDevice(DeviceId);
+    if (!Device)
+    {
+        return false;
+    }
+
+    for (int32 StickIndex = 0; StickIndex < UE_ARRAY_COUNT(Device->Sticks); ++StickIndex)
+    {
+        if (FStickCalibrationInputProcessor::GetStickKey(StickIndex).GetFName() == Stick && Device->Sticks[StickIndex].Stats.Count > 0)
+        {
+            OutCalibration = MakeCalibration(Stick, Device->Sticks[StickIndex].Stats);
+            return true;
+        }
+    }
+    return false;
+}
+
+FName FInputStickCalibration::GetHardwareId(FInputDeviceId DeviceId)
+{
+    const UInputDeviceSubsystem *DeviceSubsystem = UInputDeviceSubsystem::Get();
+    const FHardwareDeviceIdentifier Hardware = DeviceSubsystem ? DeviceSubsystem->GetInputDeviceHardwareIdentifier(DeviceId) : FHardwareDeviceIdentifier::Invalid;
+    if (!Hardware.IsValid())
+    {
+        return TEXT("Gamepad");
+    }
+    return FName(*FString::Printf(TEXT("%s/%s"), *Hardware.InputClassName.ToString(), *Hardware.HardwareDeviceIdentifier.ToString()));
+}
+
+void FInputStickCalibration::ResetEstimates()
+{
+    Processor->Devices.Reset();
+}
+
+void FInputStickCalibration::DumpEstimates() const
+{
+    UE_LOG(LogTemp, Log, TEXT("P_MEIS: Stick calibration %s, %d integrations, %d devices"),
+           bEnabled ? TEXT("running") : TEXT("idle"), Integrations.Num(), Processor->Devices.Num());
+
+    for (const FStickCalibrationInputProcessor::FDeviceState &Device : Processor->Devices)
+    {
+        for (int32 StickIndex = 0; StickIndex < UE_ARRAY_COUNT(Device.Sticks); ++StickIndex)
+        {
+            const FStreamingStickStats &Stats = Device.Sticks[StickIndex].Stats;
+            const FS_StickCalibration Calibration = MakeCalibration(FStickCalibrationInputProcessor::GetStickKey(StickIndex).GetFName(), Stats);
+            UE_LOG(LogTemp, Log, TEXT("P_MEIS:   device %d (%s) %s - offset (%.3f, %.3f), noise %.3f, dead zone %.3f, %d samples"),
+                   Device.DeviceId.GetId(), *Device.HardwareId.ToString(), *Calibration.Stick.ToString(), Calibration.CenterOffset.X, Calibration.CenterOffset.Y,
+                   Calibration.NoiseRadius, Calibration.DeadZone, Stats.Count);
+        }
+    }
+}
+
+// ==================== Console ====================
+
+static void StickCalibrationCommand(const TArray<FString> &Args)
+{
+    FInputStickCalibration &StickCalibration = FInputStickCalibration::Get();
+    if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+    {
+        StickCalibration.ResetEstimates();
+    }
+    StickCalibration.DumpEstimates();
+}
+
+static FAutoConsoleCommand StickCalibrationConsoleCommand(
+    TEXT("p_meis.StickCalibration"),
+    TEXT("Log per-device stick drift estimates; 'reset' forgets them first (published calibrations stay in the profiles)"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&StickCalibrationCommand));
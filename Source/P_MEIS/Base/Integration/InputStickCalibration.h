@@ -0,0 +1,132 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Stick Calibration - Estimates per-device stick drift from resting samples
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "InputBinding/FS_StickCalibration.h"
+
+class UCPP_EnhancedInputIntegration;
+class FStickCalibrationInputProcessor;
+
+/**
+ * Tuning for rest detection and the drift estimate
+ */
+struct FInputStickCalibrationSettings
+{
+    /** Seconds between rest checks (one sample per check at most) */
+    float SampleInterval = 0.1f;
+
+    /** Readings further than this from center are never treated as resting */
+    float RestRadius = 0.35f;
+
+    /** Largest movement between checks that still counts as untouched */
+    float StableDelta = 0.02f;
+
+    /** Both sticks of the device must be still this long before samples are taken */
+    float RestTime = 0.5f;
+
+    /** Samples needed before an estimate is published */
+    int32 MinSamples = 40;
+
+    /** Publish after this many further samples */
+    int32 PublishEvery = 20;
+
+    /** Estimator window; older samples fade out once reached, so a wearing stick is followed */
+    int32 MaxSamples = 600;
+
+    /** Dead zone = NoiseScale x noise standard deviation + Margin, clamped */
+    float NoiseScale = 3.0f;
+    float DeadZoneMargin = 0.02f;
+    float MinDeadZone = 0.04f;
+    float MaxDeadZone = 0.35f;
+};
+
+/**
+ * Streaming mean/variance of 2D samples in constant memory
+ * Weights are 1/N up to the window size, then fixed at 1/Window (exponential forgetting).
+ */
+struct FStreamingStickStats
+{
+    FVector2D Mean = FVector2D::ZeroVector;
+    FVector2D Variance = FVector2D::ZeroVector;
+    int32 Count = 0;
+
+    void Add(const FVector2D &Sample, int32 Window)
+    {
+        Count = FMath::Min(Count + 1, FMath::Max(Window, 1));
+        const double Alpha = 1.0 / Count;
+        const FVector2D Delta = Sample - Mean;
+        Mean += Delta * Alpha;
+        Variance = (Variance + Delta * Delta * Alpha) * (1.0 - Alpha);
+    }
+
+    /** Root of the summed component variances */
+    float GetStdDev() const { return FMath::Sqrt(static_cast<float>(Variance.X + Variance.Y)); }
+};
+
+/**
+ * Collects resting-stick samples for integrations whose profile enables stick calibration
+ *
+ * A Slate input pre-processor keeps the latest reading of every gamepad stick per device (a fixed
+ * number of devices; events are never consumed). A low-rate core ticker checks each device: while
+ * both its sticks have stayed inside RestRadius and still for RestTime, one sample per stick goes
+ * into that stick's streaming estimate. Estimates are pushed to the integrations of the device's
+ * platform user, which update their calibration modifiers in place.
+ *
+ * Integrations key calibrations by GetHardwareId, which survives reconnects and restarts. A saved
+ * calibration is only a starting point: every device is estimated afresh each session and its first
+ * published estimate replaces the saved one.
+ */
+class P_MEIS_API FInputStickCalibration
+{
+public:
+    static FInputStickCalibration &Get();
+
+    /** Devices tracked at once; input from further devices is ignored */
+    static constexpr int32 MaxDevices = 8;
+
+    /** Start calibrating for an integration (hooks the pre-processor and ticker on first use) */
+    void Register(UCPP_EnhancedInputIntegration *Integration);
+    void Unregister(UCPP_EnhancedInputIntegration *Integration);
+
+    FInputStickCalibrationSettings &GetSettings() { return Settings; }
+
+    /** Current estimate for a device's stick (Stick is Gamepad_Left2D / Gamepad_Right2D) */
+    bool GetEstimate(FInputDeviceId DeviceId, FName Stick, FS_StickCalibration &OutCalibration) const;
+
+    /**
+     * Persistent identity of a device: "<InputClassName>/<HardwareDeviceIdentifier>" from the input
+     * device subsystem (e.g. "GamepadInput/DualSense"), or "Gamepad" until the device is identified
+     */
+    static FName GetHardwareId(FInputDeviceId DeviceId);
+
+    /** Forget the estimates of every device */
+    void ResetEstimates();
+
+    /** Log every tracked device's estimates */
+    void DumpEstimates() const;
+
+private:
+    FInputStickCalibration();
+
+    void Enable();
+    void Disable();
+
+    bool HandleTick(float DeltaTime);
+
+    /** Push a device's calibration (or, with Calibration null, just its use) to the integrations of its user */
+    void NotifyIntegrations(FInputDeviceId DeviceId, FName HardwareId, const FS_StickCalibration *Calibration);
+
+    FS_StickCalibration MakeCalibration(FName Stick, const FStreamingStickStats &Stats) const;
+
+    TSharedPtr<FStickCalibrationInputProcessor> Processor;
+    TArray<TWeakObjectPtr<UCPP_EnhancedInputIntegration>> Integrations;
+    FTSTicker::FDelegateHandle TickHandle;
+    FInputStickCalibrationSettings Settings;
+    bool bEnabled = false;
+};
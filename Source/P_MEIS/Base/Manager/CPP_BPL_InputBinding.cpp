@@ -7,9 +7,11 @@
 
 #include "Manager/CPP_BPL_InputBinding.h"
 #include "Manager/CPP_InputBindingManager.h"
+#include "Manager/CPP_InputActionDefinitionRegistry.h"
 #include "Storage/CPP_InputProfileStorage.h"
 #include "Integration/CPP_EnhancedInputIntegration.h"
 #include "Integration/CPP_AsyncAction_WaitForInputAction.h"
+#include "InputBinding/InputDisplayTextCache.h"
 #include "InputAction.h"
 #include "InputMappingContext.h"
 #include "GameFramework/PlayerController.h"
@@ -386,6 +388,63 @@ void UCPP_BPL_InputBinding::InjectAxis2D(APlayerController *PlayerController, co
     }
 }
 
+// ==================== Late-Latched Look ====================
+
+void UCPP_BPL_InputBinding::SetLateLatchedLook(APlayerController *PlayerController, const FName &ActionName, bool bEnable)
+{
+    if (!PlayerController || !PlayerController->IsLocalController())
+    {
+        return;
+    }
+
+    if (UCPP_EnhancedInputIntegration *Integration = GetIntegrationForPlayer(PlayerController))
+    {
+        Integration->SetLateLatchedLook(ActionName, bEnable);
+    }
+}
+
+FVector2D UCPP_BPL_InputBinding::GetLateLatchedLookValue(APlayerController *PlayerController, const FName &ActionName)
+{
+    UCPP_EnhancedInputIntegration *Integration = GetIntegrationForPlayer(PlayerController);
+    return Integration ? Integration->GetLateLatchedLookValue(ActionName) : FVector2D::ZeroVector;
+}
+
+// ==================== Action Groups (Per-Player) ====================
+
+bool UCPP_BPL_InputBinding::SetActionGroupEnabled(APlayerController *PlayerController, const FName &GroupName, bool bEnabled, bool bSuppressMappings)
+{
+    UCPP_EnhancedInputIntegration *Integration = GetIntegrationForPlayer(PlayerController);
+    return Integration && Integration->SetActionGroupEnabled(GroupName, bEnabled, bSuppressMappings);
+}
+
+bool UCPP_BPL_InputBinding::IsActionGroupEnabled(APlayerController *PlayerController, const FName &GroupName)
+{
+    UCPP_EnhancedInputIntegration *Integration = GetIntegrationForPlayer(PlayerController);
+    return !Integration || Integration->IsActionGroupEnabled(GroupName);
+}
+
+void UCPP_BPL_InputBinding::EnableAllActionGroups(APlayerController *PlayerController)
+{
+    if (UCPP_EnhancedInputIntegration *Integration = GetIntegrationForPlayer(PlayerController))
+    {
+        Integration->EnableAllActionGroups();
+    }
+}
+
+// ==================== Stick Drift Calibration (Per-Player) ====================
+
+bool UCPP_BPL_InputBinding::SetStickCalibrationEnabled(APlayerController *PlayerController, bool bEnable)
+{
+    UCPP_InputBindingManager *Manager = GetManager();
+    return Manager && Manager->SetStickCalibrationEnabled(PlayerController, bEnable);
+}
+
+bool UCPP_BPL_InputBinding::GetStickCalibration(APlayerController *PlayerController, FName Stick, FS_StickCalibration &OutCalibration)
+{
+    UCPP_EnhancedInputIntegration *Integration = GetIntegrationForPlayer(PlayerController);
+    return Integration && Integration->GetStickCalibration(Stick, OutCalibration);
+}
+
 // ==================== Dynamic Input Action Creation (Multi-Player) ====================
 
 UInputAction *UCPP_BPL_InputBinding::CreateDynamicInputAction(APlayerController *PlayerController, const FName &ActionName, bool bIsAxis)
@@ -699,6 +758,34 @@ bool UCPP_BPL_InputBinding::IsKeyBoundForPlayer(APlayerController *PlayerControl
     return Manager->IsKeyBoundForPlayer(PlayerController, Key);
 }
 
+FText UCPP_BPL_InputBinding::GetActionDisplayText(APlayerController *PlayerController, const FName &ActionName, bool bDescription)
+{
+    UCPP_InputBindingManager *Manager = GetManager();
+    const FS_InputProfile *Profile = Manager ? Manager->GetProfileRefForPlayer(PlayerController) : nullptr;
+    if (!Profile)
+    {
+        return FText::GetEmpty();
+    }
+
+    for (const FS_InputActionBinding &Binding : Profile->ActionBindings)
+    {
+        if (Binding.InputActionName == ActionName)
+        {
+            return bDescription ? FInputDisplayTextCache::GetDescription(*Profile, Binding) : FInputDisplayTextCache::GetDisplayName(*Profile, Binding);
+        }
+    }
+
+    for (const FS_InputAxisBinding &Binding : Profile->AxisBindings)
+    {
+        if (Binding.InputAxisName == ActionName)
+        {
+            return bDescription ? FInputDisplayTextCache::GetDescription(*Profile, Binding) : FInputDisplayTextCache::GetDisplayName(*Profile, Binding);
+        }
+    }
+
+    return FText::GetEmpty();
+}
+
 // ==================== Per-Player Axis Binding Helpers ====================
 
 float UCPP_BPL_InputBinding::GetAxisSensitivity(APlayerController *PlayerController, const FName &AxisName)
@@ -1090,3 +1177,180 @@ bool UCPP_BPL_InputBinding::ClearActionModifiers(APlayerController *PlayerContro
     }
     return Integration->ClearActionModifiers(ActionName);
 }
+
+// ==================== Action Rates (APM) ====================
+
+int32 UCPP_BPL_InputBinding::GetPlayerActionsPerMinute(APlayerController *PlayerController)
+{
+    UCPP_EnhancedInputIntegration *Integration = GetIntegrationForPlayer(PlayerController);
+    return Integration ? Integration->GetActionsPerMinute() : 0;
+}
+
+FS_InputActionRates UCPP_BPL_InputBinding::GetPlayerActionRates(APlayerController *PlayerController)
+{
+    UCPP_EnhancedInputIntegration *Integration = GetIntegrationForPlayer(PlayerController);
+    return Integration ? Integration->GetPlayerRates() : FS_InputActionRates();
+}
+
+FS_InputActionRates UCPP_BPL_InputBinding::GetActionRatesForPlayer(APlayerController *PlayerController, const FName &ActionName)
+{
+    UCPP_EnhancedInputIntegration *Integration = GetIntegrationForPlayer(PlayerController);
+    return Integration ? Integration->GetActionRates(ActionName) : FS_InputActionRates();
+}
+
+FS_InputActionRates UCPP_BPL_InputBinding::GetAllPlayersActionRates(bool bIncludeControllers)
+{
+    UCPP_InputBindingManager *Manager = GetManager();
+    return Manager ? Manager->GetAggregatedActionRates(bIncludeControllers) : FS_InputActionRates();
+}
+
+void UCPP_BPL_InputBinding::ResetPlayerActionRates(APlayerController *PlayerController)
+{
+    if (UCPP_EnhancedInputIntegration *Integration = GetIntegrationForPlayer(PlayerController))
+    {
+        Integration->ResetRateCounters();
+    }
+}
+
+// ==================== Timing Anomaly Detection ====================
+
+void UCPP_BPL_InputBinding::SetInputTimingThresholds(const FS_InputTimingThresholds &Thresholds)
+{
+    if (UCPP_InputBindingManager *Manager = GetManager())
+    {
+        Manager->SetTimingThresholds(Thresholds);
+    }
+}
+
+FS_InputTimingReport UCPP_BPL_InputBinding::GetActionTimingReport(APlayerController *PlayerController, const FName &ActionName)
+{
+    UCPP_EnhancedInputIntegration *Integration = GetIntegrationForPlayer(PlayerController);
+    return Integration ? Integration->GetActionTimingReport(ActionName) : FS_InputTimingReport();
+}
+
+// ==================== Shared Keyboard Split ====================
+
+bool UCPP_BPL_InputBinding::EnableSharedKeyboardSplit(APlayerController *PlayerA, APlayerController *PlayerB, TArray<FString> &OutConflicts)
+{
+    if (UCPP_InputBindingManager *Manager = GetManager())
+    {
+        return Manager->EnableSharedKeyboardSplit({PlayerA, PlayerB}, OutConflicts);
+    }
+    return false;
+}
+
+void UCPP_BPL_InputBinding::DisableSharedKeyboardSplit()
+{
+    if (UCPP_InputBindingManager *Manager = GetManager())
+    {
+        Manager->DisableSharedKeyboardSplit();
+    }
+}
+
+APlayerController *UCPP_BPL_InputBinding::GetSharedKeyboardKeyOwner(const FKey &Key)
+{
+    UCPP_InputBindingManager *Manager = GetManager();
+    return Manager ? Manager->GetSharedKeyboardKeyOwner(Key) : nullptr;
+}
+
+// ==================== Action Definitions ====================
+
+int32 UCPP_BPL_InputBinding::RegisterInputActionDefinitions(UDataTable *Table)
+{
+    UCPP_InputBindingManager *Manager = GetManager();
+    UCPP_InputActionDefinitionRegistry *Registry = Manager ? Manager->GetActionDefinitionRegistry() : nullptr;
+    return Registry ? Registry->RegisterDefinitionsFromTable(Table) : 0;
+}
+
+int32 UCPP_BPL_InputBinding::GetInputActionIndex(const FName &ActionName)
+{
+    UCPP_InputBindingManager *Manager = GetManager();
+    UCPP_InputActionDefinitionRegistry *Registry = Manager ? Manager->GetActionDefinitionRegistry() : nullptr;
+    return Registry ? Registry->GetActionIndex(ActionName) : INDEX_NONE;
+}
+
+// ==================== Action Id Fast Paths ====================
+
+FKey UCPP_BPL_InputBinding::GetPrimaryKeyForActionId(APlayerController *PlayerController, int32 ActionId)
+{
+    if (UCPP_InputBindingManager *Manager = GetManager())
+    {
+        return Manager->GetPrimaryKeyForActionId(PlayerController, ActionId);
+    }
+    return EKeys::Invalid;
+}
+
+UAsyncAction_WaitForInputAction *UCPP_BPL_InputBinding::WaitForInputActionById(UObject *WorldContextObject, APlayerController *PlayerController, int32 ActionId, bool bOnlyTriggerOnce)
+{
+    // Resolved once when the node runs; events are then matched against the name as usual
+    UCPP_InputBindingManager *Manager = GetManager();
+    const FName ActionName = Manager ? Manager->ResolveActionId(ActionId) : NAME_None;
+    return UAsyncAction_WaitForInputAction::WaitForInputAction(WorldContextObject, PlayerController, ActionName, bOnlyTriggerOnce);
+}
+
+// ==================== Mapping Rebuilds ====================
+
+FS_InputMappingBatchStats UCPP_BPL_InputBinding::GetMappingRebuildStats()
+{
+    UCPP_InputBindingManager *Manager = GetManager();
+    return Manager ? Manager->GetMappingRebuildStats() : FS_InputMappingBatchStats();
+}
+
+void UCPP_BPL_InputBinding::ResetMappingRebuildStats()
+{
+    if (UCPP_InputBindingManager *Manager = GetManager())
+    {
+        Manager->ResetMappingRebuildStats();
+    }
+}
+
+// ==================== Input Contexts ====================
+
+bool UCPP_BPL_InputBinding::SetInputContextForPlayer(APlayerController *PlayerController, EInputContext Context)
+{
+    UCPP_InputBindingManager *Manager = GetManager();
+    UCPP_InputContextManager *ContextManager = Manager ? Manager->GetContextManager() : nullptr;
+    return ContextManager && ContextManager->SetContextForPlayer(PlayerController, Context);
+}
+
+bool UCPP_BPL_InputBinding::PushInputContext(APlayerController *PlayerController, EInputContext Context)
+{
+    UCPP_InputBindingManager *Manager = GetManager();
+    UCPP_InputContextManager *ContextManager = Manager ? Manager->GetContextManager() : nullptr;
+    return ContextManager && ContextManager->PushContextForPlayer(PlayerController, Context);
+}
+
+bool UCPP_BPL_InputBinding::PopInputContext(APlayerController *PlayerController)
+{
+    UCPP_InputBindingManager *Manager = GetManager();
+    UCPP_InputContextManager *ContextManager = Manager ? Manager->GetContextManager() : nullptr;
+    return ContextManager && ContextManager->PopContextForPlayer(PlayerController);
+}
+
+EInputContext UCPP_BPL_InputBinding::GetInputContextForPlayer(APlayerController *PlayerController)
+{
+    UCPP_InputBindingManager *Manager = GetManager();
+    UCPP_InputContextManager *ContextManager = Manager ? Manager->GetContextManager() : nullptr;
+    return ContextManager ? ContextManager->GetContextForPlayer(PlayerController) : EInputContext::Gameplay;
+}
+
+int32 UCPP_BPL_InputBinding::PushInputContextForAllPlayers(EInputContext Context)
+{
+    UCPP_InputBindingManager *Manager = GetManager();
+    UCPP_InputContextManager *ContextManager = Manager ? Manager->GetContextManager() : nullptr;
+    return ContextManager ? ContextManager->PushContextForAllPlayers(Context) : 0;
+}
+
+int32 UCPP_BPL_InputBinding::PopInputContextForAllPlayers()
+{
+    UCPP_InputBindingManager *Manager = GetManager();
+    UCPP_InputContextManager *ContextManager = Manager ? Manager->GetContextManager() : nullptr;
+    return ContextManager ? ContextManager->PopContextForAllPlayers() : 0;
+}
+
+int32 UCPP_BPL_InputBinding::SetInputContextForAllPlayers(EInputContext Context)
+{
+    UCPP_InputBindingManager *Manager = GetManager();
+    UCPP_InputContextManager *ContextManager = Manager ? Manager->GetContextManager() : nullptr;
+    return ContextManager ? ContextManager->SetContextForAllPlayers(Context) : 0;
+}
@@ -6,6 +6,10 @@
 #include "InputBinding/FS_InputProfile.h"
 #include "InputBinding/FS_InputActionBinding.h"
 #include "InputBinding/FS_InputAxisBinding.h"
+#include "InputBinding/FS_InputActionRate.h"
+#include "InputBinding/FS_InputTimingStats.h"
+#include "InputBinding/FS_InputMappingBatchStats.h"
+#include "Manager/CPP_InputContextManager.h"
 #include "CPP_BPL_InputBinding.generated.h"
 
 class UCPP_InputBindingManager;
@@ -14,6 +18,7 @@ class UInputAction;
 class UInputMappingContext;
 class APlayerController;
 class UAsyncAction_WaitForInputAction;
+class UDataTable;
 
 /**
  * Public Blueprint Function Library for Input Binding operations
@@ -190,6 +195,41 @@ public:
     UFUNCTION(BlueprintCallable, Category = "P_MEIS|Injection")
     static void InjectAxis2D(APlayerController *PlayerController, const FName &AxisName, const FVector2D &Value);
 
+    // ==================== Late-Latched Look (Low Latency Camera) ====================
+
+    /** Re-sample a 2D look action from raw input right before the camera update (local players only) */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Late Latch")
+    static void SetLateLatchedLook(APlayerController *PlayerController, const FName &ActionName, bool bEnable = true);
+
+    /** Look value sampled before this frame's camera update (zero if the action is not late-latched) */
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Late Latch")
+    static FVector2D GetLateLatchedLookValue(APlayerController *PlayerController, const FName &ActionName);
+
+    // ==================== Action Groups (Per-Player) ====================
+
+    /**
+     * Enable or disable every action in a group (binding Category or ActionGroups entry) without a rebuild
+     * @param bSuppressMappings Also pull the group's keys out of the player's mapping context
+     */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Action Groups")
+    static bool SetActionGroupEnabled(APlayerController *PlayerController, const FName &GroupName, bool bEnabled, bool bSuppressMappings = false);
+
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Action Groups")
+    static bool IsActionGroupEnabled(APlayerController *PlayerController, const FName &GroupName);
+
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Action Groups")
+    static void EnableAllActionGroups(APlayerController *PlayerController);
+
+    // ==================== Stick Drift Calibration (Per-Player) ====================
+
+    /** Estimate the player's gamepad stick drift while resting and replace the fixed stick dead zone (stored in their profile) */
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Stick Calibration")
+    static bool SetStickCalibrationEnabled(APlayerController *PlayerController, bool bEnable);
+
+    /** Calibration in use for a stick (Gamepad_Left2D / Gamepad_Right2D) on the player's current device */
+    UFUNCTION(BlueprintPure, Category = "P_MEIS|Stick Calibration")
+    static bool GetStickCalibration(APlayerController *PlayerController, FName Stick, FS_StickCalibration &OutCalibration);
+
     // ==================== Dynamic Input Action Creation (Multi-Player) ====================
 
     /**
@@ -436,6 +476,16 @@ public:
     UFUNCTION(BlueprintPure, Category = "Input Binding|Player Action")
     static bool IsKeyBoundForPlayer(APlayerController *PlayerController, const FKey &Key);
 
+    /**
+     * Localized display name of an action or axis (string-table key if set, else the literal text)
+     * @param PlayerController The player
+     * @param ActionName Name of the action or axis
+     * @param bDescription Return the description instead of the display name
+     * @return The resolved text, empty if the binding does not exist
+     */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Player Action")
+    static FText GetActionDisplayText(APlayerController *PlayerController, const FName &ActionName, bool bDescription = false);
+
     // ==================== Per-Player Axis Binding Helpers ====================
 
     /**
@@ -645,6 +695,162 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Input Binding|Modifiers")
     static bool ClearActionModifiers(APlayerController *PlayerController, const FName &ActionName);
 
+    // ==================== Action Rates (APM) ====================
+
+    /**
+     * Get a player's actions per minute (Started events across all actions in the last 60 seconds)
+     * @param PlayerController The player
+     * @return Actions per minute, or 0 if the player is not registered
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Rates")
+    static int32 GetPlayerActionsPerMinute(APlayerController *PlayerController);
+
+    /**
+     * Get a player's Started-event counts over 1s / 10s / 60s
+     * @param PlayerController The player
+     * @return Counts across all of the player's actions
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Rates")
+    static FS_InputActionRates GetPlayerActionRates(APlayerController *PlayerController);
+
+    /**
+     * Get Started-event counts over 1s / 10s / 60s for one action
+     * @param PlayerController The player
+     * @param ActionName Name of the action
+     * @return Counts for that action
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Rates")
+    static FS_InputActionRates GetActionRatesForPlayer(APlayerController *PlayerController, const FName &ActionName);
+
+    /**
+     * Get the summed rates of every registered player
+     * @param bIncludeControllers Also count non-player controllers (AI, bots)
+     * @return Aggregated counts
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Rates")
+    static FS_InputActionRates GetAllPlayersActionRates(bool bIncludeControllers = false);
+
+    /**
+     * Clear a player's rate counters (e.g. at round start)
+     * @param PlayerController The player
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Rates")
+    static void ResetPlayerActionRates(APlayerController *PlayerController);
+
+    // ==================== Timing Anomaly Detection ====================
+
+    /**
+     * Set timing anomaly thresholds for every player and controller (bind OnTimingAnomaly on the Integration)
+     * @param Thresholds Thresholds to apply; bEnabled turns collection on or off
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Timing")
+    static void SetInputTimingThresholds(const FS_InputTimingThresholds &Thresholds);
+
+    /**
+     * Get press-interval and hold-duration statistics for one action
+     * @param PlayerController The player
+     * @param ActionName Name of the action
+     * @return Timing report (empty if timing checks are disabled or the action has not fired)
+     */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Timing")
+    static FS_InputTimingReport GetActionTimingReport(APlayerController *PlayerController, const FName &ActionName);
+
+    // ==================== Shared Keyboard Split ====================
+
+    /**
+     * Share one keyboard between two local players; each key goes to the player whose profile binds it
+     * @param PlayerA First player (usually the one that owns the keyboard)
+     * @param PlayerB Second player
+     * @param OutConflicts One message per key bound by both players
+     * @return True if the profiles do not overlap and routing is active
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Shared Keyboard")
+    static bool EnableSharedKeyboardSplit(APlayerController *PlayerA, APlayerController *PlayerB, TArray<FString> &OutConflicts);
+
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Shared Keyboard")
+    static void DisableSharedKeyboardSplit();
+
+    /**
+     * Player a keyboard key is routed to while the split is active
+     * @param Key The key
+     * @return The owning player, or nullptr if the key is not partitioned
+     */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Shared Keyboard")
+    static APlayerController *GetSharedKeyboardKeyOwner(const FKey &Key);
+
+    // ==================== Action Definitions ====================
+
+    /**
+     * Register action/axis definitions from a DataTable (row struct FS_InputActionDefinition)
+     * Call before loading profiles saved against these definitions.
+     * @param Table The definition table
+     * @return Number of definitions registered
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Definitions")
+    static int32 RegisterInputActionDefinitions(UDataTable *Table);
+
+    /**
+     * Dense index of a registered action (stable for the session)
+     * @param ActionName Name of the action or axis
+     * @return The index, or -1 if not registered
+     */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Definitions")
+    static int32 GetInputActionIndex(const FName &ActionName);
+
+    // ==================== Action Id Fast Paths ====================
+    // Called by the P_MEISEditor action nodes, which pick the action from a dropdown and bake its
+    // UCPP_InputActionDefinitionRegistry::MakeActionId into the compiled graph.
+
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Player Action", meta = (BlueprintInternalUseOnly = "true"))
+    static FKey GetPrimaryKeyForActionId(APlayerController *PlayerController, int32 ActionId);
+
+    UFUNCTION(BlueprintCallable, Category = "P_MEIS|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UAsyncAction_WaitForInputAction *WaitForInputActionById(UObject *WorldContextObject, APlayerController *PlayerController, int32 ActionId, bool bOnlyTriggerOnce = false);
+
+    // ==================== Mapping Rebuilds ====================
+
+    /**
+     * Control-mapping rebuilds requested vs performed (one per local player per frame at most)
+     * @return Rebuild and mapping context counters
+     */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Mapping")
+    static FS_InputMappingBatchStats GetMappingRebuildStats();
+
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Mapping")
+    static void ResetMappingRebuildStats();
+
+    // ==================== Input Contexts (Per-Player) ====================
+
+    /** Switch one player's context (replaces their context stack) */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
+    static bool SetInputContextForPlayer(APlayerController *PlayerController, EInputContext Context);
+
+    /** Push a context over one player's current one (e.g. entering a vehicle) */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
+    static bool PushInputContext(APlayerController *PlayerController, EInputContext Context);
+
+    /** Return one player to the context under their top one */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
+    static bool PopInputContext(APlayerController *PlayerController);
+
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Context")
+    static EInputContext GetInputContextForPlayer(APlayerController *PlayerController);
+
+    /**
+     * Push a context for every registered player in one batched pass (cutscene, pause)
+     * Pop with PopInputContextForAllPlayers to give each player their own context back.
+     * @return Number of players whose context changed
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
+    static int32 PushInputContextForAllPlayers(EInputContext Context);
+
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
+    static int32 PopInputContextForAllPlayers();
+
+    /** Replace every registered player's context in one batched pass */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
+    static int32 SetInputContextForAllPlayers(EInputContext Context);
+
     // ==================== Helper Functions ======================================
 
     UFUNCTION(BlueprintPure, Category = "Input Binding|Utility")
@@ -0,0 +1,143 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Action Definition Registry Implementation
+ * @Date: 19/10/2026
+ */
+
+#include "Manager/CPP_InputActionDefinitionRegistry.h"
+#include "Engine/DataTable.h"
+
+void UCPP_InputActionDefinitionRegistry::LoadConfiguredTables()
+{
+    for (const TSoftObjectPtr<UDataTable> &TableRef : DefinitionTables)
+    {
+        if (TableRef.IsNull())
+        {
+            continue;
+        }
+
+        UDataTable *Table = TableRef.LoadSynchronous();
+        if (!Table)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to load action definition table %s"), *TableRef.ToString());
+            continue;
+        }
+        RegisterDefinitionsFromTable(Table);
+    }
+}
+
+int32 UCPP_InputActionDefinitionRegistry::RegisterDefinition(const FS_InputActionDefinition &Definition)
+{
+    if (Definition.ActionName.IsNone())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: RegisterDefinition - action name is None"));
+        return INDEX_NONE;
+    }
+
+    ++Revision;
+
+    // Re-registering updates metadata in place; the index never changes
+    if (const int32 *ExistingIndex = IndexByName.Find(Definition.ActionName))
+    {
+        Definitions[*ExistingIndex] = Definition;
+        Definitions[*ExistingIndex].ActionIndex = *ExistingIndex;
+        return *ExistingIndex;
+    }
+
+    const int32 NewIndex = Definitions.Add(Definition);
+    Definitions[NewIndex].ActionIndex = NewIndex;
+    IndexByName.Add(Definition.ActionName, NewIndex);
+    return NewIndex;
+}
+
+int32 UCPP_InputActionDefinitionRegistry::RegisterDefinitionsFromTable(UDataTable *Table)
+{
+    if (!Table || Table->GetRowStruct() != FS_InputActionDefinition::StaticStruct())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: RegisterDefinitionsFromTable - table is null or its row struct is not FS_InputActionDefinition"));
+        return 0;
+    }
+
+    int32 Registered = 0;
+    Table->ForeachRow<FS_InputActionDefinition>(TEXT("P_MEIS RegisterDefinitionsFromTable"),
+                                                 [this, &Registered](const FName &RowName, const FS_InputActionDefinition &Row)
+                                                 {
+                                                     FS_InputActionDefinition Definition = Row;
+                                                     if (Definition.ActionName.IsNone())
+                                                     {
+                                                         Definition.ActionName = RowName;
+                                                     }
+                                                     if (RegisterDefinition(Definition) != INDEX_NONE)
+                                                     {
+                                                         Registered++;
+                                                     }
+                                                 });
+
+    UE_LOG(LogTemp, Log, TEXT("P_MEIS: Registered %d action definitions from %s"), Registered, *Table->GetName());
+    return Registered;
+}
+
+int32 UCPP_InputActionDefinitionRegistry::RegisterDefinitionsFromProfile(const FS_InputProfile &Profile)
+{
+    int32 Registered = 0;
+    for (const FS_InputActionBinding &Binding : Profile.ActionBindings)
+    {
+        if (RegisterDefinition(FS_InputActionDefinition::FromBinding(Binding)) != INDEX_NONE)
+        {
+            Registered++;
+        }
+    }
+    for (const FS_InputAxisBinding &Binding : Profile.AxisBindings)
+    {
+        if (RegisterDefinition(FS_InputActionDefinition::FromBinding(Binding)) != INDEX_NONE)
+        {
+            Registered++;
+        }
+    }
+    return Registered;
+}
+
+int32 UCPP_InputActionDefinitionRegistry::GetActionIndex(const FName &ActionName) const
+{
+    const int32 *Index = IndexByName.Find(ActionName);
+    return Index ? *Index : INDEX_NONE;
+}
+
+int32 UCPP_InputActionDefinitionRegistry::MakeActionId(const FName &ActionName)
+{
+    // FNames compare case-insensitively, so the id must too
+    return ActionName.IsNone() ? 0 : static_cast<int32>(FCrc::StrCrc32(*ActionName.ToString().ToLower()));
+}
+
+FName UCPP_InputActionDefinitionRegistry::GetActionName(int32 ActionIndex) const
+{
+    return Definitions.IsValidIndex(ActionIndex) ? Definitions[ActionIndex].ActionName : NAME_None;
+}
+
+bool UCPP_InputActionDefinitionRegistry::GetDefinition(const FName &ActionName, FS_InputActionDefinition &OutDefinition) const
+{
+    if (const FS_InputActionDefinition *Definition = FindDefinition(ActionName))
+    {
+        OutDefinition = *Definition;
+        return true;
+    }
+    return false;
+}
+
+const FS_InputActionDefinition *UCPP_InputActionDefinitionRegistry::FindDefinition(const FName &ActionName) const
+{
+    const int32 *Index = IndexByName.Find(ActionName);
+    return Index ? &Definitions[*Index] : nullptr;
+}
+
+const FS_InputActionDefinition *UCPP_InputActionDefinitionRegistry::FindDefinitionByIndex(int32 ActionIndex) const
+{
+    return Definitions.IsValidIndex(ActionIndex) ? &Definitions[ActionIndex] : nullptr;
+}
+
+void UCPP_InputActionDefinitionRegistry::ResetDefinitions()
+{
+    Definitions.Reset();
+    IndexByName.Reset();
+    ++Revision;
+}
@@ -0,0 +1,107 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Action Definition Registry - Global action metadata with dense action indices
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputBinding/FS_InputActionDefinition.h"
+#include "InputBinding/FS_InputProfile.h"
+#include "CPP_InputActionDefinitionRegistry.generated.h"
+
+class UDataTable;
+
+/**
+ * Registry of action/axis definitions shared by every profile
+ *
+ * Definitions own the static metadata of an action (display text, category, value type,
+ * default tuning). Each gets a dense index in registration order; indices are stable for the
+ * session and never reused, so runtime code can key arrays by them instead of hashing names.
+ *
+ * Saved profiles write only the fields of a binding that differ from its definition (keys
+ * always), and loads fill the rest back in. Profiles must therefore be loaded with the same
+ * definitions registered; names stay the on-disk identity, indices are runtime only.
+ *
+ * Config (DefaultGame.ini) - loaded before the default template:
+ * [/Script/P_MEIS.CPP_InputActionDefinitionRegistry]
+ * +DefinitionTables=/Game/Input/DT_InputActions.DT_InputActions
+ */
+UCLASS(Config = Game, BlueprintType)
+class P_MEIS_API UCPP_InputActionDefinitionRegistry : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /** DataTables (row struct FS_InputActionDefinition) registered at startup */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Input Binding|Definitions")
+    TArray<TSoftObjectPtr<UDataTable>> DefinitionTables;
+
+    /** Load and register every table in DefinitionTables (blocking; called once by the manager) */
+    void LoadConfiguredTables();
+
+    /**
+     * Register or update one definition
+     * @param Definition Metadata for the action/axis (ActionName must be set)
+     * @return The action's dense index, or INDEX_NONE if the name is None
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Definitions")
+    int32 RegisterDefinition(const FS_InputActionDefinition &Definition);
+
+    /**
+     * Register every row of a DataTable whose row struct is FS_InputActionDefinition
+     * @param Table The table (row name is used when a row's ActionName is None)
+     * @return Number of rows registered
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Definitions")
+    int32 RegisterDefinitionsFromTable(UDataTable *Table);
+
+    /**
+     * Register the metadata of every binding in a profile (e.g. the game's default template)
+     * @param Profile The profile
+     * @return Number of bindings registered
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Definitions")
+    int32 RegisterDefinitionsFromProfile(const FS_InputProfile &Profile);
+
+    /** Dense index of an action, INDEX_NONE if not registered */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Definitions")
+    int32 GetActionIndex(const FName &ActionName) const;
+
+    /**
+     * Stable id of an action name: CRC32 of the lower-cased name, identical in every session and build
+     * Blueprint action nodes bake it in at compile time and call the *ById fast paths with it.
+     */
+    static int32 MakeActionId(const FName &ActionName);
+
+    /** Name of the action at Index, NAME_None if out of range */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Definitions")
+    FName GetActionName(int32 ActionIndex) const;
+
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Definitions")
+    bool GetDefinition(const FName &ActionName, FS_InputActionDefinition &OutDefinition) const;
+
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Definitions")
+    int32 GetDefinitionCount() const { return Definitions.Num(); }
+
+    /** Lookups without copying; pointers are invalidated by the next registration */
+    const FS_InputActionDefinition *FindDefinition(const FName &ActionName) const;
+    const FS_InputActionDefinition *FindDefinitionByIndex(int32 ActionIndex) const;
+
+    /** Drop every definition (indices restart at 0) */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Definitions")
+    void ResetDefinitions();
+
+    /** Bumped by every registration and reset; caches of definition-expanded data compare against it */
+    uint32 GetRevision() const { return Revision; }
+
+private:
+    /** Definitions by dense index */
+    UPROPERTY()
+    TArray<FS_InputActionDefinition> Definitions;
+
+    TMap<FName, int32> IndexByName;
+
+    uint32 Revision = 0;
+};
@@ -5,9 +5,238 @@
  */
 
 #include "Manager/CPP_InputAnalytics.h"
+#include "P_MEIS_Memory.h"
+#include "Misc/MemStack.h"
+#include "Misc/Paths.h"
+#include "Misc/Guid.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+
+// ==================== Hold Histogram ====================
+
+namespace
+{
+const float HoldHistogramFirstBound = 0.01f;
+const float HoldHistogramGrowth = 1.2f;
+}
+
+float FInputHoldHistogram::GetBucketUpperBound(int32 Bucket)
+{
+return HoldHistogramFirstBound * FMath::Pow(HoldHistogramGrowth, static_cast<float>(Bucket));
+}
+
+void FInputHoldHistogram::Add(float Seconds)
+{
+int32 Bucket = 0;
+if (Seconds > HoldHistogramFirstBound)
+{
+Bucket = FMath::CeilToInt(FMath::Loge(Seconds / HoldHistogramFirstBound) / FMath::Loge(HoldHistogramGrowth));
+}
+Counts[FMath::Clamp(Bucket, 0, NumBuckets - 1)]++;
+Total++;
+}
+
+void FInputHoldHistogram::Merge(const FInputHoldHistogram& Other)
+{
+for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+{
+Counts[Bucket] += Other.Counts[Bucket];
+}
+Total += Other.Total;
+}
+
+float FInputHoldHistogram::GetPercentile(float Percentile) const
+{
+if (Total == 0)
+{
+return 0.0f;
+}
+
+const uint64 Rank = FMath::Max<uint64>(1, FMath::CeilToInt64(Total * FMath::Clamp(Percentile, 0.0f, 100.0f) / 100.0));
+uint64 Seen = 0;
+for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+{
+Seen += Counts[Bucket];
+if (Seen >= Rank)
+{
+return GetBucketUpperBound(Bucket);
+}
+}
+return GetBucketUpperBound(NumBuckets - 1);
+}
+
+TArray<TSharedPtr<FJsonValue>> FInputHoldHistogram::ToJson() const
+{
+int32 Used = NumBuckets;
+while (Used > 0 && Counts[Used - 1] == 0)
+{
+--Used;
+}
+
+TArray<TSharedPtr<FJsonValue>> Values;
+Values.Reserve(Used);
+for (int32 Bucket = 0; Bucket < Used; ++Bucket)
+{
+Values.Add(MakeShareable(new FJsonValueNumber(Counts[Bucket])));
+}
+return Values;
+}
+
+void FInputHoldHistogram::FromJson(const TArray<TSharedPtr<FJsonValue>>& Values)
+{
+*this = FInputHoldHistogram();
+for (int32 Bucket = 0; Bucket < FMath::Min(Values.Num(), NumBuckets); ++Bucket)
+{
+Counts[Bucket] = static_cast<uint32>(FMath::Max(0.0, Values[Bucket]->AsNumber()));
+Total += Counts[Bucket];
+}
+}
+
+// ==================== Summary ====================
+
+void FInputAnalyticsSummary::Merge(const FInputAnalyticsSummary& Other)
+{
+Sessions += Other.Sessions;
+DurationSeconds += Other.DurationSeconds;
+
+for (const TPair<FName, FInputKeyUsageTotals>& Pair : Other.Keys)
+{
+FInputKeyUsageTotals& Totals = Keys.FindOrAdd(Pair.Key);
+Totals.Presses += Pair.Value.Presses;
+Totals.HoldSeconds += Pair.Value.HoldSeconds;
+Totals.HoldTimes.Merge(Pair.Value.HoldTimes);
+}
+
+for (const TPair<FName, FInputActionUsageTotals>& Pair : Other.Actions)
+{
+FInputActionUsageTotals& Totals = Actions.FindOrAdd(Pair.Key);
+for (const TPair<FName, int64>& Context : Pair.Value.UsesPerContext)
+{
+Totals.UsesPerContext.FindOrAdd(Context.Key) += Context.Value;
+}
+Totals.Rebinds += Pair.Value.Rebinds;
+Totals.SessionsRebound += Pair.Value.SessionsRebound;
+Totals.HoldTimes.Merge(Pair.Value.HoldTimes);
+}
+}
+
+TSharedRef<FJsonObject> FInputAnalyticsSummary::ToJson() const
+{
+TSharedRef<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
+JsonObject->SetNumberField(TEXT("Version"), FormatVersion);
+JsonObject->SetNumberField(TEXT("Sessions"), Sessions);
+JsonObject->SetNumberField(TEXT("DurationSeconds"), DurationSeconds);
+
+TArray<TSharedPtr<FJsonValue>> KeysArray;
+for (const TPair<FName, FInputKeyUsageTotals>& Pair : Keys)
+{
+TSharedPtr<FJsonObject> KeyObj = MakeShareable(new FJsonObject());
+KeyObj->SetStringField(TEXT("Key"), Pair.Key.ToString());
+KeyObj->SetNumberField(TEXT("Presses"), static_cast<double>(Pair.Value.Presses));
+KeyObj->SetNumberField(TEXT("HoldSeconds"), Pair.Value.HoldSeconds);
+KeyObj->SetArrayField(TEXT("HoldHistogram"), Pair.Value.HoldTimes.ToJson());
+KeysArray.Add(MakeShareable(new FJsonValueObject(KeyObj)));
+}
+JsonObject->SetArrayField(TEXT("Keys"), KeysArray);
+
+TArray<TSharedPtr<FJsonValue>> ActionsArray;
+for (const TPair<FName, FInputActionUsageTotals>& Pair : Actions)
+{
+TSharedPtr<FJsonObject> ActionObj = MakeShareable(new FJsonObject());
+ActionObj->SetStringField(TEXT("Action"), Pair.Key.ToString());
+
+TSharedPtr<FJsonObject> ContextsObj = MakeShareable(new FJsonObject());
+for (const TPair<FName, int64>& Context : Pair.Value.UsesPerContext)
+{
+ContextsObj->SetNumberField(Context.Key.ToString(), static_cast<double>(Context.Value));
+}
+ActionObj->SetObjectField(TEXT("Contexts"), ContextsObj);
+ActionObj->SetNumberField(TEXT("Rebinds"), static_cast<double>(Pair.Value.Rebinds));
+ActionObj->SetNumberField(TEXT("SessionsRebound"), Pair.Value.SessionsRebound);
+ActionObj->SetArrayField(TEXT("HoldHistogram"), Pair.Value.HoldTimes.ToJson());
+ActionsArray.Add(MakeShareable(new FJsonValueObject(ActionObj)));
+}
+JsonObject->SetArrayField(TEXT("Actions"), ActionsArray);
+
+return JsonObject;
+}
+
+bool FInputAnalyticsSummary::FromJson(const TSharedPtr<FJsonObject>& JsonObject)
+{
+int32 Version = 0;
+if (!JsonObject.IsValid() || !JsonObject->TryGetNumberField(TEXT("Version"), Version) || Version > FormatVersion)
+{
+return false;
+}
+
+*this = FInputAnalyticsSummary();
+JsonObject->TryGetNumberField(TEXT("Sessions"), Sessions);
+JsonObject->TryGetNumberField(TEXT("DurationSeconds"), DurationSeconds);
+
+const TArray<TSharedPtr<FJsonValue>>* KeysArray = nullptr;
+if (JsonObject->TryGetArrayField(TEXT("Keys"), KeysArray))
+{
+for (const TSharedPtr<FJsonValue>& KeyValue : *KeysArray)
+{
+const TSharedPtr<FJsonObject> KeyObj = KeyValue->AsObject();
+FString KeyName;
+if (!KeyObj.IsValid() || !KeyObj->TryGetStringField(TEXT("Key"), KeyName))
+{
+continue;
+}
+
+FInputKeyUsageTotals& Totals = Keys.FindOrAdd(FName(*KeyName));
+KeyObj->TryGetNumberField(TEXT("Presses"), Totals.Presses);
+KeyObj->TryGetNumberField(TEXT("HoldSeconds"), Totals.HoldSeconds);
+const TArray<TSharedPtr<FJsonValue>>* Histogram = nullptr;
+if (KeyObj->TryGetArrayField(TEXT("HoldHistogram"), Histogram))
+{
+Totals.HoldTimes.FromJson(*Histogram);
+}
+}
+}
+
+const TArray<TSharedPtr<FJsonValue>>* ActionsArray = nullptr;
+if (JsonObject->TryGetArrayField(TEXT("Actions"), ActionsArray))
+{
+for (const TSharedPtr<FJsonValue>& ActionValue : *ActionsArray)
+{
+const TSharedPtr<FJsonObject> ActionObj = ActionValue->AsObject();
+FString ActionName;
+if (!ActionObj.IsValid() || !ActionObj->TryGetStringField(TEXT("Action"), ActionName))
+{
+continue;
+}
+
+FInputActionUsageTotals& Totals = Actions.FindOrAdd(FName(*ActionName));
+const TSharedPtr<FJsonObject>* ContextsObj = nullptr;
+if (ActionObj->TryGetObjectField(TEXT("Contexts"), ContextsObj))
+{
+for (const TPair<FString, TSharedPtr<FJsonValue>>& Context : (*ContextsObj)->Values)
+{
+Totals.UsesPerContext.Add(FName(*Context.Key), static_cast<int64>(Context.Value->AsNumber()));
+}
+}
+ActionObj->TryGetNumberField(TEXT("Rebinds"), Totals.Rebinds);
+ActionObj->TryGetNumberField(TEXT("SessionsRebound"), Totals.SessionsRebound);
+const TArray<TSharedPtr<FJsonValue>>* Histogram = nullptr;
+if (ActionObj->TryGetArrayField(TEXT("HoldHistogram"), Histogram))
+{
+Totals.HoldTimes.FromJson(*Histogram);
+}
+}
+}
+return true;
+}
+
+// ==================== Keys ====================
 
 void UCPP_InputAnalytics::RecordKeyPress(const FKey& Key)
 {
+LLM_SCOPE_BYTAG(PMEIS_Analytics);
 if (!KeyUsageMap.Contains(Key))
 {
 KeyUsageMap.Add(Key, FS_KeyUsageData());
@@ -18,19 +247,29 @@ FS_KeyUsageData& Data = KeyUsageMap[Key];
 Data.PressCount++;
 Data.LastUsedTime = FPlatformTime::Seconds();
 Data.bIsHeld = true;
+KeyPressedAt.Add(Key, FPlatformTime::Seconds());
 }
 
 void UCPP_InputAnalytics::RecordKeyRelease(const FKey& Key)
 {
+LLM_SCOPE_BYTAG(PMEIS_Analytics);
 if (KeyUsageMap.Contains(Key))
 {
 FS_KeyUsageData& Data = KeyUsageMap[Key];
+double PressedAt = 0.0;
+if (Data.bIsHeld && KeyPressedAt.RemoveAndCopyValue(Key, PressedAt))
+{
+const float HoldTime = static_cast<float>(FPlatformTime::Seconds() - PressedAt);
+Data.TotalHoldTime += HoldTime;
+KeyHoldTimes.FindOrAdd(Key).Add(HoldTime);
+}
 Data.bIsHeld = false;
 }
 }
 
 void UCPP_InputAnalytics::RecordAxisInput(const FName& AxisName, float Value)
 {
+LLM_SCOPE_BYTAG(PMEIS_Analytics);
 // Advanced axis analytics could be implemented here
 UE_LOG(LogTemp, Verbose, TEXT("P_MEIS: Axis input recorded - %s: %f"), *AxisName.ToString(), Value);
 }
@@ -50,8 +289,10 @@ void UCPP_InputAnalytics::GetMostUsedKeys(int32 Count, TArray<FKey>& OutKeys)
 {
 OutKeys.Empty();
 
-// Sort by press count
-TArray<TPair<FKey, int32>> SortedKeys;
+// Sort by press count (scratch lives on the mem stack until Mark goes out of scope)
+FMemMark Mark(FMemStack::Get());
+TArray<TPair<FKey, int32>, TMemStackAllocator<>> SortedKeys;
+SortedKeys.Reserve(KeyUsageMap.Num());
 for (const auto& Pair : KeyUsageMap)
 {
 SortedKeys.Add(TPair<FKey, int32>(Pair.Key, Pair.Value.PressCount));
@@ -62,6 +303,7 @@ SortedKeys.Sort([](const TPair<FKey, int32>& A, const TPair<FKey, int32>& B)
 return A.Value > B.Value;
 });
 
+OutKeys.Reserve(FMath::Clamp(Count, 0, SortedKeys.Num()));
 for (int32 i = 0; i < FMath::Min(Count, SortedKeys.Num()); ++i)
 {
 OutKeys.Add(SortedKeys[i].Key);
@@ -72,7 +314,9 @@ void UCPP_InputAnalytics::GetLeastUsedKeys(int32 Count, TArray<FKey>& OutKeys)
 {
 OutKeys.Empty();
 
-TArray<TPair<FKey, int32>> SortedKeys;
+FMemMark Mark(FMemStack::Get());
+TArray<TPair<FKey, int32>, TMemStackAllocator<>> SortedKeys;
+SortedKeys.Reserve(KeyUsageMap.Num());
 for (const auto& Pair : KeyUsageMap)
 {
 SortedKeys.Add(TPair<FKey, int32>(Pair.Key, Pair.Value.PressCount));
@@ -83,6 +327,7 @@ SortedKeys.Sort([](const TPair<FKey, int32>& A, const TPair<FKey, int32>& B)
 return A.Value < B.Value;
 });
 
+OutKeys.Reserve(FMath::Clamp(Count, 0, SortedKeys.Num()));
 for (int32 i = 0; i < FMath::Min(Count, SortedKeys.Num()); ++i)
 {
 OutKeys.Add(SortedKeys[i].Key);
@@ -92,6 +337,10 @@ OutKeys.Add(SortedKeys[i].Key);
 void UCPP_InputAnalytics::ResetAnalytics()
 {
 KeyUsageMap.Empty();
+KeyHoldTimes.Empty();
+KeyPressedAt.Empty();
+ActionUsage.Empty();
+SessionStartTime = FPlatformTime::Seconds();
 LatencyHistory.Empty();
 TotalFrameLatency = 0.0f;
 FrameCount = 0;
@@ -107,3 +356,97 @@ return 0.0f;
 
 return TotalFrameLatency / static_cast<float>(FrameCount);
 }
+
+// ==================== Actions ====================
+
+void UCPP_InputAnalytics::RecordActionPress(FName ActionName, FName Context)
+{
+LLM_SCOPE_BYTAG(PMEIS_Analytics);
+FActionSessionUsage& Usage = ActionUsage.FindOrAdd(ActionName);
+Usage.Totals.UsesPerContext.FindOrAdd(Context)++;
+Usage.PressedAt = FPlatformTime::Seconds();
+}
+
+void UCPP_InputAnalytics::RecordActionRelease(FName ActionName)
+{
+FActionSessionUsage* Usage = ActionUsage.Find(ActionName);
+if (Usage && Usage->PressedAt > 0.0)
+{
+Usage->Totals.HoldTimes.Add(static_cast<float>(FPlatformTime::Seconds() - Usage->PressedAt));
+Usage->PressedAt = 0.0;
+}
+}
+
+void UCPP_InputAnalytics::RecordRebind(FName ActionName)
+{
+LLM_SCOPE_BYTAG(PMEIS_Analytics);
+ActionUsage.FindOrAdd(ActionName).Totals.Rebinds++;
+}
+
+// ==================== Session Files ====================
+
+FInputAnalyticsSummary UCPP_InputAnalytics::BuildSessionSummary() const
+{
+FInputAnalyticsSummary Summary;
+Summary.Sessions = 1;
+Summary.DurationSeconds = FPlatformTime::Seconds() - SessionStartTime;
+
+for (const TPair<FKey, FS_KeyUsageData>& Pair : KeyUsageMap)
+{
+FInputKeyUsageTotals& Totals = Summary.Keys.FindOrAdd(Pair.Key.GetFName());
+Totals.Presses = Pair.Value.PressCount;
+Totals.HoldSeconds = Pair.Value.TotalHoldTime;
+if (const FInputHoldHistogram* HoldTimes = KeyHoldTimes.Find(Pair.Key))
+{
+Totals.HoldTimes = *HoldTimes;
+}
+}
+
+for (const TPair<FName, FActionSessionUsage>& Pair : ActionUsage)
+{
+FInputActionUsageTotals& Totals = Summary.Actions.Add(Pair.Key, Pair.Value.Totals);
+Totals.SessionsRebound = Totals.Rebinds > 0 ? 1 : 0;
+}
+return Summary;
+}
+
+FString UCPP_InputAnalytics::GetSessionDirectory()
+{
+return FPaths::ProjectSavedDir() + TEXT("InputAnalytics/");
+}
+
+FString UCPP_InputAnalytics::SaveSession(EP_MEIS_CompressionFormat Format)
+{
+LLM_SCOPE_BYTAG(PMEIS_Analytics);
+FString Json;
+const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+if (!FJsonSerializer::Serialize(BuildSessionSummary().ToJson(), Writer))
+{
+return FString();
+}
+
+// Unique per session so files from many machines can be pooled into one folder
+const FString FilePath = GetSessionDirectory() / FString::Printf(TEXT("Session_%s_%s.json"),
+*FDateTime::UtcNow().ToString(TEXT("%Y%m%d-%H%M%S")), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+if (!UCPP_InputCompressedFile::SaveStringToFile(Json, FilePath, Format))
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to write analytics session %s"), *FilePath);
+return FString();
+}
+
+UE_LOG(LogTemp, Log, TEXT("P_MEIS: Analytics session saved to %s"), *FilePath);
+return FilePath;
+}
+
+bool UCPP_InputAnalytics::LoadSessionFile(const FString& FilePath, FInputAnalyticsSummary& OutSummary)
+{
+FString Json;
+if (!UCPP_InputCompressedFile::LoadFileToString(Json, FilePath))
+{
+return false;
+}
+
+TSharedPtr<FJsonObject> JsonObject;
+const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+return FJsonSerializer::Deserialize(Reader, JsonObject) && OutSummary.FromJson(JsonObject);
+}
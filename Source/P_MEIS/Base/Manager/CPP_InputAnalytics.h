@@ -7,8 +7,79 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Storage/CPP_InputCompressedFile.h"
 #include "CPP_InputAnalytics.generated.h"
 
+class FJsonObject;
+class FJsonValue;
+
+/**
+ * Hold durations in fixed log-spaced buckets (10 ms .. ~60 s, 20% wide)
+ * Constant size and mergeable, so percentiles survive aggregation across any number of sessions.
+ */
+struct P_MEIS_API FInputHoldHistogram
+{
+static constexpr int32 NumBuckets = 48;
+
+uint32 Counts[NumBuckets] = {};
+uint32 Total = 0;
+
+void Add(float Seconds);
+void Merge(const FInputHoldHistogram& Other);
+
+/** Upper edge of the bucket holding the given percentile (0..100); 0 when empty */
+float GetPercentile(float Percentile) const;
+
+/** Counts with trailing empty buckets dropped */
+TArray<TSharedPtr<FJsonValue>> ToJson() const;
+void FromJson(const TArray<TSharedPtr<FJsonValue>>& Values);
+
+static float GetBucketUpperBound(int32 Bucket);
+};
+
+/**
+ * Usage of one key summed over sessions
+ */
+struct FInputKeyUsageTotals
+{
+int64 Presses = 0;
+double HoldSeconds = 0.0;
+FInputHoldHistogram HoldTimes;
+};
+
+/**
+ * Usage of one action summed over sessions
+ */
+struct FInputActionUsageTotals
+{
+/** Presses per input context the player was in */
+TMap<FName, int64> UsesPerContext;
+int64 Rebinds = 0;
+
+/** Sessions in which the action was rebound at least once */
+int32 SessionsRebound = 0;
+FInputHoldHistogram HoldTimes;
+};
+
+/**
+ * Mergeable usage summary: what a session file holds, and what aggregation builds from many
+ * Memory is bounded by the number of distinct keys, actions and contexts, not by sessions or presses.
+ */
+struct P_MEIS_API FInputAnalyticsSummary
+{
+static constexpr int32 FormatVersion = 1;
+
+int32 Sessions = 0;
+double DurationSeconds = 0.0;
+TMap<FName, FInputKeyUsageTotals> Keys;
+TMap<FName, FInputActionUsageTotals> Actions;
+
+void Merge(const FInputAnalyticsSummary& Other);
+
+TSharedRef<FJsonObject> ToJson() const;
+bool FromJson(const TSharedPtr<FJsonObject>& JsonObject);
+};
+
 /**
  * Structure for tracking individual key usage
  */
@@ -66,10 +137,55 @@ void ResetAnalytics();
 UFUNCTION(BlueprintCallable, Category = "Input Binding|Analytics")
 float GetAverageLatency() const;
 
+// ==================== Actions (fed by integrations while recording) ====================
+
+void RecordActionPress(FName ActionName, FName Context);
+void RecordActionRelease(FName ActionName);
+
+UFUNCTION(BlueprintCallable, Category = "Input Binding|Analytics")
+void RecordRebind(FName ActionName);
+
+// ==================== Session Files ====================
+
+/** This session so far, in the session file's mergeable form */
+FInputAnalyticsSummary BuildSessionSummary() const;
+
+/**
+ * Write this session to a new file in GetSessionDirectory() (aggregate many with -run=CPP_InputAnalyticsAggregate)
+ * @return Path written, empty on failure
+ */
+UFUNCTION(BlueprintCallable, Category = "Input Binding|Analytics")
+FString SaveSession(EP_MEIS_CompressionFormat Format = EP_MEIS_CompressionFormat::Zlib);
+
+static FString GetSessionDirectory();
+
+/** Session files are named Session_<time>_<guid>.json */
+static const TCHAR* GetSessionFilePattern() { return TEXT("Session_*.json"); }
+
+/** Read one session file (plain or compressed) */
+static bool LoadSessionFile(const FString& FilePath, FInputAnalyticsSummary& OutSummary);
+
 private:
 UPROPERTY()
 TMap<FKey, FS_KeyUsageData> KeyUsageMap;
 
+TMap<FKey, FInputHoldHistogram> KeyHoldTimes;
+
+/** Full-precision press times of held keys (LastUsedTime is a float and too coarse for hold durations) */
+TMap<FKey, double> KeyPressedAt;
+
+struct FActionSessionUsage
+{
+FInputActionUsageTotals Totals;
+
+/** Press time while held, 0 otherwise */
+double PressedAt = 0.0;
+};
+
+TMap<FName, FActionSessionUsage> ActionUsage;
+
+double SessionStartTime = FPlatformTime::Seconds();
+
 UPROPERTY()
 TArray<float> LatencyHistory;
 
@@ -0,0 +1,218 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Commandlet aggregating saved input analytics sessions into usage reports
+ * @Date: 19/10/2026
+ */
+
+#include "Manager/CPP_InputAnalyticsAggregateCommandlet.h"
+#include "Manager/CPP_InputAnalytics.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Async/ParallelFor.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+#include "HAL/ThreadSafeCounter.h"
+
+namespace
+{
+const float ReportPercentiles[] = {50.0f, 90.0f, 99.0f};
+
+void AddPercentiles(const TSharedPtr<FJsonObject> &JsonObject, const FInputHoldHistogram &Histogram)
+{
+    for (const float Percentile : ReportPercentiles)
+    {
+        JsonObject->SetNumberField(FString::Printf(TEXT("HoldP%d"), FMath::RoundToInt(Percentile)), Histogram.GetPercentile(Percentile));
+    }
+}
+
+FString HoldPercentilesCsv(const FInputHoldHistogram &Histogram)
+{
+    FString Row;
+    for (const float Percentile : ReportPercentiles)
+    {
+        Row += FString::Printf(TEXT(",%.3f"), Histogram.GetPercentile(Percentile));
+    }
+    return Row;
+}
+}
+
+UCPP_InputAnalyticsAggregateCommandlet::UCPP_InputAnalyticsAggregateCommandlet()
+{
+    IsClient = false;
+    IsEditor = false;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UCPP_InputAnalyticsAggregateCommandlet::Main(const FString &Params)
+{
+    FString InputDir = UCPP_InputAnalytics::GetSessionDirectory();
+    FString OutputDir = UCPP_InputAnalytics::GetSessionDirectory() / TEXT("Reports");
+    FString Format = TEXT("all");
+    FParse::Value(*Params, TEXT("Input="), InputDir);
+    FParse::Value(*Params, TEXT("Output="), OutputDir);
+    FParse::Value(*Params, TEXT("Format="), Format);
+
+    const bool bJson = Format == TEXT("json") || Format == TEXT("all");
+    const bool bCsv = Format == TEXT("csv") || Format == TEXT("all");
+    if (!bJson && !bCsv)
+    {
+        UE_LOG(LogTemp, Error, TEXT("P_MEIS: Unknown -Format=%s (expected csv, json or all)"), *Format);
+        return 1;
+    }
+
+    TArray<FString> Files;
+    IFileManager::Get().FindFilesRecursive(Files, *InputDir, UCPP_InputAnalytics::GetSessionFilePattern(), true, false);
+    if (Files.Num() == 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("P_MEIS: No analytics sessions found in %s"), *InputDir);
+        return 1;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("P_MEIS: Aggregating %d analytics sessions from %s"), Files.Num(), *InputDir);
+
+    // One running summary per worker; each file is parsed, folded in and released before the next
+    TArray<FInputAnalyticsSummary> WorkerSummaries;
+    FThreadSafeCounter FilesFailed;
+    ParallelForWithTaskContext(WorkerSummaries, Files.Num(),
+                               [&Files, &FilesFailed](FInputAnalyticsSummary &WorkerSummary, int32 Index)
+                               {
+                                   FInputAnalyticsSummary Session;
+                                   if (UCPP_InputAnalytics::LoadSessionFile(Files[Index], Session))
+                                   {
+                                       WorkerSummary.Merge(Session);
+                                   }
+                                   else
+                                   {
+                                       FilesFailed.Increment();
+                                       UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Skipping unreadable analytics session %s"), *Files[Index]);
+                                   }
+                               });
+
+    FInputAnalyticsSummary Total;
+    for (const FInputAnalyticsSummary &WorkerSummary : WorkerSummaries)
+    {
+        Total.Merge(WorkerSummary);
+    }
+
+    const int32 Failed = FilesFailed.GetValue();
+    UE_LOG(LogTemp, Display, TEXT("P_MEIS: Merged %d sessions (%d unreadable): %d keys, %d actions"),
+           Total.Sessions, Failed, Total.Keys.Num(), Total.Actions.Num());
+
+    bool bWritten = true;
+    if (bJson)
+    {
+        bWritten &= WriteJsonReport(Total, Failed, OutputDir);
+    }
+    if (bCsv)
+    {
+        bWritten &= WriteCsvReports(Total, OutputDir);
+    }
+
+    if (!bWritten)
+    {
+        UE_LOG(LogTemp, Error, TEXT("P_MEIS: Failed to write analytics reports to %s"), *OutputDir);
+        return 1;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("P_MEIS: Analytics reports written to %s"), *OutputDir);
+    return 0;
+}
+
+bool UCPP_InputAnalyticsAggregateCommandlet::WriteJsonReport(const FInputAnalyticsSummary &Summary, int32 FilesFailed, const FString &OutputDir)
+{
+    // The mergeable summary, plus read-ready hold percentiles next to each histogram
+    TSharedRef<FJsonObject> Report = Summary.ToJson();
+    Report->SetNumberField(TEXT("FilesFailed"), FilesFailed);
+
+    for (const TSharedPtr<FJsonValue> &Value : Report->GetArrayField(TEXT("Keys")))
+    {
+        const TSharedPtr<FJsonObject> &KeyObj = Value->AsObject();
+        if (const FInputKeyUsageTotals *Totals = Summary.Keys.Find(FName(*KeyObj->GetStringField(TEXT("Key")))))
+        {
+            AddPercentiles(KeyObj, Totals->HoldTimes);
+        }
+    }
+
+    for (const TSharedPtr<FJsonValue> &Value : Report->GetArrayField(TEXT("Actions")))
+    {
+        const TSharedPtr<FJsonObject> &ActionObj = Value->AsObject();
+        if (const FInputActionUsageTotals *Totals = Summary.Actions.Find(FName(*ActionObj->GetStringField(TEXT("Action")))))
+        {
+            AddPercentiles(ActionObj, Totals->HoldTimes);
+            ActionObj->SetNumberField(TEXT("RebindsPerSession"), Summary.Sessions > 0 ? double(Totals->Rebinds) / Summary.Sessions : 0.0);
+        }
+    }
+
+    FString Json;
+    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+    return FJsonSerializer::Serialize(Report, Writer) &&
+           FFileHelper::SaveStringToFile(Json, *(OutputDir / TEXT("InputAnalyticsReport.json")));
+}
+
+bool UCPP_InputAnalyticsAggregateCommandlet::WriteCsvReports(const FInputAnalyticsSummary &Summary, const FString &OutputDir)
+{
+    // Key usage distribution, most pressed first
+    TArray<FName> Keys;
+    Summary.Keys.GetKeys(Keys);
+    Keys.Sort([&Summary](const FName &A, const FName &B)
+              { return Summary.Keys[A].Presses > Summary.Keys[B].Presses; });
+
+    int64 TotalPresses = 0;
+    for (const TPair<FName, FInputKeyUsageTotals> &Pair : Summary.Keys)
+    {
+        TotalPresses += Pair.Value.Presses;
+    }
+
+    FString KeyCsv = TEXT("Key,Presses,Share,HoldSeconds\n");
+    for (const FName &Key : Keys)
+    {
+        const FInputKeyUsageTotals &Totals = Summary.Keys[Key];
+        KeyCsv += FString::Printf(TEXT("%s,%lld,%.6f,%.3f\n"), *Key.ToString(), Totals.Presses,
+                                  TotalPresses > 0 ? double(Totals.Presses) / TotalPresses : 0.0, Totals.HoldSeconds);
+    }
+
+    // Action usage per context, and rebind frequency
+    TArray<FName> Actions;
+    Summary.Actions.GetKeys(Actions);
+    Actions.Sort(FNameLexicalLess());
+
+    FString ActionCsv = TEXT("Action,Context,Uses\n");
+    FString RebindCsv = TEXT("Action,Rebinds,RebindsPerSession,SessionsRebound,SessionsReboundShare\n");
+    for (const FName &Action : Actions)
+    {
+        const FInputActionUsageTotals &Totals = Summary.Actions[Action];
+        for (const TPair<FName, int64> &Context : Totals.UsesPerContext)
+        {
+            ActionCsv += FString::Printf(TEXT("%s,%s,%lld\n"), *Action.ToString(), *Context.Key.ToString(), Context.Value);
+        }
+
+        if (Totals.Rebinds > 0)
+        {
+            RebindCsv += FString::Printf(TEXT("%s,%lld,%.6f,%d,%.6f\n"), *Action.ToString(), Totals.Rebinds,
+                                         Summary.Sessions > 0 ? double(Totals.Rebinds) / Summary.Sessions : 0.0, Totals.SessionsRebound,
+                                         Summary.Sessions > 0 ? double(Totals.SessionsRebound) / Summary.Sessions : 0.0);
+        }
+    }
+
+    // Hold-time percentiles (bucket upper edges, seconds)
+    FString HoldCsv = TEXT("Type,Name,Samples,P50,P90,P99\n");
+    for (const FName &Key : Keys)
+    {
+        const FInputHoldHistogram &HoldTimes = Summary.Keys[Key].HoldTimes;
+        HoldCsv += FString::Printf(TEXT("Key,%s,%u"), *Key.ToString(), HoldTimes.Total) + HoldPercentilesCsv(HoldTimes) + TEXT("\n");
+    }
+    for (const FName &Action : Actions)
+    {
+        const FInputHoldHistogram &HoldTimes = Summary.Actions[Action].HoldTimes;
+        HoldCsv += FString::Printf(TEXT("Action,%s,%u"), *Action.ToString(), HoldTimes.Total) + HoldPercentilesCsv(HoldTimes) + TEXT("\n");
+    }
+
+    return FFileHelper::SaveStringToFile(KeyCsv, *(OutputDir / TEXT("KeyUsage.csv"))) &&
+           FFileHelper::SaveStringToFile(ActionCsv, *(OutputDir / TEXT("ActionUsage.csv"))) &&
+           FFileHelper::SaveStringToFile(RebindCsv, *(OutputDir / TEXT("Rebinds.csv"))) &&
+           FFileHelper::SaveStringToFile(HoldCsv, *(OutputDir / TEXT("HoldTimes.csv")));
+}
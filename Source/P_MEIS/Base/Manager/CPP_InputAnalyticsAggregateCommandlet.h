@@ -0,0 +1,37 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Commandlet aggregating saved input analytics sessions into usage reports
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CPP_InputAnalyticsAggregateCommandlet.generated.h"
+
+struct FInputAnalyticsSummary;
+
+/**
+ * Merges every analytics session file under a folder into one report
+ *
+ * UnrealEditor-Cmd <Project> -run=CPP_InputAnalyticsAggregate [-Input=<Dir>] [-Output=<Dir>] [-Format=csv|json|all]
+ *
+ * Files are read in parallel, one at a time per worker, and folded into a per-worker summary, so memory
+ * stays bounded by the number of distinct keys/actions however many sessions are ingested.
+ * Writes InputAnalyticsReport.json and/or KeyUsage.csv, ActionUsage.csv, Rebinds.csv and HoldTimes.csv.
+ */
+UCLASS()
+class P_MEIS_API UCPP_InputAnalyticsAggregateCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UCPP_InputAnalyticsAggregateCommandlet();
+
+    virtual int32 Main(const FString &Params) override;
+
+private:
+    static bool WriteJsonReport(const FInputAnalyticsSummary &Summary, int32 FilesFailed, const FString &OutputDir);
+    static bool WriteCsvReports(const FInputAnalyticsSummary &Summary, const FString &OutputDir);
+};
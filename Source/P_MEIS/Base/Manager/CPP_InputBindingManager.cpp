@@ -1,4 +1,4 @@
-/*
+﻿/*
  * @Author: Punal Manalan
  * @Description: Input Binding Manager Implementation - Per-Player Profile + Integration Architecture
  * @Date: 06/12/2025
@@ -6,15 +6,40 @@
 
 #include "Manager/CPP_InputBindingManager.h"
 #include "Integration/CPP_EnhancedInputIntegration.h"
+#include "Integration/CPP_InputActionAssetRegistry.h"
+#include "Manager/CPP_InputActionDefinitionRegistry.h"
+#include "Manager/CPP_InputContextManager.h"
+#include "Manager/CPP_InputAnalytics.h"
+#include "Integration/InputMappingRebuildBatcher.h"
 #include "Storage/CPP_InputProfileStorage.h"
+#include "Storage/CPP_InputStorageBackend.h"
 #include "Validation/CPP_InputValidator.h"
+#include "P_MEIS_Memory.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Controller.h"
+#include "GameFramework/PlayerState.h"
+#include "Misc/MemStack.h"
 
 void UCPP_InputBindingManager::Initialize(FSubsystemCollectionBase &Collection)
 {
     Super::Initialize(Collection);
 
+    // Resolve authored Input Action assets in the background; profiles applied before this
+    // completes fall back to dynamic actions and are re-applied once the assets arrive
+    ActionAssetRegistry = NewObject<UCPP_InputActionAssetRegistry>(this);
+    ActionAssetRegistry->OnAssetsResolved.AddUObject(this, &UCPP_InputBindingManager::HandleActionAssetsResolved);
+    ActionAssetRegistry->LoadAssetsAsync();
+
+    // Definitions must be in place before the first profile load: saved bindings omit what matches them
+    ActionDefinitionRegistry = NewObject<UCPP_InputActionDefinitionRegistry>(this);
+    ActionDefinitionRegistry->LoadConfiguredTables();
+    UCPP_InputProfileStorage::SetActionDefinitionRegistry(ActionDefinitionRegistry);
+
+    ContextManager = NewObject<UCPP_InputContextManager>(this);
+    ContextManager->Initialize(this);
+
+    Analytics = NewObject<UCPP_InputAnalytics>(this);
+
     // Load default template
     if (!LoadDefaultTemplate())
     {
@@ -33,6 +58,16 @@ void UCPP_InputBindingManager::Initialize(FSubsystemCollectionBase &Collection)
 
 void UCPP_InputBindingManager::Deinitialize()
 {
+    DisableSharedKeyboardSplit();
+    FlushPlayerCache();
+
+    if (bRecordingAnalytics)
+    {
+        SaveAnalyticsSession();
+        SetAnalyticsRecording(false);
+    }
+    Analytics = nullptr;
+
     // Clean up all player data
     for (auto &Pair : PlayerDataMap)
     {
@@ -57,14 +92,68 @@ void UCPP_InputBindingManager::Deinitialize()
 
     ProfileTemplates.Empty();
 
+    if (ActionAssetRegistry)
+    {
+        ActionAssetRegistry->ReleaseAssets();
+        ActionAssetRegistry = nullptr;
+    }
+
+    UCPP_InputProfileStorage::SetActionDefinitionRegistry(nullptr);
+    ActionDefinitionRegistry = nullptr;
+    ContextManager = nullptr;
+
+    // Release the backend from the root set
+    UCPP_InputProfileStorage::SetStorageBackend(nullptr);
+
     Super::Deinitialize();
     UE_LOG(LogTemp, Log, TEXT("P_MEIS: Input Binding Manager Deinitialized"));
 }
 
+void UCPP_InputBindingManager::HandleActionAssetsResolved()
+{
+    auto HasBindings = [](const FS_InputProfile &Profile)
+    { return Profile.ActionBindings.Num() > 0 || Profile.AxisBindings.Num() > 0; };
+
+    // Re-apply profiles that were applied with dynamic actions before the assets were loaded
+    int32 ReappliedCount = 0;
+    for (auto &Pair : PlayerDataMap)
+    {
+        if (Pair.Key && Pair.Value.IsValid() && Pair.Value.Integration->GetMappingContext() && HasBindings(Pair.Value.ActiveProfile))
+        {
+            uint32 ContextHash = 0;
+            const FS_InputProfile *ContextProfile = ContextManager ? ContextManager->GetActiveContextProfile(Pair.Key, ContextHash) : nullptr;
+            if (ContextProfile)
+            {
+                Pair.Value.Integration->ApplyProfileWithHash(*ContextProfile, ContextHash);
+            }
+            else
+            {
+                Pair.Value.Integration->ApplyProfile(Pair.Value.ActiveProfile);
+            }
+            ReappliedCount++;
+        }
+    }
+
+    for (auto &Pair : ControllerDataMap)
+    {
+        if (Pair.Key && Pair.Value.IsValid() && Pair.Value.Integration->GetMappingContext() && HasBindings(Pair.Value.ActiveProfile))
+        {
+            Pair.Value.Integration->ApplyProfile(Pair.Value.ActiveProfile);
+            ReappliedCount++;
+        }
+    }
+
+    if (ReappliedCount > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("P_MEIS: Re-applied %d profiles after Input Action assets resolved"), ReappliedCount);
+    }
+}
+
 // ==================== Player Management (Per-Player Data) ====================
 
 UCPP_EnhancedInputIntegration *UCPP_InputBindingManager::RegisterPlayer(APlayerController *PlayerController)
 {
+    LLM_SCOPE_BYTAG(PMEIS_UObjects);
     if (!PlayerController)
     {
         UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Cannot register null PlayerController"));
@@ -84,6 +173,13 @@ UCPP_EnhancedInputIntegration *UCPP_InputBindingManager::RegisterPlayer(APlayerC
         }
     }
 
+    // A returning user gets their cached profile and mappings back
+    if (UCPP_EnhancedInputIntegration *Reattached = ReattachDepartedPlayer(PlayerController))
+    {
+        Reattached->SetAnalytics(bRecordingAnalytics ? Analytics : nullptr);
+        return Reattached;
+    }
+
     // Create new Integration for this player
     UCPP_EnhancedInputIntegration *NewIntegration = NewObject<UCPP_EnhancedInputIntegration>();
     if (!NewIntegration)
@@ -96,7 +192,14 @@ UCPP_EnhancedInputIntegration *UCPP_InputBindingManager::RegisterPlayer(APlayerC
     NewIntegration->AddToRoot();
 
     // Set the player controller
+    NewIntegration->SetActionAssetRegistry(ActionAssetRegistry);
+    NewIntegration->SetTimingThresholds(TimingThresholds);
     NewIntegration->SetPlayerController(PlayerController);
+    NewIntegration->OnStickCalibrationUpdated.AddUObject(this, &UCPP_InputBindingManager::HandleStickCalibrationUpdated, NewIntegration);
+    if (bRecordingAnalytics)
+    {
+        NewIntegration->SetAnalytics(Analytics);
+    }
 
     // Create player data with empty profile
     FS_PlayerInputData PlayerData;
@@ -104,6 +207,7 @@ UCPP_EnhancedInputIntegration *UCPP_InputBindingManager::RegisterPlayer(APlayerC
     PlayerData.ActiveProfile = FS_InputProfile();
     PlayerData.ActiveProfile.ProfileName = FName(*FString::Printf(TEXT("Player_%s"), *PlayerController->GetName()));
     PlayerData.LoadedTemplateName = NAME_None;
+    PlayerData.CacheKey = GetPlayerCacheKey(PlayerController);
 
     // Store in map
     PlayerDataMap.Add(PlayerController, PlayerData);
@@ -117,6 +221,7 @@ UCPP_EnhancedInputIntegration *UCPP_InputBindingManager::RegisterPlayer(APlayerC
 
 UCPP_EnhancedInputIntegration *UCPP_InputBindingManager::RegisterController(AController *Controller)
 {
+    LLM_SCOPE_BYTAG(PMEIS_UObjects);
     if (!Controller)
     {
         UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Cannot register null Controller"));
@@ -142,6 +247,8 @@ UCPP_EnhancedInputIntegration *UCPP_InputBindingManager::RegisterController(ACon
     }
 
     NewIntegration->AddToRoot();
+    NewIntegration->SetActionAssetRegistry(ActionAssetRegistry);
+    NewIntegration->SetTimingThresholds(TimingThresholds);
     NewIntegration->SetController(Controller);
 
     FS_PlayerInputData ControllerData;
@@ -207,7 +314,10 @@ void UCPP_InputBindingManager::UnregisterPlayer(APlayerController *PlayerControl
 
     if (FS_PlayerInputData *PlayerData = PlayerDataMap.Find(PlayerController))
     {
-        if (PlayerData->Integration && PlayerData->Integration->IsValidLowLevel())
+        // PlayerState may already be gone during teardown; fall back to the key taken at registration
+        const FString CacheKey = GetPlayerCacheKey(PlayerController);
+        const bool bCached = CacheDepartedPlayer(CacheKey.IsEmpty() ? PlayerData->CacheKey : CacheKey, *PlayerData);
+        if (!bCached && PlayerData->Integration && PlayerData->Integration->IsValidLowLevel())
         {
             PlayerData->Integration->ClearAllMappings();
             PlayerData->Integration->RemoveFromRoot();
@@ -351,7 +461,8 @@ bool UCPP_InputBindingManager::HasPlayerModifiedProfile(APlayerController *Playe
 
 void UCPP_InputBindingManager::CleanupInvalidPlayers()
 {
-    TArray<APlayerController *> InvalidPlayers;
+    FMemMark Mark(FMemStack::Get());
+    TArray<APlayerController *, TMemStackAllocator<>> InvalidPlayers;
     for (const auto &Pair : PlayerDataMap)
     {
         if (!Pair.Key || !Pair.Key->IsValidLowLevel() || !Pair.Value.IsValid())
@@ -364,7 +475,9 @@ void UCPP_InputBindingManager::CleanupInvalidPlayers()
     {
         if (FS_PlayerInputData *PlayerData = PlayerDataMap.Find(PC))
         {
-            if (PlayerData->Integration && PlayerData->Integration->IsValidLowLevel())
+            // Destroyed controller (respawn/travel) - keep the user's data for their new controller
+            const bool bCached = CacheDepartedPlayer(PlayerData->CacheKey, *PlayerData);
+            if (!bCached && PlayerData->Integration && PlayerData->Integration->IsValidLowLevel())
             {
                 PlayerData->Integration->RemoveFromRoot();
             }
@@ -375,7 +488,8 @@ void UCPP_InputBindingManager::CleanupInvalidPlayers()
 
 void UCPP_InputBindingManager::CleanupInvalidControllers()
 {
-    TArray<AController *> InvalidControllers;
+    FMemMark Mark(FMemStack::Get());
+    TArray<AController *, TMemStackAllocator<>> InvalidControllers;
     for (const auto &Pair : ControllerDataMap)
     {
         if (!Pair.Key || !Pair.Key->IsValidLowLevel() || !Pair.Value.IsValid())
@@ -397,6 +511,141 @@ void UCPP_InputBindingManager::CleanupInvalidControllers()
     }
 }
 
+// ==================== Departed Player Cache ====================
+
+FString UCPP_InputBindingManager::GetPlayerCacheKey(const AController *Controller)
+{
+    if (!IsValid(Controller))
+    {
+        return FString();
+    }
+
+    if (const APlayerState *PlayerState = Controller->PlayerState)
+    {
+        const FUniqueNetIdRepl &NetId = PlayerState->GetUniqueId();
+        if (NetId.IsValid())
+        {
+            return TEXT("Net:") + NetId.ToString();
+        }
+    }
+
+    if (const APlayerController *PC = Cast<APlayerController>(Controller))
+    {
+        const FPlatformUserId UserId = PC->GetPlatformUserId();
+        if (UserId.IsValid())
+        {
+            return FString::Printf(TEXT("User:%d"), UserId.GetInternalId());
+        }
+    }
+
+    return FString();
+}
+
+void UCPP_InputBindingManager::SetPlayerCacheLifetime(float Seconds)
+{
+    PlayerCacheLifetime = FMath::Max(Seconds, 0.0f);
+    if (PlayerCacheLifetime <= 0.0f)
+    {
+        FlushPlayerCache();
+    }
+}
+
+void UCPP_InputBindingManager::FlushPlayerCache()
+{
+    for (auto &Pair : DepartedPlayers)
+    {
+        if (Pair.Value.Data.Integration && Pair.Value.Data.Integration->IsValidLowLevel())
+        {
+            Pair.Value.Data.Integration->RemoveFromRoot();
+            Pair.Value.Data.Integration->ConditionalBeginDestroy();
+        }
+    }
+    DepartedPlayers.Empty();
+}
+
+void UCPP_InputBindingManager::PurgeExpiredPlayerCache()
+{
+    const double Now = FPlatformTime::Seconds();
+    for (auto It = DepartedPlayers.CreateIterator(); It; ++It)
+    {
+        if (It.Value().ExpireTime > Now)
+        {
+            continue;
+        }
+
+        if (It.Value().Data.Integration && It.Value().Data.Integration->IsValidLowLevel())
+        {
+            It.Value().Data.Integration->RemoveFromRoot();
+            It.Value().Data.Integration->ConditionalBeginDestroy();
+        }
+        UE_LOG(LogTemp, Log, TEXT("P_MEIS: Cached player %s expired"), *It.Key());
+        It.RemoveCurrent();
+    }
+}
+
+bool UCPP_InputBindingManager::CacheDepartedPlayer(const FString &CacheKey, const FS_PlayerInputData &PlayerData)
+{
+    PurgeExpiredPlayerCache();
+
+    if (PlayerCacheLifetime <= 0.0f || CacheKey.IsEmpty() || !PlayerData.Integration || !PlayerData.Integration->IsValidLowLevel())
+    {
+        return false;
+    }
+
+    // A stale entry for the same user is replaced
+    if (FDepartedPlayerInput *Stale = DepartedPlayers.Find(CacheKey))
+    {
+        if (Stale->Data.Integration && Stale->Data.Integration != PlayerData.Integration && Stale->Data.Integration->IsValidLowLevel())
+        {
+            Stale->Data.Integration->RemoveFromRoot();
+            Stale->Data.Integration->ConditionalBeginDestroy();
+        }
+    }
+
+    PlayerData.Integration->DetachController();
+
+    FDepartedPlayerInput &Entry = DepartedPlayers.Add(CacheKey);
+    Entry.Data = PlayerData;
+    Entry.Data.CacheKey = CacheKey;
+    Entry.ExpireTime = FPlatformTime::Seconds() + PlayerCacheLifetime;
+
+    UE_LOG(LogTemp, Log, TEXT("P_MEIS: Cached departed player %s for %.0f s"), *CacheKey, PlayerCacheLifetime);
+    return true;
+}
+
+UCPP_EnhancedInputIntegration *UCPP_InputBindingManager::ReattachDepartedPlayer(APlayerController *PlayerController)
+{
+    if (DepartedPlayers.Num() == 0)
+    {
+        return nullptr;
+    }
+
+    PurgeExpiredPlayerCache();
+
+    const FString CacheKey = GetPlayerCacheKey(PlayerController);
+    FDepartedPlayerInput Departed;
+    if (CacheKey.IsEmpty() || !DepartedPlayers.RemoveAndCopyValue(CacheKey, Departed))
+    {
+        return nullptr;
+    }
+
+    UCPP_EnhancedInputIntegration *Integration = Departed.Data.Integration;
+    if (!Integration || !Integration->IsValidLowLevel())
+    {
+        return nullptr;
+    }
+
+    // Mapping context, actions and modifiers are reused as built; only the controller side is redone
+    Integration->SetTimingThresholds(TimingThresholds);
+    Integration->ReattachPlayerController(PlayerController);
+
+    FS_PlayerInputData &PlayerData = PlayerDataMap.Add(PlayerController, Departed.Data);
+    PlayerData.ActiveProfile.ProfileName = FName(*FString::Printf(TEXT("Player_%s"), *PlayerController->GetName()));
+
+    UE_LOG(LogTemp, Log, TEXT("P_MEIS: Reattached cached player %s to %s"), *CacheKey, *PlayerController->GetName());
+    return Integration;
+}
+
 FS_PlayerInputData *UCPP_InputBindingManager::GetPlayerData(APlayerController *PlayerController)
 {
     if (!PlayerController)
@@ -419,6 +668,7 @@ const FS_PlayerInputData *UCPP_InputBindingManager::GetPlayerData(APlayerControl
 
 bool UCPP_InputBindingManager::LoadProfileTemplate(const FName &TemplateName)
 {
+    LLM_SCOPE_BYTAG(PMEIS_Templates);
     FS_InputProfile Profile;
     if (UCPP_InputProfileStorage::LoadProfile(TemplateName, Profile))
     {
@@ -429,8 +679,29 @@ bool UCPP_InputBindingManager::LoadProfileTemplate(const FName &TemplateName)
     return false;
 }
 
+void UCPP_InputBindingManager::LoadProfileTemplateAsync(const FName &TemplateName, TFunction<void(bool bSuccess)> OnComplete)
+{
+    TWeakObjectPtr<UCPP_InputBindingManager> WeakThis(this);
+    UCPP_InputProfileStorage::LoadProfileAsync(TemplateName,
+                                               [WeakThis, TemplateName, OnComplete = MoveTemp(OnComplete)](bool bSuccess, const FS_InputProfile &Profile)
+                                               {
+                                                   UCPP_InputBindingManager *Manager = WeakThis.Get();
+                                                   if (bSuccess && Manager)
+                                                   {
+                                                       Manager->ProfileTemplates.Add(TemplateName, Profile);
+                                                       UE_LOG(LogTemp, Log, TEXT("P_MEIS: Loaded template '%s' (async)"), *TemplateName.ToString());
+                                                   }
+
+                                                   if (OnComplete)
+                                                   {
+                                                       OnComplete(bSuccess && Manager);
+                                                   }
+                                               });
+}
+
 bool UCPP_InputBindingManager::SaveProfileTemplate(const FName &TemplateName, const FS_InputProfile &Profile)
 {
+    LLM_SCOPE_BYTAG(PMEIS_Templates);
     FS_InputProfile TemplateProfile = Profile;
     TemplateProfile.ProfileName = TemplateName;
     TemplateProfile.Timestamp = FDateTime::Now();
@@ -498,6 +769,175 @@ bool UCPP_InputBindingManager::GetTemplate(const FName &TemplateName, FS_InputPr
     return UCPP_InputProfileStorage::LoadProfile(TemplateName, OutProfile);
 }
 
+// ==================== Storage Backend ====================
+
+void UCPP_InputBindingManager::SetStorageBackend(UCPP_InputStorageBackend *Backend)
+{
+    if (!Backend)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: SetStorageBackend - Backend is null"));
+        return;
+    }
+
+    UCPP_InputProfileStorage::SetStorageBackend(Backend);
+    UE_LOG(LogTemp, Log, TEXT("P_MEIS: Storage backend set to %s"), *Backend->GetClass()->GetName());
+}
+
+UCPP_InputStorageBackend *UCPP_InputBindingManager::GetStorageBackend() const
+{
+    return UCPP_InputProfileStorage::GetStorageBackend();
+}
+
+// ==================== Analytics ====================
+
+void UCPP_InputBindingManager::SetAnalyticsRecording(bool bEnable)
+{
+    bRecordingAnalytics = bEnable && Analytics;
+
+    UCPP_InputAnalytics *Recorder = bRecordingAnalytics ? Analytics : nullptr;
+    for (auto &Pair : PlayerDataMap)
+    {
+        if (Pair.Value.Integration)
+        {
+            Pair.Value.Integration->SetAnalytics(Recorder);
+        }
+    }
+}
+
+FString UCPP_InputBindingManager::SaveAnalyticsSession()
+{
+    return Analytics ? Analytics->SaveSession() : FString();
+}
+
+// ==================== Action Rates ====================
+
+FS_InputActionRates UCPP_InputBindingManager::GetAggregatedActionRates(bool bIncludeControllers)
+{
+    FS_InputActionRates Total;
+    for (const auto &Pair : PlayerDataMap)
+    {
+        if (Pair.Value.Integration)
+        {
+            Total += Pair.Value.Integration->GetPlayerRates();
+        }
+    }
+
+    if (bIncludeControllers)
+    {
+        for (const auto &Pair : ControllerDataMap)
+        {
+            if (Pair.Value.Integration)
+            {
+                Total += Pair.Value.Integration->GetPlayerRates();
+            }
+        }
+    }
+    return Total;
+}
+
+// ==================== Timing Anomaly Detection ====================
+
+void UCPP_InputBindingManager::SetTimingThresholds(const FS_InputTimingThresholds &Thresholds)
+{
+    TimingThresholds = Thresholds;
+
+    for (const auto &Pair : PlayerDataMap)
+    {
+        if (Pair.Value.Integration)
+        {
+            Pair.Value.Integration->SetTimingThresholds(Thresholds);
+        }
+    }
+    for (const auto &Pair : ControllerDataMap)
+    {
+        if (Pair.Value.Integration)
+        {
+            Pair.Value.Integration->SetTimingThresholds(Thresholds);
+        }
+    }
+}
+
+// ==================== Shared Keyboard Split ====================
+
+bool UCPP_InputBindingManager::EnableSharedKeyboardSplit(const TArray<APlayerController *> &Players, TArray<FString> &OutConflicts)
+{
+    OutConflicts.Reset();
+
+    TArray<TWeakObjectPtr<APlayerController>> SplitPlayers;
+    for (APlayerController *PlayerController : Players)
+    {
+        if (!PlayerController || !PlayerController->IsLocalController() || !GetPlayerData(PlayerController))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("P_MEIS: EnableSharedKeyboardSplit - %s is not a registered local player"),
+                   PlayerController ? *PlayerController->GetName() : TEXT("null"));
+            continue;
+        }
+        SplitPlayers.AddUnique(PlayerController);
+    }
+
+    if (SplitPlayers.Num() < 2)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: EnableSharedKeyboardSplit - need at least two registered local players"));
+        return false;
+    }
+
+    // An overlapping request leaves any active split untouched
+    if (!BuildSharedKeyboardSplit(SplitPlayers, OutConflicts))
+    {
+        return false;
+    }
+
+    SharedKeyboardPlayers = MoveTemp(SplitPlayers);
+    KeyPartitionRouter.Enable();
+    UE_LOG(LogTemp, Log, TEXT("P_MEIS: Shared keyboard split active - %d players, %d keys partitioned"),
+           SharedKeyboardPlayers.Num(), KeyPartitionRouter.GetOwnedKeyCount());
+    return true;
+}
+
+void UCPP_InputBindingManager::DisableSharedKeyboardSplit()
+{
+    KeyPartitionRouter.Reset();
+    SharedKeyboardPlayers.Reset();
+}
+
+APlayerController *UCPP_InputBindingManager::GetSharedKeyboardKeyOwner(const FKey &Key) const
+{
+    return KeyPartitionRouter.IsEnabled() ? KeyPartitionRouter.GetKeyOwner(Key) : nullptr;
+}
+
+bool UCPP_InputBindingManager::BuildSharedKeyboardSplit(const TArray<TWeakObjectPtr<APlayerController>> &Players, TArray<FString> &OutConflicts)
+{
+    TArray<FInputKeyPartition> Partitions;
+    for (const TWeakObjectPtr<APlayerController> &Player : Players)
+    {
+        if (const FS_PlayerInputData *PlayerData = GetPlayerData(Player.Get()))
+        {
+            FInputKeyPartition &Partition = Partitions.AddDefaulted_GetRef();
+            Partition.Player = Player.Get();
+            Partition.Profile = &PlayerData->ActiveProfile;
+        }
+    }
+
+    return KeyPartitionRouter.Build(Partitions, OutConflicts);
+}
+
+// ==================== Mapping Rebuilds ====================
+
+FS_InputMappingBatchStats UCPP_InputBindingManager::GetMappingRebuildStats() const
+{
+    return FInputMappingRebuildBatcher::Get().GetStats();
+}
+
+void UCPP_InputBindingManager::ResetMappingRebuildStats()
+{
+    FInputMappingRebuildBatcher::Get().ResetStats();
+}
+
+void UCPP_InputBindingManager::FlushMappingRebuilds()
+{
+    FInputMappingRebuildBatcher::Get().Flush();
+}
+
 // ==================== Per-Player Profile Operations ====================
 
 bool UCPP_InputBindingManager::ApplyTemplateToPlayer(APlayerController *PlayerController, const FName &TemplateName)
@@ -573,7 +1013,65 @@ bool UCPP_InputBindingManager::ApplyPlayerProfileToEnhancedInput(APlayerControll
                *AxisBinding.InputAxisName.ToString(), static_cast<int32>(AxisBinding.ValueType));
     }
 
-    return PlayerData->Integration->ApplyProfile(PlayerData->ActiveProfile);
+    // Stick calibration belongs to the player's own profile and stays on under context profiles;
+    // switching it on or off clears the applied hash so the stick mappings are rebuilt below
+    PlayerData->Integration->SetStickCalibration(PlayerData->ActiveProfile.bAutoCalibrateSticks, PlayerData->ActiveProfile.StickCalibrations);
+
+    // An active context with its own profile (Cutscene, Menu...) stands in for the player's profile until it is popped
+    uint32 ProfileHash = 0;
+    const FS_InputProfile *ContextProfile = ContextManager ? ContextManager->GetActiveContextProfile(PlayerController, ProfileHash) : nullptr;
+    const FS_InputProfile &EffectiveProfile = ContextProfile ? *ContextProfile : PlayerData->ActiveProfile;
+    if (!ContextProfile)
+    {
+        ProfileHash = UCPP_EnhancedInputIntegration::ComputeProfileHash(EffectiveProfile);
+    }
+
+    // Same bindings as already built (typical after a reattach) - keep the mappings, just make sure they are live
+    if (PlayerData->Integration->IsProfileApplied(EffectiveProfile, ProfileHash))
+    {
+        PlayerData->Integration->ReattachPlayerController(PlayerController);
+        UE_LOG(LogTemp, Log, TEXT("P_MEIS: ApplyPlayerProfileToEnhancedInput - bindings unchanged, mappings kept"));
+        return true;
+    }
+
+    if (!PlayerData->Integration->ApplyProfileWithHash(EffectiveProfile, ProfileHash))
+    {
+        return false;
+    }
+
+    // New bindings move keys between shared-keyboard partitions; an overlap keeps the previous routing
+    if (KeyPartitionRouter.IsEnabled() && SharedKeyboardPlayers.Contains(PlayerController))
+    {
+        TArray<FString> Conflicts;
+        BuildSharedKeyboardSplit(SharedKeyboardPlayers, Conflicts);
+    }
+    return true;
+}
+
+bool UCPP_InputBindingManager::SetStickCalibrationEnabled(APlayerController *PlayerController, bool bEnable)
+{
+    FS_PlayerInputData *PlayerData = GetPlayerData(PlayerController);
+    if (!PlayerData || !PlayerData->IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: SetStickCalibrationEnabled - player not valid"));
+        return false;
+    }
+
+    PlayerData->ActiveProfile.bAutoCalibrateSticks = bEnable;
+    return ApplyPlayerProfileToEnhancedInput(PlayerController);
+}
+
+void UCPP_InputBindingManager::HandleStickCalibrationUpdated(FName HardwareId, const FS_StickCalibration &Calibration, UCPP_EnhancedInputIntegration *Integration)
+{
+    // Looked up by integration: a returning player's controller differs from the one it was registered with
+    for (TPair<APlayerController *, FS_PlayerInputData> &Pair : PlayerDataMap)
+    {
+        if (Pair.Value.Integration == Integration)
+        {
+            FS_DeviceStickCalibration::Store(Pair.Value.ActiveProfile.StickCalibrations, HardwareId, Calibration);
+            return;
+        }
+    }
 }
 
 // ==================== Per-Player Action Binding Operations ====================
@@ -785,6 +1283,88 @@ FKey UCPP_InputBindingManager::GetPrimaryKeyForAction(APlayerController *PlayerC
     return EKeys::Invalid;
 }
 
+FKey UCPP_InputBindingManager::GetPrimaryKeyForActionId(APlayerController *PlayerController, int32 ActionId)
+{
+    FS_PlayerInputData *PlayerData = GetPlayerData(PlayerController);
+    const FName ActionName = PlayerData ? ResolveActionId(ActionId) : NAME_None;
+    if (ActionName.IsNone())
+    {
+        return EKeys::Invalid;
+    }
+
+    // The cached index is trusted only while it still points at this action; any profile edit just causes one re-search
+    const TArray<FS_InputActionBinding> &Bindings = PlayerData->ActiveProfile.ActionBindings;
+    const int32 *CachedIndex = PlayerData->ActionBindingIndexById.Find(ActionId);
+    int32 BindingIndex = CachedIndex ? *CachedIndex : INDEX_NONE;
+    if (!Bindings.IsValidIndex(BindingIndex) || Bindings[BindingIndex].InputActionName != ActionName)
+    {
+        BindingIndex = Bindings.IndexOfByPredicate(
+            [ActionName](const FS_InputActionBinding &Binding)
+            { return Binding.InputActionName == ActionName; });
+        if (BindingIndex == INDEX_NONE)
+        {
+            return EKeys::Invalid;
+        }
+        PlayerData->ActionBindingIndexById.Add(ActionId, BindingIndex);
+    }
+
+    const FS_InputActionBinding &ActionBinding = Bindings[BindingIndex];
+    return ActionBinding.KeyBindings.Num() > 0 ? ActionBinding.KeyBindings[0].Key : EKeys::Invalid;
+}
+
+FName UCPP_InputBindingManager::ResolveActionId(int32 ActionId)
+{
+    if (const FName *Cached = ActionNamesById.Find(ActionId))
+    {
+        return *Cached;
+    }
+
+    FName Found = NAME_None;
+    auto Consider = [&Found, ActionId](const FName &Name)
+    {
+        if (Found.IsNone() && UCPP_InputActionDefinitionRegistry::MakeActionId(Name) == ActionId)
+        {
+            Found = Name;
+        }
+    };
+    auto ConsiderProfile = [&Consider](const FS_InputProfile &Profile)
+    {
+        for (const FS_InputActionBinding &Binding : Profile.ActionBindings)
+        {
+            Consider(Binding.InputActionName);
+        }
+        for (const FS_InputAxisBinding &Binding : Profile.AxisBindings)
+        {
+            Consider(Binding.InputAxisName);
+        }
+    };
+
+    if (ActionDefinitionRegistry)
+    {
+        for (int32 Index = 0; Index < ActionDefinitionRegistry->GetDefinitionCount(); ++Index)
+        {
+            Consider(ActionDefinitionRegistry->GetActionName(Index));
+        }
+    }
+    for (const auto &Pair : ProfileTemplates)
+    {
+        ConsiderProfile(Pair.Value);
+    }
+    for (const auto &Pair : PlayerDataMap)
+    {
+        ConsiderProfile(Pair.Value.ActiveProfile);
+    }
+
+    if (Found.IsNone())
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("P_MEIS: No known action has id %d"), ActionId);
+        return NAME_None;
+    }
+
+    ActionNamesById.Add(ActionId, Found);
+    return Found;
+}
+
 void UCPP_InputBindingManager::GetActionsForKey(APlayerController *PlayerController, const FKey &Key, TArray<FName> &OutActions)
 {
     OutActions.Empty();
@@ -834,6 +1414,11 @@ bool UCPP_InputBindingManager::SetPrimaryKeyForAction(APlayerController *PlayerC
         return false;
     }
 
+    if (Analytics)
+    {
+        Analytics->RecordRebind(ActionName);
+    }
+
     FS_InputActionBinding *ActionBinding = Profile->ActionBindings.FindByPredicate(
         [ActionName](const FS_InputActionBinding &Binding)
         { return Binding.InputActionName == ActionName; });
@@ -872,6 +1457,11 @@ bool UCPP_InputBindingManager::AddKeyToAction(APlayerController *PlayerControlle
         return false;
     }
 
+    if (Analytics)
+    {
+        Analytics->RecordRebind(ActionName);
+    }
+
     FS_InputActionBinding *ActionBinding = Profile->ActionBindings.FindByPredicate(
         [ActionName](const FS_InputActionBinding &Binding)
         { return Binding.InputActionName == ActionName; });
@@ -915,6 +1505,10 @@ bool UCPP_InputBindingManager::RemoveKeyFromAction(APlayerController *PlayerCont
     int32 RemovedCount = ActionBinding->KeyBindings.RemoveAll(
         [Key](const FS_KeyBinding &Binding)
         { return Binding.Key == Key; });
+    if (RemovedCount > 0 && Analytics)
+    {
+        Analytics->RecordRebind(ActionName);
+    }
     return RemovedCount > 0;
 }
 
@@ -964,6 +1558,12 @@ bool UCPP_InputBindingManager::SwapActionBindings(APlayerController *PlayerContr
     TArray<FS_KeyBinding> TempKeys = BindingA->KeyBindings;
     BindingA->KeyBindings = BindingB->KeyBindings;
     BindingB->KeyBindings = TempKeys;
+
+    if (Analytics)
+    {
+        Analytics->RecordRebind(ActionA);
+        Analytics->RecordRebind(ActionB);
+    }
     return true;
 }
 
@@ -14,12 +14,30 @@
 #include "InputBinding/FS_InputAxisBinding.h"
 #include "InputBinding/FS_InputProfile.h"
 #include "InputBinding/FS_PlayerInputData.h"
+#include "InputBinding/FS_InputActionRate.h"
+#include "InputBinding/FS_InputTimingStats.h"
+#include "Integration/InputKeyPartitionRouter.h"
+#include "InputBinding/FS_InputMappingBatchStats.h"
 #include "CPP_InputBindingManager.generated.h"
 
 class UCPP_EnhancedInputIntegration;
+class UCPP_InputStorageBackend;
+class UCPP_InputActionAssetRegistry;
+class UCPP_InputActionDefinitionRegistry;
+class UCPP_InputContextManager;
+class UCPP_InputAnalytics;
 class APlayerController;
 class AController;
 
+/**
+ * A departed player's data kept for their return (Integration stays rooted and built)
+ */
+struct FDepartedPlayerInput
+{
+    FS_PlayerInputData Data;
+    double ExpireTime = 0.0;
+};
+
 /**
  * Core input binding manager subsystem
  *
@@ -139,6 +157,36 @@ public:
     UFUNCTION(BlueprintPure, Category = "Input Binding|Player")
     bool HasPlayerModifiedProfile(APlayerController *PlayerController) const;
 
+    // ==================== Departed Player Cache ====================
+    // When a player's controller goes away its profile and built Integration are kept,
+    // keyed by unique net id (or platform user id). Re-registering the same user
+    // reattaches them instead of starting from an empty profile.
+
+    /**
+     * How long a departed player is kept (seconds); 0 disables the cache and drops current entries
+     * @param Seconds Lifetime of each entry, checked lazily on register/unregister
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Player")
+    void SetPlayerCacheLifetime(float Seconds);
+
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Player")
+    float GetPlayerCacheLifetime() const { return PlayerCacheLifetime; }
+
+    /** Number of departed players currently cached */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Player")
+    int32 GetCachedPlayerCount() const { return DepartedPlayers.Num(); }
+
+    /** Drop every cached player and destroy their Integrations */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Player")
+    void FlushPlayerCache();
+
+    /**
+     * Identity used to cache a controller's user
+     * @param Controller The controller
+     * @return "Net:<unique id>" or "User:<platform user id>", empty if neither is known
+     */
+    static FString GetPlayerCacheKey(const AController *Controller);
+
     // ==================== Profile Template Management (Global Library) ====================
 
     /**
@@ -214,6 +262,151 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Input Binding|Templates")
     bool GetTemplate(const FName &TemplateName, FS_InputProfile &OutProfile) const;
 
+    /**
+     * Load a profile template without blocking on storage IO
+     * @param TemplateName Name of the template to load
+     * @param OnComplete Called on the game thread once the template is in memory (or failed)
+     */
+    void LoadProfileTemplateAsync(const FName &TemplateName, TFunction<void(bool bSuccess)> OnComplete);
+
+    // ==================== Storage Backend ====================
+
+    /**
+     * Route template persistence through a different backend (file, SaveGame slot, in-memory)
+     * Templates already loaded in memory are kept.
+     * @param Backend The backend to use
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Storage")
+    void SetStorageBackend(UCPP_InputStorageBackend *Backend);
+
+    /**
+     * Get the backend templates are persisted through
+     * @return The active storage backend
+     */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Storage")
+    UCPP_InputStorageBackend *GetStorageBackend() const;
+
+    // ==================== Authored Input Action Assets ====================
+
+    /**
+     * Get the registry of authored Input Action assets shared by every player's Integration
+     * Bindings whose name matches a registered asset use that asset instead of a dynamic action.
+     * @return The asset registry
+     */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Assets")
+    UCPP_InputActionAssetRegistry *GetActionAssetRegistry() const { return ActionAssetRegistry; }
+
+    // ==================== Action Definitions ====================
+
+    /**
+     * Get the global action definition registry (static metadata + dense action indices)
+     * Saved profiles store only key assignments and the fields that differ from these definitions.
+     * @return The definition registry
+     */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Definitions")
+    UCPP_InputActionDefinitionRegistry *GetActionDefinitionRegistry() const { return ActionDefinitionRegistry; }
+
+    // ==================== Input Contexts ====================
+
+    /**
+     * Get the per-player input context manager (Menu/Gameplay/Cutscene/Vehicle stacks)
+     * A player whose active context has a context profile runs on it instead of their own profile.
+     * @return The context manager
+     */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Context")
+    UCPP_InputContextManager *GetContextManager() const { return ContextManager; }
+
+    // ==================== Analytics ====================
+
+    /** Key/action usage and rebinds of every registered player (actions are only recorded while recording) */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Analytics")
+    UCPP_InputAnalytics *GetAnalytics() const { return Analytics; }
+
+    /**
+     * Start/stop recording action usage from every registered player
+     * While recording, the session is saved to Saved/InputAnalytics/ when the manager shuts down.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Analytics")
+    void SetAnalyticsRecording(bool bEnable);
+
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Analytics")
+    bool IsRecordingAnalytics() const { return bRecordingAnalytics; }
+
+    /**
+     * Write the session so far to a new session file
+     * @return Path written, empty on failure
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Analytics")
+    FString SaveAnalyticsSession();
+
+    // ==================== Action Rates ====================
+
+    /**
+     * Sum of every registered player's action rates (Started events over 1s / 10s / 60s)
+     * @param bIncludeControllers Also count non-player controllers (AI, bots)
+     * @return Aggregated counts; Count60s is the combined actions per minute
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Rates")
+    FS_InputActionRates GetAggregatedActionRates(bool bIncludeControllers = false);
+
+    // ==================== Timing Anomaly Detection ====================
+
+    /**
+     * Set timing anomaly thresholds for every registered player/controller and for later registrations
+     * @param Thresholds Thresholds to apply; bEnabled turns collection on or off
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Timing")
+    void SetTimingThresholds(const FS_InputTimingThresholds &Thresholds);
+
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Timing")
+    FS_InputTimingThresholds GetTimingThresholds() const { return TimingThresholds; }
+
+    // ==================== Shared Keyboard Split ====================
+    // Two or more local players on one keyboard (e.g. WASD vs arrows). Each player keeps
+    // their own profile and IMC; keyboard keys are routed to the player whose profile binds them.
+
+    /**
+     * Split the keyboard between local players by the keys in their profiles
+     * Rebuilt automatically whenever one of these players' profiles is applied.
+     * @param Players Registered local players sharing the keyboard (at least two)
+     * @param OutConflicts One message per key bound by more than one of the players
+     * @return True if the partitions are disjoint and routing is active
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Shared Keyboard")
+    bool EnableSharedKeyboardSplit(const TArray<APlayerController *> &Players, TArray<FString> &OutConflicts);
+
+    /** Stop routing; the keyboard goes back to its own player only */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Shared Keyboard")
+    void DisableSharedKeyboardSplit();
+
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Shared Keyboard")
+    bool IsSharedKeyboardSplitActive() const { return KeyPartitionRouter.IsEnabled(); }
+
+    /**
+     * Player a keyboard key is routed to while the split is active
+     * @param Key The key
+     * @return The owning player, or nullptr if the key is not partitioned
+     */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Shared Keyboard")
+    APlayerController *GetSharedKeyboardKeyOwner(const FKey &Key) const;
+
+    // ==================== Mapping Rebuilds ====================
+
+    /**
+     * Mapping context changes and control-mapping rebuilds across every local player
+     * Rebuilds are coalesced to one per local player per frame.
+     * @return Requested vs performed rebuild counters
+     */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Mapping")
+    FS_InputMappingBatchStats GetMappingRebuildStats() const;
+
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Mapping")
+    void ResetMappingRebuildStats();
+
+    /** Run queued control-mapping rebuilds now instead of on the next frame */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Mapping")
+    void FlushMappingRebuilds();
+
     // ==================== Per-Player Profile Operations ====================
 
     /**
@@ -242,6 +435,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Input Binding|Player Profile")
     bool ApplyPlayerProfileToEnhancedInput(APlayerController *PlayerController);
 
+    /**
+     * Turn automatic stick drift calibration on/off in a player's profile and re-apply it
+     * Estimates are written into the profile's StickCalibrations as they improve; save the profile to keep them.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Player Profile")
+    bool SetStickCalibrationEnabled(APlayerController *PlayerController, bool bEnable);
+
     // ==================== Per-Player Action Binding Operations ====================
 
     /**
@@ -308,6 +508,19 @@ public:
     UFUNCTION(BlueprintPure, Category = "Input Binding|Player Action")
     FKey GetPrimaryKeyForAction(APlayerController *PlayerController, const FName &ActionName);
 
+    /**
+     * GetPrimaryKeyForAction for an id from UCPP_InputActionDefinitionRegistry::MakeActionId
+     * Used by compiled Blueprint action nodes; repeat calls skip the binding search.
+     * @return The primary key, or EKeys::Invalid if not found
+     */
+    FKey GetPrimaryKeyForActionId(APlayerController *PlayerController, int32 ActionId);
+
+    /**
+     * Action/axis name for an action id, searched in definitions, templates and player profiles on first use
+     * @return The name, or NAME_None if no known action has this id
+     */
+    FName ResolveActionId(int32 ActionId);
+
     /**
      * Get all actions that use a specific key (reverse lookup)
      * @param PlayerController The player
@@ -516,11 +729,52 @@ protected:
     UPROPERTY()
     TMap<AController *, FS_PlayerInputData> ControllerDataMap;
 
+    /** Authored Input Action assets, resolved asynchronously at startup */
+    UPROPERTY()
+    UCPP_InputActionAssetRegistry *ActionAssetRegistry;
+
+    /** Global action definitions, loaded from config before any profile is read */
+    UPROPERTY()
+    UCPP_InputActionDefinitionRegistry *ActionDefinitionRegistry;
+
+    /** Per-player context stacks and context profiles */
+    UPROPERTY()
+    UCPP_InputContextManager *ContextManager;
+
+    /** Session usage recorder shared by all players */
+    UPROPERTY()
+    UCPP_InputAnalytics *Analytics;
+
+    bool bRecordingAnalytics = false;
+
+    /** Action id -> name, filled by ResolveActionId (ids are a pure function of the name, so entries never go stale) */
+    TMap<int32, FName> ActionNamesById;
+
+    /** Timing anomaly thresholds handed to every Integration */
+    FS_InputTimingThresholds TimingThresholds;
+
+    /** Departed players by cache key (Integrations stay in the root set while cached) */
+    TMap<FString, FDepartedPlayerInput> DepartedPlayers;
+
+    float PlayerCacheLifetime = 300.0f;
+
+    /** Key -> owning player table and input pre-processor for the shared keyboard split */
+    FInputKeyPartitionRouter KeyPartitionRouter;
+
+    /** Players sharing the keyboard while the split is active */
+    TArray<TWeakObjectPtr<APlayerController>> SharedKeyboardPlayers;
+
     // ==================== Helper Functions ====================
 
     bool LoadDefaultTemplate();
+    void HandleActionAssetsResolved();
+    void HandleStickCalibrationUpdated(FName HardwareId, const FS_StickCalibration &Calibration, UCPP_EnhancedInputIntegration *Integration);
     void BroadcastBindingChanges(APlayerController *PlayerController);
     void CleanupInvalidPlayers();
+    bool CacheDepartedPlayer(const FString &CacheKey, const FS_PlayerInputData &PlayerData);
+    UCPP_EnhancedInputIntegration *ReattachDepartedPlayer(APlayerController *PlayerController);
+    void PurgeExpiredPlayerCache();
+    bool BuildSharedKeyboardSplit(const TArray<TWeakObjectPtr<APlayerController>> &Players, TArray<FString> &OutConflicts);
     void CleanupInvalidControllers();
     FS_PlayerInputData *GetPlayerData(APlayerController *PlayerController);
     const FS_PlayerInputData *GetPlayerData(APlayerController *PlayerController) const;
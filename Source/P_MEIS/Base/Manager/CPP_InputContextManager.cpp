@@ -6,32 +6,220 @@
 
 #include "Manager/CPP_InputContextManager.h"
 #include "Manager/CPP_InputBindingManager.h"
+#include "Integration/CPP_EnhancedInputIntegration.h"
+#include "Integration/InputMappingRebuildBatcher.h"
+#include "GameFramework/PlayerController.h"
 
-bool UCPP_InputContextManager::SetInputContext(EInputContext NewContext)
+void UCPP_InputContextManager::Initialize(UCPP_InputBindingManager* InBindingManager)
 {
-if (NewContext == CurrentContext)
+BindingManager = InBindingManager;
+}
+
+// ==================== All Players ====================
+
+bool UCPP_InputContextManager::SetInputContext(EInputContext NewContext)
 {
-return false;
+// No early out on CurrentContext: players may have switched on their own since the last global switch
+const bool bGlobalChanged = NewContext != CurrentContext;
+return SetContextForAllPlayers(NewContext) > 0 || bGlobalChanged;
 }
 
+int32 UCPP_InputContextManager::SetContextForAllPlayers(EInputContext NewContext)
+{
 CurrentContext = NewContext;
+UE_LOG(LogTemp, Log, TEXT("P_MEIS: Switching all players to context %d"), static_cast<int32>(NewContext));
 
-// Find and apply context profile
-for (const FS_ContextBinding& Binding : ContextBindings)
+return ForEachPlayerStack([NewContext](FInputContextStack& Stack)
+{
+Stack.Contexts.Reset();
+Stack.Contexts.Add(NewContext);
+});
+}
+
+int32 UCPP_InputContextManager::PushContextForAllPlayers(EInputContext Context)
+{
+return ForEachPlayerStack([Context](FInputContextStack& Stack)
+{
+Stack.Contexts.Add(Context);
+});
+}
+
+int32 UCPP_InputContextManager::PopContextForAllPlayers()
+{
+return ForEachPlayerStack([](FInputContextStack& Stack)
+{
+if (Stack.Contexts.Num() > 1)
+{
+Stack.Contexts.Pop(EAllowShrinking::No);
+}
+});
+}
+
+int32 UCPP_InputContextManager::ForEachPlayerStack(TFunctionRef<void(FInputContextStack&)> Mutate)
+{
+if (!BindingManager)
+{
+return 0;
+}
+
+// Players that left are dropped here rather than on every lookup
+for (auto It = PlayerContexts.CreateIterator(); It; ++It)
+{
+if (!It->Key.IsValid())
 {
-if (Binding.Context == CurrentContext && Binding.bEnabled)
+It.RemoveCurrent();
+}
+}
+
+TArray<APlayerController*> Players;
+BindingManager->GetRegisteredPlayers(Players);
+
+// One pass: each player's mappings are rebuilt into the batcher's queue, then flushed once
+int32 Changed = 0;
+for (APlayerController* PlayerController : Players)
+{
+FInputContextStack& Stack = GetOrAddStack(PlayerController);
+const EInputContext Before = Stack.GetActive();
+Mutate(Stack);
+if (Stack.GetActive() != Before)
+{
+ApplyActiveContext(PlayerController);
+++Changed;
+}
+}
+
+if (Changed > 0)
+{
+FInputMappingRebuildBatcher::Get().Flush();
+}
+return Changed;
+}
+
+// ==================== Per Player ====================
+
+bool UCPP_InputContextManager::SetContextForPlayer(APlayerController* PlayerController, EInputContext NewContext)
 {
-if (BindingManager)
+if (!PlayerController)
 {
-UE_LOG(LogTemp, Log, TEXT("P_MEIS: Switching to context %d"), static_cast<int32>(CurrentContext));
+return false;
+}
+
+FInputContextStack& Stack = GetOrAddStack(PlayerController);
+const EInputContext Before = Stack.GetActive();
+Stack.Contexts.Reset();
+Stack.Contexts.Add(NewContext);
+
+if (NewContext != Before)
+{
+ApplyActiveContext(PlayerController);
+}
 return true;
 }
+
+bool UCPP_InputContextManager::PushContextForPlayer(APlayerController* PlayerController, EInputContext Context)
+{
+if (!PlayerController)
+{
+return false;
 }
+
+FInputContextStack& Stack = GetOrAddStack(PlayerController);
+const EInputContext Before = Stack.GetActive();
+Stack.Contexts.Add(Context);
+
+if (Context != Before)
+{
+ApplyActiveContext(PlayerController);
+}
+return true;
 }
 
+bool UCPP_InputContextManager::PopContextForPlayer(APlayerController* PlayerController)
+{
+FInputContextStack* Stack = PlayerContexts.Find(PlayerController);
+if (!Stack || Stack->Contexts.Num() <= 1)
+{
 return false;
 }
 
+const EInputContext Before = Stack->GetActive();
+Stack->Contexts.Pop(EAllowShrinking::No);
+
+if (Stack->GetActive() != Before)
+{
+ApplyActiveContext(PlayerController);
+}
+return true;
+}
+
+EInputContext UCPP_InputContextManager::GetContextForPlayer(APlayerController* PlayerController) const
+{
+const FInputContextStack* Stack = PlayerContexts.Find(PlayerController);
+return Stack ? Stack->GetActive() : CurrentContext;
+}
+
+const FS_InputProfile* UCPP_InputContextManager::GetActiveContextProfile(APlayerController* PlayerController, uint32& OutProfileHash)
+{
+const int32 BindingIndex = FindContextBinding(GetContextForPlayer(PlayerController));
+if (BindingIndex == INDEX_NONE)
+{
+return nullptr;
+}
+
+// Hashing serializes the whole profile; do it once per context, not once per player
+const FS_InputProfile& Profile = ContextBindings[BindingIndex].ContextProfile;
+if (const uint32* Hash = ContextProfileHashes.Find(BindingIndex))
+{
+OutProfileHash = *Hash;
+}
+else
+{
+OutProfileHash = ContextProfileHashes.Add(BindingIndex, UCPP_EnhancedInputIntegration::ComputeProfileHash(Profile));
+}
+return &Profile;
+}
+
+FInputContextStack& UCPP_InputContextManager::GetOrAddStack(APlayerController* PlayerController)
+{
+FInputContextStack& Stack = PlayerContexts.FindOrAdd(PlayerController);
+if (Stack.Contexts.Num() == 0)
+{
+Stack.Contexts.Add(CurrentContext);
+}
+return Stack;
+}
+
+void UCPP_InputContextManager::ApplyActiveContext(APlayerController* PlayerController)
+{
+if (BindingManager && BindingManager->HasPlayerRegistered(PlayerController))
+{
+const EInputContext Context = GetContextForPlayer(PlayerController);
+UE_LOG(LogTemp, Log, TEXT("P_MEIS: %s switching to context %d"), *PlayerController->GetName(), static_cast<int32>(Context));
+if (UCPP_EnhancedInputIntegration* Integration = BindingManager->GetIntegrationForPlayer(PlayerController))
+{
+Integration->SetAnalyticsContext(FName(*StaticEnum<EInputContext>()->GetNameStringByValue(static_cast<int64>(Context))));
+}
+BindingManager->ApplyPlayerProfileToEnhancedInput(PlayerController);
+}
+}
+
+// ==================== Context Profiles ====================
+
+int32 UCPP_InputContextManager::FindContextBinding(EInputContext Context) const
+{
+int32 BestIndex = INDEX_NONE;
+for (int32 Index = 0; Index < ContextBindings.Num(); ++Index)
+{
+const FS_ContextBinding& Binding = ContextBindings[Index];
+if (Binding.Context == Context && Binding.bEnabled &&
+(BestIndex == INDEX_NONE || Binding.Priority > ContextBindings[BestIndex].Priority))
+{
+BestIndex = Index;
+}
+}
+return BestIndex;
+}
+
 bool UCPP_InputContextManager::RegisterContextProfile(EInputContext Context, const FS_InputProfile& Profile, float Priority)
 {
 FS_ContextBinding NewBinding;
@@ -41,6 +229,7 @@ NewBinding.Priority = Priority;
 NewBinding.bEnabled = true;
 
 ContextBindings.Add(NewBinding);
+ContextProfileHashes.Reset();
 UE_LOG(LogTemp, Log, TEXT("P_MEIS: Registered context profile for context %d"), static_cast<int32>(Context));
 
 return true;
@@ -48,16 +237,14 @@ return true;
 
 bool UCPP_InputContextManager::GetContextProfile(EInputContext Context, FS_InputProfile& OutProfile)
 {
-for (const FS_ContextBinding& Binding : ContextBindings)
-{
-if (Binding.Context == Context && Binding.bEnabled)
+const int32 BindingIndex = FindContextBinding(Context);
+if (BindingIndex == INDEX_NONE)
 {
-OutProfile = Binding.ContextProfile;
-return true;
-}
+return false;
 }
 
-return false;
+OutProfile = ContextBindings[BindingIndex].ContextProfile;
+return true;
 }
 
 void UCPP_InputContextManager::ListContexts(TArray<uint8>& OutContexts)
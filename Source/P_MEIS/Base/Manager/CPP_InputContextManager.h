@@ -8,8 +8,11 @@
 
 #include "CoreMinimal.h"
 #include "InputBinding/FS_InputProfile.h"
+#include "Templates/Function.h"
 #include "CPP_InputContextManager.generated.h"
 
+class APlayerController;
+
 /**
  * Enum for different input contexts
  */
@@ -48,7 +51,25 @@ struct FS_ContextBinding
 };
 
 /**
- * Manager for context-aware input bindings
+ * One player's context stack; the top entry is the active context
+ * Push/Pop let a cutscene or pause sit on top of each player's own context (vehicle, on foot)
+ * and hand it back untouched afterwards.
+ */
+struct FInputContextStack
+{
+    TArray<EInputContext, TInlineAllocator<4>> Contexts;
+
+    EInputContext GetActive() const { return Contexts.Num() > 0 ? Contexts.Last() : EInputContext::Gameplay; }
+};
+
+/**
+ * Manager for context-aware input bindings (owned by UCPP_InputBindingManager)
+ *
+ * Context state is per player. A player whose active context has a registered, enabled
+ * context profile runs on that profile; otherwise on their own active profile. Switching
+ * re-applies through the binding manager, so mapping changes go through the rebuild batcher:
+ * the all-player variants switch every registered player in one pass and flush once, which
+ * is one control-mapping rebuild per local player.
  */
 UCLASS()
 class P_MEIS_API UCPP_InputContextManager : public UObject
@@ -56,12 +77,62 @@ class P_MEIS_API UCPP_InputContextManager : public UObject
     GENERATED_BODY()
 
 public:
+    void Initialize(class UCPP_InputBindingManager *InBindingManager);
+
+    // ==================== All Players ====================
+
+    /**
+     * Legacy global switch; same as SetContextForAllPlayers
+     * @return True if the global context or any player's active context changed
+     */
     UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
     bool SetInputContext(EInputContext NewContext);
 
+    /** Context last set for all players */
     UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
     EInputContext GetCurrentContext() const { return CurrentContext; }
 
+    /**
+     * Replace every registered player's context stack with NewContext
+     * @return Number of players whose active context changed
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
+    int32 SetContextForAllPlayers(EInputContext NewContext);
+
+    /** Push a context on every registered player's stack (e.g. Cutscene) */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
+    int32 PushContextForAllPlayers(EInputContext Context);
+
+    /** Pop the top context of every registered player (their own context comes back) */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
+    int32 PopContextForAllPlayers();
+
+    // ==================== Per Player ====================
+
+    /** Replace one player's context stack with NewContext */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
+    bool SetContextForPlayer(APlayerController *PlayerController, EInputContext NewContext);
+
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
+    bool PushContextForPlayer(APlayerController *PlayerController, EInputContext Context);
+
+    /** Pop one player's top context (the base entry is never popped) */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
+    bool PopContextForPlayer(APlayerController *PlayerController);
+
+    /** Active (top) context for a player; players never switched are in the current global context */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Context")
+    EInputContext GetContextForPlayer(APlayerController *PlayerController) const;
+
+    /**
+     * Profile the player's active context replaces their own profile with
+     * @param OutProfileHash ComputeProfileHash of the returned profile (cached per context)
+     * @return nullptr if the active context has no enabled context profile
+     */
+    const FS_InputProfile *GetActiveContextProfile(APlayerController *PlayerController, uint32 &OutProfileHash);
+
+    // ==================== Context Profiles ====================
+
     UFUNCTION(BlueprintCallable, Category = "Input Binding|Context")
     bool RegisterContextProfile(EInputContext Context, const FS_InputProfile &Profile, float Priority = 0.0f);
 
@@ -80,4 +151,20 @@ private:
 
     UPROPERTY()
     class UCPP_InputBindingManager *BindingManager;
+
+    TMap<TWeakObjectPtr<APlayerController>, FInputContextStack> PlayerContexts;
+
+    /** ComputeProfileHash per context binding index, filled on first use */
+    TMap<int32, uint32> ContextProfileHashes;
+
+    /** Enabled binding for a context (index into ContextBindings), INDEX_NONE if none */
+    int32 FindContextBinding(EInputContext Context) const;
+
+    FInputContextStack &GetOrAddStack(APlayerController *PlayerController);
+
+    /** Re-apply a player's effective profile (mappings rebuilt by the batcher) */
+    void ApplyActiveContext(APlayerController *PlayerController);
+
+    /** Run Mutate on every registered player's stack, re-applying players whose active context changed */
+    int32 ForEachPlayerStack(TFunctionRef<void(FInputContextStack &)> Mutate);
 };
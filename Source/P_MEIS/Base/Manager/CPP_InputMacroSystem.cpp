@@ -5,29 +5,77 @@
  */
 
 #include "Manager/CPP_InputMacroSystem.h"
+#include "Integration/CPP_EnhancedInputIntegration.h"
+#include "Manager/CPP_InputBindingManager.h"
+#include "Engine/Engine.h"
+#include "P_MEIS_Memory.h"
 
 bool UCPP_InputMacroSystem::RegisterMacro(const FS_InputMacro& Macro)
 {
-if (Macro.MacroName.IsNone() || Macro.Steps.Num() == 0)
+LLM_SCOPE_BYTAG(PMEIS_Recordings);
+if (Macro.MacroName.IsNone() || (Macro.Steps.Num() == 0 && Macro.Instructions.Num() == 0))
 {
 UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Cannot register macro - invalid name or no steps"));
 return false;
 }
 
+TSharedPtr<FMacroProgram> Program = MakeShared<FMacroProgram>();
+if (!CompileMacro(Macro, [this](const FKey& Key) { return ResolveStepKey(Key, Integration); }, *Program))
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Cannot register macro - failed to compile: %s"), *Macro.MacroName.ToString());
+return false;
+}
+
+// Re-registering replaces the macro; running instances finish on the old program
+FS_InputMacro* Existing = RegisteredMacros.FindByPredicate([&Macro](const FS_InputMacro& Other)
+{ return Other.MacroName == Macro.MacroName; });
+if (Existing)
+{
+*Existing = Macro;
+}
+else
+{
 RegisteredMacros.Add(Macro);
-MacroCooldowns.Add(Macro.MacroName, 0.0f);
-UE_LOG(LogTemp, Log, TEXT("P_MEIS: Registered macro: %s"), *Macro.MacroName.ToString());
+}
+
+Programs.Add(Macro.MacroName, Program);
+MacroCooldowns.FindOrAdd(Macro.MacroName, 0.0f);
+UE_LOG(LogTemp, Log, TEXT("P_MEIS: Registered macro: %s (%d instructions)"), *Macro.MacroName.ToString(), Program->Code.Num());
 
 return true;
 }
 
 bool UCPP_InputMacroSystem::PlayMacro(const FName& MacroName)
 {
-if (IsMacroPlaying(MacroName))
+return PlayMacroOn(MacroName, Integration);
+}
+
+bool UCPP_InputMacroSystem::PlayMacroOn(const FName& MacroName, UCPP_EnhancedInputIntegration* TargetIntegration)
+{
+LLM_SCOPE_BYTAG(PMEIS_Recordings);
+if (!TargetIntegration)
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Cannot play macro without an integration: %s"), *MacroName.ToString());
+return false;
+}
+
+const TSharedPtr<const FMacroProgram>* Program = Programs.Find(MacroName);
+const FS_InputMacro* Macro = RegisteredMacros.FindByPredicate([&MacroName](const FS_InputMacro& Other)
+{ return Other.MacroName == MacroName; });
+if (!Program || !Macro || !Macro->bEnabled)
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Macro not registered or disabled: %s"), *MacroName.ToString());
+return false;
+}
+
+for (int32 Index = 0; Index < ActiveInstanceCount; ++Index)
+{
+if (Instances[Index].MacroName == MacroName && Instances[Index].Integration == TargetIntegration && !Instances[Index].bStopRequested)
 {
 UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Macro already playing: %s"), *MacroName.ToString());
 return false;
 }
+}
 
 // Check cooldown
 if (MacroCooldowns.Contains(MacroName) && MacroCooldowns[MacroName] > 0.0f)
@@ -36,7 +84,43 @@ UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Macro on cooldown: %s"), *MacroName.ToStr
 return false;
 }
 
-PlayingMacros.Add(MacroName);
+// The pool is allocated once; ticking never allocates
+if (Instances.Num() == 0)
+{
+Instances.SetNum(FMath::Max(MaxInstances, 1));
+}
+
+if (ActiveInstanceCount >= Instances.Num())
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Macro pool full (%d), cannot play: %s"), Instances.Num(), *MacroName.ToString());
+return false;
+}
+
+// Key-only steps follow the target player's current bindings, not the ones seen at register time
+TSharedPtr<const FMacroProgram> PlayProgram = *Program;
+if (PlayProgram->bResolvesKeys)
+{
+TSharedPtr<FMacroProgram> Resolved = MakeShared<FMacroProgram>();
+if (!CompileMacro(*Macro, [TargetIntegration](const FKey& Key) { return ResolveStepKey(Key, TargetIntegration); }, *Resolved))
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Cannot play macro - a step key is no longer bound: %s"), *MacroName.ToString());
+return false;
+}
+PlayProgram = Resolved;
+}
+
+FMacroInstance& Instance = Instances[ActiveInstanceCount++];
+Instance = FMacroInstance();
+Instance.Program = PlayProgram;
+Instance.Integration = TargetIntegration;
+Instance.MacroName = MacroName;
+
+if (PlayProgram->Cooldown > 0.0f)
+{
+MacroCooldowns.Add(MacroName, PlayProgram->Cooldown);
+bCooldownsActive = true;
+}
+
 UE_LOG(LogTemp, Log, TEXT("P_MEIS: Playing macro: %s"), *MacroName.ToString());
 
 return true;
@@ -44,13 +128,32 @@ return true;
 
 bool UCPP_InputMacroSystem::StopMacro(const FName& MacroName)
 {
-if (PlayingMacros.Remove(MacroName) > 0)
+bool bStopped = false;
+for (int32 Index = ActiveInstanceCount - 1; Index >= 0; --Index)
+{
+if (Instances[Index].MacroName != MacroName)
+{
+continue;
+}
+
+bStopped = true;
+if (bTicking)
+{
+// Finished by the tick loop so it can keep walking the pool
+Instances[Index].bStopRequested = true;
+}
+else
+{
+FinishInstance(Index);
+}
+}
+
+if (bStopped)
 {
 UE_LOG(LogTemp, Log, TEXT("P_MEIS: Stopped macro: %s"), *MacroName.ToString());
-return true;
 }
 
-return false;
+return bStopped;
 }
 
 bool UCPP_InputMacroSystem::DeleteMacro(const FName& MacroName)
@@ -62,7 +165,8 @@ return Macro.MacroName == MacroName;
 
 if (RegisteredMacros.RemoveAll(RemoveByName) > 0)
 {
-PlayingMacros.Remove(MacroName);
+StopMacro(MacroName);
+Programs.Remove(MacroName);
 MacroCooldowns.Remove(MacroName);
 UE_LOG(LogTemp, Log, TEXT("P_MEIS: Deleted macro: %s"), *MacroName.ToString());
 return true;
@@ -92,5 +196,361 @@ OutMacros = RegisteredMacros;
 
 bool UCPP_InputMacroSystem::IsMacroPlaying(const FName& MacroName) const
 {
-return PlayingMacros.Contains(MacroName);
+for (int32 Index = 0; Index < ActiveInstanceCount; ++Index)
+{
+if (Instances[Index].MacroName == MacroName && !Instances[Index].bStopRequested)
+{
+return true;
+}
+}
+
+return false;
+}
+
+void UCPP_InputMacroSystem::SetIntegration(UCPP_EnhancedInputIntegration* NewIntegration)
+{
+Integration = NewIntegration;
+}
+
+FName UCPP_InputMacroSystem::ResolveStepKey(const FKey& Key, const UCPP_EnhancedInputIntegration* TargetIntegration)
+{
+UCPP_InputBindingManager* Manager = GEngine ? GEngine->GetEngineSubsystem<UCPP_InputBindingManager>() : nullptr;
+if (!Manager || !TargetIntegration)
+{
+return NAME_None;
+}
+
+TArray<FName> Actions;
+Manager->GetActionsForKey(TargetIntegration->GetPlayerController(), Key, Actions);
+if (Actions.Num() > 1)
+{
+UE_LOG(LogTemp, Verbose, TEXT("P_MEIS: Macro key %s is bound to %d actions, using %s"), *Key.ToString(), Actions.Num(), *Actions[0].ToString());
+}
+return Actions.Num() > 0 ? Actions[0] : NAME_None;
+}
+
+// ==================== Compiler ====================
+
+bool UCPP_InputMacroSystem::LowerSteps(const TArray<FS_MacroStep>& Steps, bool bLoop, FResolveStepKey ResolveKey, TArray<FS_MacroInstruction>& OutInstructions)
+{
+auto Emit = [&OutInstructions](EP_MEIS_MacroOp Op, const FName& ActionName, float Value)
+{
+FS_MacroInstruction& Instruction = OutInstructions.AddDefaulted_GetRef();
+Instruction.Op = Op;
+Instruction.ActionName = ActionName;
+Instruction.Value = Value;
+};
+
+for (int32 Index = 0; Index < Steps.Num(); ++Index)
+{
+const FS_MacroStep& Step = Steps[Index];
+
+// Injection goes through actions, so a key-only step becomes the action its key is bound to
+FName ActionName = Step.ActionName;
+if (ActionName.IsNone() && Step.Key.IsValid())
+{
+ActionName = ResolveKey(Step.Key);
+if (ActionName.IsNone())
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Macro step %d uses key %s, which is not bound to any action"), Index, *Step.Key.ToString());
+return false;
+}
+}
+
+if (ActionName.IsNone())
+{
+// Neither key nor action: a pure delay
+Emit(EP_MEIS_MacroOp::Wait, NAME_None, Step.Duration + Step.DelayAfter);
+continue;
+}
+
+Emit(EP_MEIS_MacroOp::Press, ActionName, 0.0f);
+if (Step.Duration > 0.0f)
+{
+Emit(EP_MEIS_MacroOp::Wait, NAME_None, Step.Duration);
+}
+if (!Step.bIsHold)
+{
+Emit(EP_MEIS_MacroOp::Release, ActionName, 0.0f);
+}
+if (Step.DelayAfter > 0.0f)
+{
+Emit(EP_MEIS_MacroOp::Wait, NAME_None, Step.DelayAfter);
+}
+}
+
+if (bLoop && OutInstructions.Num() > 0)
+{
+Emit(EP_MEIS_MacroOp::Jump, NAME_None, 0.0f);
+}
+return true;
+}
+
+bool UCPP_InputMacroSystem::CompileMacro(const FS_InputMacro& Macro, FResolveStepKey ResolveKey, FMacroProgram& OutProgram)
+{
+TArray<FS_MacroInstruction> Lowered;
+if (Macro.Instructions.Num() == 0 && !LowerSteps(Macro.Steps, Macro.bLoop, ResolveKey, Lowered))
+{
+return false;
+}
+const TArray<FS_MacroInstruction>& Source = Macro.Instructions.Num() > 0 ? Macro.Instructions : Lowered;
+
+OutProgram = FMacroProgram();
+OutProgram.Cooldown = Macro.Cooldown;
+OutProgram.bResolvesKeys = Macro.Instructions.Num() == 0 && Macro.Steps.ContainsByPredicate([](const FS_MacroStep& Step)
+{ return Step.ActionName.IsNone() && Step.Key.IsValid(); });
+
+if (Source.Num() > MAX_uint16)
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Macro %s has too many instructions (%d)"), *Macro.MacroName.ToString(), Source.Num());
+return false;
+}
+
+OutProgram.Code.Reserve(Source.Num());
+for (int32 Index = 0; Index < Source.Num(); ++Index)
+{
+const FS_MacroInstruction& In = Source[Index];
+FMacroInstruction Out;
+Out.Op = In.Op;
+Out.Operand = In.Value;
+
+switch (In.Op)
+{
+case EP_MEIS_MacroOp::Press:
+case EP_MEIS_MacroOp::Release:
+case EP_MEIS_MacroOp::WaitUntilHeld:
+case EP_MEIS_MacroOp::WaitUntilReleased:
+case EP_MEIS_MacroOp::WaitUntilAxisAbove:
+case EP_MEIS_MacroOp::JumpIfHeld:
+case EP_MEIS_MacroOp::JumpIfReleased:
+{
+const int32 Slot = In.ActionName.IsNone() ? INDEX_NONE : OutProgram.Actions.AddUnique(In.ActionName);
+if (Slot == INDEX_NONE || Slot >= FMacroProgram::MaxActions)
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Macro %s instruction %d needs an action (max %d distinct actions)"), *Macro.MacroName.ToString(), Index, FMacroProgram::MaxActions);
+return false;
+}
+Out.Slot = static_cast<uint8>(Slot);
+break;
+}
+
+case EP_MEIS_MacroOp::SetCounter:
+case EP_MEIS_MacroOp::LoopCounter:
+if (In.Counter < 0 || In.Counter >= FMacroProgram::MaxCounters)
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Macro %s instruction %d uses counter %d (max %d)"), *Macro.MacroName.ToString(), Index, In.Counter, FMacroProgram::MaxCounters);
+return false;
+}
+Out.Slot = static_cast<uint8>(In.Counter);
+break;
+
+default:
+break;
+}
+
+const bool bJumps = In.Op == EP_MEIS_MacroOp::LoopCounter || In.Op == EP_MEIS_MacroOp::Jump || In.Op == EP_MEIS_MacroOp::JumpIfHeld || In.Op == EP_MEIS_MacroOp::JumpIfReleased;
+if (bJumps)
+{
+if (!Source.IsValidIndex(In.JumpTarget))
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Macro %s instruction %d jumps out of range (%d)"), *Macro.MacroName.ToString(), Index, In.JumpTarget);
+return false;
+}
+Out.Target = static_cast<uint16>(In.JumpTarget);
+}
+
+OutProgram.Code.Add(Out);
+}
+
+return true;
+}
+
+// ==================== Interpreter ====================
+
+void UCPP_InputMacroSystem::Tick(float DeltaTime)
+{
+MacroTime += DeltaTime;
+
+if (bCooldownsActive)
+{
+bCooldownsActive = false;
+for (TPair<FName, float>& Pair : MacroCooldowns)
+{
+if (Pair.Value > 0.0f)
+{
+Pair.Value = FMath::Max(Pair.Value - DeltaTime, 0.0f);
+bCooldownsActive |= Pair.Value > 0.0f;
+}
+}
+}
+
+bTicking = true;
+for (int32 Index = 0; Index < ActiveInstanceCount; ++Index)
+{
+FMacroInstance& Instance = Instances[Index];
+if (!Instance.bStopRequested && !RunInstance(Instance))
+{
+Instance.bStopRequested = true;
+}
+}
+bTicking = false;
+
+// Compact finished instances (back to front so swaps only move live ones)
+for (int32 Index = ActiveInstanceCount - 1; Index >= 0; --Index)
+{
+if (Instances[Index].bStopRequested)
+{
+FinishInstance(Index);
+}
+}
+}
+
+bool UCPP_InputMacroSystem::RunInstance(FMacroInstance& Instance)
+{
+UCPP_EnhancedInputIntegration* Target = Instance.Integration.Get();
+if (!Target || !Instance.Program.IsValid())
+{
+return false;
+}
+
+const FMacroProgram& Program = *Instance.Program;
+const int32 CodeNum = Program.Code.Num();
+
+bool bYield = false;
+for (int32 Budget = MaxInstructionsPerTick; Budget > 0 && !bYield; --Budget)
+{
+if (Instance.PC >= CodeNum)
+{
+return false;
+}
+
+const FMacroInstruction& Instruction = Program.Code[Instance.PC];
+const uint32 Bit = 1u << Instruction.Slot;
+
+switch (Instruction.Op)
+{
+case EP_MEIS_MacroOp::Press:
+if (!(Instance.HeldMask & Bit))
+{
+Instance.HeldMask |= Bit;
+Target->InjectActionStarted(Program.Actions[Instruction.Slot]);
+}
+Instance.PC++;
+break;
+
+case EP_MEIS_MacroOp::Release:
+if (Instance.HeldMask & Bit)
+{
+Instance.HeldMask &= ~Bit;
+Target->InjectActionCompleted(Program.Actions[Instruction.Slot]);
+}
+Instance.PC++;
+break;
+
+case EP_MEIS_MacroOp::Wait:
+if (!Instance.bWaiting)
+{
+Instance.WaitUntil = MacroTime + Instruction.Operand;
+Instance.bWaiting = true;
+}
+if (MacroTime < Instance.WaitUntil)
+{
+bYield = true;
+break;
+}
+Instance.bWaiting = false;
+Instance.PC++;
+break;
+
+case EP_MEIS_MacroOp::WaitUntilHeld:
+bYield = !Target->IsActionHeld(Program.Actions[Instruction.Slot]);
+Instance.PC += bYield ? 0 : 1;
+break;
+
+case EP_MEIS_MacroOp::WaitUntilReleased:
+bYield = Target->IsActionHeld(Program.Actions[Instruction.Slot]);
+Instance.PC += bYield ? 0 : 1;
+break;
+
+case EP_MEIS_MacroOp::WaitUntilAxisAbove:
+bYield = Target->GetActionValue(Program.Actions[Instruction.Slot]).GetMagnitude() <= Instruction.Operand;
+Instance.PC += bYield ? 0 : 1;
+break;
+
+case EP_MEIS_MacroOp::SetCounter:
+Instance.Counters[Instruction.Slot] = FMath::FloorToInt32(Instruction.Operand);
+Instance.PC++;
+break;
+
+case EP_MEIS_MacroOp::LoopCounter:
+Instance.PC = --Instance.Counters[Instruction.Slot] > 0 ? Instruction.Target : Instance.PC + 1;
+break;
+
+case EP_MEIS_MacroOp::Jump:
+Instance.PC = Instruction.Target;
+break;
+
+case EP_MEIS_MacroOp::JumpIfHeld:
+Instance.PC = Target->IsActionHeld(Program.Actions[Instruction.Slot]) ? Instruction.Target : Instance.PC + 1;
+break;
+
+case EP_MEIS_MacroOp::JumpIfReleased:
+Instance.PC = !Target->IsActionHeld(Program.Actions[Instruction.Slot]) ? Instruction.Target : Instance.PC + 1;
+break;
+
+case EP_MEIS_MacroOp::End:
+default:
+return false;
+}
+}
+
+// Held actions repeat Triggered every tick, like a physically held key
+for (uint32 Mask = Instance.HeldMask; Mask != 0; Mask &= Mask - 1)
+{
+Target->InjectActionTriggered(Program.Actions[FMath::CountTrailingZeros(Mask)]);
+}
+
+return true;
+}
+
+void UCPP_InputMacroSystem::FinishInstance(int32 Index)
+{
+// Free the slot before releasing anything - release handlers may start new macros
+const TSharedPtr<const FMacroProgram> Program = MoveTemp(Instances[Index].Program);
+UCPP_EnhancedInputIntegration* Target = Instances[Index].Integration.Get();
+const uint32 HeldMask = Instances[Index].HeldMask;
+const FName MacroName = Instances[Index].MacroName;
+
+const int32 Last = ActiveInstanceCount - 1;
+if (Index != Last)
+{
+Swap(Instances[Index], Instances[Last]);
+}
+Instances[Last] = FMacroInstance();
+ActiveInstanceCount--;
+
+if (Target && Program.IsValid())
+{
+for (uint32 Mask = HeldMask; Mask != 0; Mask &= Mask - 1)
+{
+Target->InjectActionCompleted(Program->Actions[FMath::CountTrailingZeros(Mask)]);
+}
+}
+
+UE_LOG(LogTemp, Verbose, TEXT("P_MEIS: Macro finished: %s"), *MacroName.ToString());
+}
+
+bool UCPP_InputMacroSystem::IsTickable() const
+{
+return ActiveInstanceCount > 0 || bCooldownsActive;
+}
+
+ETickableTickType UCPP_InputMacroSystem::GetTickableTickType() const
+{
+return HasAnyFlags(RF_ClassDefaultObject) ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+TStatId UCPP_InputMacroSystem::GetStatId() const
+{
+RETURN_QUICK_DECLARE_CYCLE_STAT(UCPP_InputMacroSystem, STATGROUP_Tickables);
 }
@@ -7,8 +7,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Tickable.h"
+#include "Templates/Function.h"
 #include "CPP_InputMacroSystem.generated.h"
 
+class UCPP_EnhancedInputIntegration;
+
 /**
  * Single macro step/command
  */
@@ -20,16 +24,85 @@ GENERATED_BODY()
 UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Macro")
 FKey Key;
 
+/**
+ * Action injected for this step
+ * When None, Key is resolved to the action it is bound to in the player's profile at register time;
+ * steps with neither only contribute their timing.
+ */
+UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Macro")
+FName ActionName;
+
 UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Macro")
 float Duration = 0.1f;
 
 UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Macro")
 float DelayAfter = 0.0f;
 
+/** Keep the action held after Duration until the macro ends */
 UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Macro")
 bool bIsHold = false;
 };
 
+/**
+ * Macro bytecode operations
+ */
+UENUM(BlueprintType)
+enum class EP_MEIS_MacroOp : uint8
+{
+// Inject Started for ActionName; it then repeats Triggered every tick until released
+Press = 0 UMETA(DisplayName = "Press"),
+// Inject Completed for ActionName
+Release = 1 UMETA(DisplayName = "Release"),
+// Wait Value seconds
+Wait = 2 UMETA(DisplayName = "Wait"),
+// Wait until ActionName is held
+WaitUntilHeld = 3 UMETA(DisplayName = "Wait Until Held"),
+// Wait until ActionName is released
+WaitUntilReleased = 4 UMETA(DisplayName = "Wait Until Released"),
+// Wait until ActionName's value magnitude exceeds Value
+WaitUntilAxisAbove = 5 UMETA(DisplayName = "Wait Until Axis Above"),
+// Counter = Value
+SetCounter = 6 UMETA(DisplayName = "Set Counter"),
+// Decrement Counter; jump to JumpTarget while it is above zero
+LoopCounter = 7 UMETA(DisplayName = "Loop Counter"),
+// Jump to JumpTarget
+Jump = 8 UMETA(DisplayName = "Jump"),
+// Jump to JumpTarget if ActionName is held
+JumpIfHeld = 9 UMETA(DisplayName = "Jump If Held"),
+// Jump to JumpTarget if ActionName is not held
+JumpIfReleased = 10 UMETA(DisplayName = "Jump If Released"),
+// Stop the macro (releases anything it still holds)
+End = 11 UMETA(DisplayName = "End")
+};
+
+/**
+ * One authored macro instruction (assembled into FMacroInstruction on register)
+ */
+USTRUCT(BlueprintType)
+struct FS_MacroInstruction
+{
+GENERATED_BODY()
+
+UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Macro")
+EP_MEIS_MacroOp Op = EP_MEIS_MacroOp::End;
+
+/** Action for Press, Release, WaitUntil* and JumpIf* ops */
+UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Macro")
+FName ActionName;
+
+/** Seconds for Wait, threshold for WaitUntilAxisAbove, count for SetCounter */
+UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Macro")
+float Value = 0.0f;
+
+/** Counter index for SetCounter/LoopCounter */
+UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Macro", meta = (ClampMin = "0", ClampMax = "3"))
+int32 Counter = 0;
+
+/** Instruction index for LoopCounter/Jump* */
+UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Macro", meta = (ClampMin = "0"))
+int32 JumpTarget = 0;
+};
+
 /**
  * Complete input macro
  */
@@ -50,6 +123,10 @@ FText Description;
 UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Macro")
 TArray<FS_MacroStep> Steps;
 
+/** Conditional program; when set, Steps and bLoop are ignored */
+UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Macro")
+TArray<FS_MacroInstruction> Instructions;
+
 UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Macro")
 float Cooldown = 0.0f;
 
@@ -60,21 +137,83 @@ UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Macro")
 bool bLoop = false;
 };
 
+/**
+ * Compact runtime instruction (8 bytes)
+ * Slot is an action slot or counter index, Target a jump target
+ */
+struct FMacroInstruction
+{
+EP_MEIS_MacroOp Op = EP_MEIS_MacroOp::End;
+uint8 Slot = 0;
+uint16 Target = 0;
+float Operand = 0.0f;
+};
+
+/**
+ * Assembled macro: bytecode plus the action names it refers to by slot
+ */
+struct FMacroProgram
+{
+static constexpr int32 MaxActions = 32;
+static constexpr int32 MaxCounters = 4;
+
+TArray<FMacroInstruction> Code;
+TArray<FName> Actions;
+float Cooldown = 0.0f;
+
+/** Key-only steps were resolved to actions; recompiled at play against the current bindings */
+bool bResolvesKeys = false;
+};
+
+/**
+ * One running macro; lives in a preallocated pool
+ */
+struct FMacroInstance
+{
+TSharedPtr<const FMacroProgram> Program;
+TWeakObjectPtr<UCPP_EnhancedInputIntegration> Integration;
+FName MacroName;
+double WaitUntil = 0.0;
+int32 PC = 0;
+uint32 HeldMask = 0;
+int32 Counters[FMacroProgram::MaxCounters] = {};
+bool bWaiting = false;
+bool bStopRequested = false;
+};
+
 /**
  * Input Macro System Manager
+ *
+ * Macros compile to bytecode on register (step lists included) and run on a
+ * fixed pool of instances ticked once per frame. Each instance executes until it
+ * waits or hits MaxInstructionsPerTick, and injects through the Integration's Inject* functions.
  */
 UCLASS()
-class P_MEIS_API UCPP_InputMacroSystem : public UObject
+class P_MEIS_API UCPP_InputMacroSystem : public UObject, public FTickableGameObject
 {
 GENERATED_BODY()
 
 public:
+/**
+ * Compile and register a macro
+ * Key-only steps are checked against the bindings of the SetIntegration player; the macro is rejected if one is unbound.
+ * They are resolved again on every play, so later rebinds and profile applies are picked up.
+ */
 UFUNCTION(BlueprintCallable, Category = "Input Binding|Macro")
 bool RegisterMacro(const FS_InputMacro& Macro);
 
+/** Play on the default Integration (see SetIntegration) */
 UFUNCTION(BlueprintCallable, Category = "Input Binding|Macro")
 bool PlayMacro(const FName& MacroName);
 
+/**
+ * Play on a specific player's Integration; several players can run macros at once
+ * Fails if a key-only step's key is no longer bound for that player.
+ */
+UFUNCTION(BlueprintCallable, Category = "Input Binding|Macro")
+bool PlayMacroOn(const FName& MacroName, UCPP_EnhancedInputIntegration* TargetIntegration);
+
+/** Stop every running instance of a macro (held actions are released) */
 UFUNCTION(BlueprintCallable, Category = "Input Binding|Macro")
 bool StopMacro(const FName& MacroName);
 
@@ -90,13 +229,77 @@ void GetAllMacros(TArray<FS_InputMacro>& OutMacros);
 UFUNCTION(BlueprintPure, Category = "Input Binding|Macro")
 bool IsMacroPlaying(const FName& MacroName) const;
 
+/** Integration used by PlayMacro */
+UFUNCTION(BlueprintCallable, Category = "Input Binding|Macro")
+void SetIntegration(UCPP_EnhancedInputIntegration* NewIntegration);
+
+UFUNCTION(BlueprintPure, Category = "Input Binding|Macro")
+int32 GetRunningMacroCount() const { return ActiveInstanceCount; }
+
+/** Action a key-only step stands for; NAME_None if the key is not bound */
+using FResolveStepKey = TFunctionRef<FName(const FKey& Key)>;
+
+/**
+ * Assemble a macro into bytecode
+ * @param Macro Macro to compile (Instructions, or Steps when Instructions is empty)
+ * @param ResolveKey Maps the keys of key-only steps to actions
+ * @param OutProgram Assembled program
+ * @return False if a step key is unbound, an action/counter limit is exceeded or a jump target is out of range
+ */
+static bool CompileMacro(const FS_InputMacro& Macro, FResolveStepKey ResolveKey, FMacroProgram& OutProgram);
+
+/**
+ * Lower a step list (and bLoop) to instructions
+ * @return False if a key-only step's key does not resolve to an action
+ */
+static bool LowerSteps(const TArray<FS_MacroStep>& Steps, bool bLoop, FResolveStepKey ResolveKey, TArray<FS_MacroInstruction>& OutInstructions);
+
+/** Size of the instance pool, allocated on first play */
+UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Binding|Macro", meta = (ClampMin = "1"))
+int32 MaxInstances = 64;
+
+/** Instructions one instance may run per tick before yielding (bounds loops without waits) */
+UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Binding|Macro", meta = (ClampMin = "1"))
+int32 MaxInstructionsPerTick = 64;
+
+// FTickableGameObject
+virtual void Tick(float DeltaTime) override;
+virtual bool IsTickable() const override;
+virtual ETickableTickType GetTickableTickType() const override;
+virtual TStatId GetStatId() const override;
+
 private:
 UPROPERTY()
 TArray<FS_InputMacro> RegisteredMacros;
 
 UPROPERTY()
-TArray<FName> PlayingMacros;
+TMap<FName, float> MacroCooldowns;
 
 UPROPERTY()
-TMap<FName, float> MacroCooldowns;
+UCPP_EnhancedInputIntegration* Integration;
+
+/** Compiled programs by macro name; running instances keep theirs alive */
+TMap<FName, TSharedPtr<const FMacroProgram>> Programs;
+
+/** Instance pool; [0, ActiveInstanceCount) are running */
+TArray<FMacroInstance> Instances;
+int32 ActiveInstanceCount = 0;
+
+/** Accumulated tick time used for waits */
+double MacroTime = 0.0;
+
+/** Instances are only compacted outside the tick loop */
+bool bTicking = false;
+
+/** Some cooldown is still counting down */
+bool bCooldownsActive = false;
+
+/** Run one instance; returns false once it has finished */
+bool RunInstance(FMacroInstance& Instance);
+
+/** Release held actions, start the cooldown and free the pool slot */
+void FinishInstance(int32 Index);
+
+/** First action Key is bound to for the player of TargetIntegration */
+static FName ResolveStepKey(const FKey& Key, const UCPP_EnhancedInputIntegration* TargetIntegration);
 };
@@ -0,0 +1,271 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Command Component Implementation
+ * @Date: 19/10/2026
+ */
+
+#include "Network/CPP_InputCommandComponent.h"
+#include "Manager/CPP_InputBindingManager.h"
+#include "Integration/CPP_EnhancedInputIntegration.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/Engine.h"
+#include "Serialization/BitWriter.h"
+#include "Serialization/BitReader.h"
+
+UCPP_InputCommandComponent::UCPP_InputCommandComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+    PrimaryComponentTick.TickGroup = TG_PrePhysics;
+    SetIsReplicatedByDefault(true);
+}
+
+void UCPP_InputCommandComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (IsReceivingCommands())
+    {
+        RebuildLayout();
+        return;
+    }
+
+    // The client may not know it owns the controller yet; the first tick builds the layout
+    if (GetNetMode() == NM_Client)
+    {
+        // Capture after the controller has processed this frame's input
+        AddTickPrerequisiteActor(GetOwner());
+        SetComponentTickEnabled(true);
+    }
+}
+
+void UCPP_InputCommandComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (IsReceivingCommands())
+    {
+        Feeder.ReleaseAll(GetIntegration(), Layout);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+bool UCPP_InputCommandComponent::RebuildLayout()
+{
+    if (IsReceivingCommands() && Layout.IsValid())
+    {
+        Feeder.ReleaseAll(GetIntegration(), Layout);
+    }
+
+    // Frame numbers keep counting so a rebuild on one side never makes the other drop frames as old
+    Layout = FInputCommandLayout();
+    History.Reset();
+    LastAckedFrame = INDEX_NONE;
+
+    UCPP_InputBindingManager *Manager = GEngine ? GEngine->GetEngineSubsystem<UCPP_InputBindingManager>() : nullptr;
+    FS_InputProfile Profile;
+    if (!Manager || !Manager->GetTemplate(LayoutTemplate, Profile))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Input command layout template '%s' not found, commands disabled"), *LayoutTemplate.ToString());
+        return false;
+    }
+
+    Layout = FInputCommandLayout::Build(Profile, Settings);
+    Feeder.Reset(Layout);
+    if (!Layout.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Input command layout template '%s' has no actions"), *LayoutTemplate.ToString());
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("P_MEIS: Input command layout '%s' - %d digital, %d axis components x %d bits (hash %08x)"),
+           *LayoutTemplate.ToString(), Layout.DigitalActions.Num(), Layout.NumAxisComponents, Layout.Settings.AxisBits, Layout.Hash);
+    return true;
+}
+
+bool UCPP_InputCommandComponent::IsSendingCommands() const
+{
+    const APlayerController *PC = GetPlayerController();
+    return PC && PC->IsLocalController() && !PC->HasAuthority();
+}
+
+bool UCPP_InputCommandComponent::IsReceivingCommands() const
+{
+    const APlayerController *PC = GetPlayerController();
+    return PC && PC->HasAuthority() && !PC->IsLocalController();
+}
+
+APlayerController *UCPP_InputCommandComponent::GetPlayerController() const
+{
+    return Cast<APlayerController>(GetOwner());
+}
+
+UCPP_EnhancedInputIntegration *UCPP_InputCommandComponent::GetIntegration() const
+{
+    APlayerController *PC = GetPlayerController();
+    UCPP_InputBindingManager *Manager = GEngine ? GEngine->GetEngineSubsystem<UCPP_InputBindingManager>() : nullptr;
+    if (!PC || !Manager)
+    {
+        return nullptr;
+    }
+
+    // Locally the player's own integration; on the server the controller-registered one
+    return PC->IsLocalController() ? Manager->GetIntegrationForPlayer(PC) : Manager->GetIntegrationForController(PC);
+}
+
+// ==================== Client ====================
+
+void UCPP_InputCommandComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (!IsSendingCommands())
+    {
+        return;
+    }
+    if (!Layout.IsValid() && !RebuildLayout())
+    {
+        SetComponentTickEnabled(false);
+        return;
+    }
+
+    FInputCommandFrame Frame;
+    Frame.Reset(Layout, CurrentFrame == INDEX_NONE ? 0 : CurrentFrame + 1);
+    CaptureFrame(Frame);
+    CurrentFrame = Frame.Frame;
+    History.Store(Frame);
+
+    SendCommands();
+}
+
+void UCPP_InputCommandComponent::CaptureFrame(FInputCommandFrame &OutFrame) const
+{
+    const UCPP_EnhancedInputIntegration *Integration = GetIntegration();
+    if (!Integration)
+    {
+        return;
+    }
+
+    for (int32 Index = 0; Index < Layout.DigitalActions.Num(); ++Index)
+    {
+        OutFrame.SetDigital(Index, Integration->IsActionHeld(Layout.DigitalActions[Index]));
+    }
+
+    int32 Component = 0;
+    for (const FInputCommandLayout::FAxis &Axis : Layout.Axes)
+    {
+        // Last value sticks after Completed, so only held axes contribute
+        if (Integration->IsActionHeld(Axis.Name))
+        {
+            const FVector Value = Integration->GetActionValue(Axis.Name).Get<FVector>();
+            for (int32 Offset = 0; Offset < Axis.Components; ++Offset)
+            {
+                OutFrame.AxisValues[Component + Offset] = Layout.Quantize(Value[Offset]);
+            }
+        }
+        Component += Axis.Components;
+    }
+}
+
+void UCPP_InputCommandComponent::SendCommands()
+{
+    const FInputCommandFrame *Baseline = nullptr;
+    if (LastAckedFrame != INDEX_NONE && CurrentFrame - LastAckedFrame < FInputCommandHistory::HistorySize)
+    {
+        Baseline = History.Find(LastAckedFrame);
+    }
+
+    int32 FirstFrame = FMath::Max(CurrentFrame - Layout.Settings.RedundantFrames + 1, 0);
+    if (LastAckedFrame != INDEX_NONE)
+    {
+        FirstFrame = FMath::Max(FirstFrame, LastAckedFrame + 1);
+    }
+
+    FInputCommandSerializer::FFrameArray Frames;
+    for (int32 FrameNumber = FirstFrame; FrameNumber <= CurrentFrame; ++FrameNumber)
+    {
+        if (const FInputCommandFrame *Frame = History.Find(FrameNumber))
+        {
+            Frames.Add(*Frame);
+        }
+    }
+    if (Frames.Num() == 0)
+    {
+        return;
+    }
+
+    FBitWriter Writer(256, true);
+    FInputCommandSerializer::Write(Writer, Layout, Frames, Baseline);
+    if (Writer.IsError())
+    {
+        return;
+    }
+
+    const int32 NumBits = static_cast<int32>(Writer.GetNumBits());
+    ServerReceiveInputCommands(TArray<uint8>(Writer.GetData(), Writer.GetNumBytes()), NumBits);
+
+    ++Stats.PacketsSent;
+    Stats.PayloadBits += NumBits;
+    if (Baseline)
+    {
+        ++Stats.DeltaFrames;
+    }
+}
+
+void UCPP_InputCommandComponent::ClientAckInputCommand_Implementation(int32 Frame)
+{
+    // Unreliable: acks can arrive out of order or for frames we no longer track
+    if (Frame > LastAckedFrame && Frame <= CurrentFrame)
+    {
+        LastAckedFrame = Frame;
+    }
+}
+
+// ==================== Server ====================
+
+void UCPP_InputCommandComponent::ServerReceiveInputCommands_Implementation(const TArray<uint8> &Data, int32 NumBits)
+{
+    if (!Layout.IsValid() || NumBits <= 0 || NumBits > Data.Num() * 8)
+    {
+        ++Stats.PacketsRejected;
+        return;
+    }
+
+    ++Stats.PacketsReceived;
+    Stats.PayloadBits += NumBits;
+
+    FBitReader Reader(Data.GetData(), NumBits);
+    FInputCommandSerializer::FFrameArray Frames;
+    if (!FInputCommandSerializer::Read(Reader, Layout, History, Frames) || Frames.Num() == 0)
+    {
+        ++Stats.PacketsRejected;
+        return;
+    }
+
+    UCPP_EnhancedInputIntegration *Integration = GetIntegration();
+    const int32 NewestFrame = Frames.Last().Frame;
+
+    for (const FInputCommandFrame &Frame : Frames)
+    {
+        History.Store(Frame);
+        if (Frame.Frame <= LastAppliedFrame)
+        {
+            continue;
+        }
+
+        if (LastAppliedFrame != INDEX_NONE && Frame.Frame > LastAppliedFrame + 1)
+        {
+            Stats.FramesLost += Frame.Frame - LastAppliedFrame - 1;
+        }
+        if (Frame.Frame != NewestFrame)
+        {
+            // Only still unapplied because the packet that carried it first never arrived
+            ++Stats.FramesRecovered;
+        }
+
+        Feeder.Apply(Integration, Layout, Frame);
+        LastAppliedFrame = Frame.Frame;
+        ++Stats.FramesApplied;
+    }
+
+    ClientAckInputCommand(NewestFrame);
+}
@@ -0,0 +1,100 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Command Component - Replicates per-frame action state from a client to the server
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "InputBinding/FS_InputCommand.h"
+#include "Network/InputCommandSerializer.h"
+#include "Network/InputCommandFeeder.h"
+#include "CPP_InputCommandComponent.generated.h"
+
+class APlayerController;
+class UCPP_EnhancedInputIntegration;
+
+/**
+ * Add to a PlayerController to simulate its input on the server
+ *
+ * Owning client: every tick captures the held state / value of every action in the layout from its
+ * P_MEIS integration, and sends the newest frame plus any unacknowledged ones (up to
+ * Settings.RedundantFrames) as one unreliable, bit-packed RPC, delta-coded against the last acked frame.
+ *
+ * Server: decodes, applies each new frame in order to the controller's integration
+ * (GetIntegrationForController) through InjectActionEvent, and acks the newest frame.
+ * Bind to that integration's action delegates on the server as you would locally.
+ *
+ * Both sides build the layout from the LayoutTemplate profile template, so it must exist on both.
+ */
+UCLASS(ClassGroup = (Input), meta = (BlueprintSpawnableComponent))
+class P_MEIS_API UCPP_InputCommandComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UCPP_InputCommandComponent();
+
+    /** Profile template whose action list defines the command layout */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Command")
+    FName LayoutTemplate = FName(TEXT("Default"));
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Command")
+    FS_InputCommandSettings Settings;
+
+    /** Rebuild the layout after changing LayoutTemplate/Settings (do it on both sides; packets are rejected until the hashes match) */
+    UFUNCTION(BlueprintCallable, Category = "Input Command")
+    bool RebuildLayout();
+
+    UFUNCTION(BlueprintPure, Category = "Input Command")
+    FS_InputCommandStats GetStats() const { return Stats; }
+
+    UFUNCTION(BlueprintCallable, Category = "Input Command")
+    void ResetStats() { Stats = FS_InputCommandStats(); }
+
+    /** True on the owning client of a remote connection (the side that sends commands) */
+    UFUNCTION(BlueprintPure, Category = "Input Command")
+    bool IsSendingCommands() const;
+
+    /** True on the server for a remote client's controller (the side that applies commands) */
+    UFUNCTION(BlueprintPure, Category = "Input Command")
+    bool IsReceivingCommands() const;
+
+    const FInputCommandLayout &GetLayout() const { return Layout; }
+
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    UFUNCTION(Server, Unreliable)
+    void ServerReceiveInputCommands(const TArray<uint8> &Data, int32 NumBits);
+
+    UFUNCTION(Client, Unreliable)
+    void ClientAckInputCommand(int32 Frame);
+
+private:
+    APlayerController *GetPlayerController() const;
+    UCPP_EnhancedInputIntegration *GetIntegration() const;
+
+    /** Owning client: read this frame's action state from the local integration */
+    void CaptureFrame(FInputCommandFrame &OutFrame) const;
+
+    /** Owning client: encode and send frames (LastAckedFrame, CurrentFrame] within the redundancy window */
+    void SendCommands();
+
+    FInputCommandLayout Layout;
+    FInputCommandHistory History;
+    FInputCommandFeeder Feeder;
+    FS_InputCommandStats Stats;
+
+    /** Client: newest captured frame */
+    int32 CurrentFrame = INDEX_NONE;
+    /** Client: newest frame the server acknowledged */
+    int32 LastAckedFrame = INDEX_NONE;
+    /** Server: newest frame fed to the integration */
+    int32 LastAppliedFrame = INDEX_NONE;
+};
@@ -0,0 +1,96 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Command Feeder Implementation
+ * @Date: 19/10/2026
+ */
+
+#include "Network/InputCommandFeeder.h"
+#include "Integration/CPP_EnhancedInputIntegration.h"
+
+void FInputCommandFeeder::Reset(const FInputCommandLayout &Layout)
+{
+    LastFrame.Reset(Layout);
+}
+
+void FInputCommandFeeder::Apply(UCPP_EnhancedInputIntegration *Integration, const FInputCommandLayout &Layout, const FInputCommandFrame &Frame)
+{
+    if (!Integration)
+    {
+        return;
+    }
+    if (LastFrame.DigitalBits.Num() != Frame.DigitalBits.Num() || LastFrame.AxisValues.Num() != Frame.AxisValues.Num())
+    {
+        LastFrame.Reset(Layout);
+    }
+
+    for (int32 Index = 0; Index < Layout.DigitalActions.Num(); ++Index)
+    {
+        const FName &ActionName = Layout.DigitalActions[Index];
+        const bool bWasDown = LastFrame.GetDigital(Index);
+        const bool bIsDown = Frame.GetDigital(Index);
+
+        if (bIsDown)
+        {
+            if (!bWasDown)
+            {
+                Integration->InjectActionEvent(ActionName, ETriggerEvent::Started, FInputActionValue(true));
+            }
+            Integration->InjectActionEvent(ActionName, ETriggerEvent::Triggered, FInputActionValue(true));
+        }
+        else if (bWasDown)
+        {
+            Integration->InjectActionEvent(ActionName, ETriggerEvent::Completed, FInputActionValue(false));
+        }
+    }
+
+    int32 Component = 0;
+    for (const FInputCommandLayout::FAxis &Axis : Layout.Axes)
+    {
+        bool bWasActive = false;
+        bool bIsActive = false;
+        for (int32 Offset = 0; Offset < Axis.Components; ++Offset)
+        {
+            bWasActive |= LastFrame.AxisValues[Component + Offset] != 0;
+            bIsActive |= Frame.AxisValues[Component + Offset] != 0;
+        }
+
+        if (bIsActive)
+        {
+            const FInputActionValue Value = MakeAxisValue(Layout, Frame, Component, Axis.Components);
+            if (!bWasActive)
+            {
+                Integration->InjectActionEvent(Axis.Name, ETriggerEvent::Started, Value);
+            }
+            Integration->InjectActionEvent(Axis.Name, ETriggerEvent::Triggered, Value);
+        }
+        else if (bWasActive)
+        {
+            Integration->InjectActionEvent(Axis.Name, ETriggerEvent::Completed, MakeAxisValue(Layout, Frame, Component, Axis.Components));
+        }
+
+        Component += Axis.Components;
+    }
+
+    LastFrame = Frame;
+}
+
+void FInputCommandFeeder::ReleaseAll(UCPP_EnhancedInputIntegration *Integration, const FInputCommandLayout &Layout)
+{
+    FInputCommandFrame Released;
+    Released.Reset(Layout, LastFrame.Frame);
+    Apply(Integration, Layout, Released);
+}
+
+FInputActionValue FInputCommandFeeder::MakeAxisValue(const FInputCommandLayout &Layout, const FInputCommandFrame &Frame, int32 FirstComponent, int32 Components) const
+{
+    const float X = Layout.Dequantize(Frame.AxisValues[FirstComponent]);
+    switch (Components)
+    {
+    case 3:
+        return FInputActionValue(FVector(X, Layout.Dequantize(Frame.AxisValues[FirstComponent + 1]), Layout.Dequantize(Frame.AxisValues[FirstComponent + 2])));
+    case 2:
+        return FInputActionValue(FVector2D(X, Layout.Dequantize(Frame.AxisValues[FirstComponent + 1])));
+    default:
+        return FInputActionValue(X);
+    }
+}
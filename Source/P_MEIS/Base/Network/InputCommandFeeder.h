@@ -0,0 +1,38 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Command Feeder - Replays received input commands through an integration's injection path
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputActionValue.h"
+#include "Network/InputCommandSerializer.h"
+
+class UCPP_EnhancedInputIntegration;
+
+/**
+ * Turns consecutive command frames into trigger events on the server-side integration
+ *
+ * Digital: press -> Started + Triggered, held -> Triggered, release -> Completed.
+ * Axes: non-zero -> Triggered with the value (Started first when it leaves zero), back to zero -> Completed.
+ */
+class P_MEIS_API FInputCommandFeeder
+{
+public:
+    void Reset(const FInputCommandLayout &Layout);
+
+    /** Apply one frame (frames must arrive in order; gaps are treated as the state just jumping) */
+    void Apply(UCPP_EnhancedInputIntegration *Integration, const FInputCommandLayout &Layout, const FInputCommandFrame &Frame);
+
+    /** Complete everything still held (connection closed, layout changed) */
+    void ReleaseAll(UCPP_EnhancedInputIntegration *Integration, const FInputCommandLayout &Layout);
+
+    const FInputCommandFrame &GetLastFrame() const { return LastFrame; }
+
+private:
+    FInputActionValue MakeAxisValue(const FInputCommandLayout &Layout, const FInputCommandFrame &Frame, int32 FirstComponent, int32 Components) const;
+
+    FInputCommandFrame LastFrame;
+};
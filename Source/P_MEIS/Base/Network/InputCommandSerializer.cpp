@@ -0,0 +1,265 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Command Serializer Implementation
+ * @Date: 19/10/2026
+ */
+
+#include "Network/InputCommandSerializer.h"
+#include "Serialization/BitWriter.h"
+#include "Serialization/BitReader.h"
+
+namespace
+{
+int32 GetComponentCount(EInputActionValueType ValueType)
+{
+    switch (ValueType)
+    {
+    case EInputActionValueType::Axis2D:
+        return 2;
+    case EInputActionValueType::Axis3D:
+        return 3;
+    default:
+        return 1;
+    }
+}
+
+void WriteBits(FBitWriter &Writer, uint32 Value, int32 NumBits)
+{
+    for (int32 Bit = 0; Bit < NumBits; ++Bit)
+    {
+        Writer.WriteBit((Value >> Bit) & 1u);
+    }
+}
+
+uint32 ReadBits(FBitReader &Reader, int32 NumBits)
+{
+    uint32 Value = 0;
+    for (int32 Bit = 0; Bit < NumBits; ++Bit)
+    {
+        Value |= static_cast<uint32>(Reader.ReadBit()) << Bit;
+    }
+    return Value;
+}
+}
+
+// ==================== Layout ====================
+
+FInputCommandLayout FInputCommandLayout::Build(const FS_InputProfile &Profile, const FS_InputCommandSettings &InSettings)
+{
+    FInputCommandLayout Layout;
+    Layout.Settings = InSettings;
+    Layout.Settings.AxisBits = FMath::Clamp(InSettings.AxisBits, 2, 16);
+    Layout.Settings.AxisRange = FMath::Max(InSettings.AxisRange, KINDA_SMALL_NUMBER);
+    Layout.Settings.RedundantFrames = FMath::Clamp(InSettings.RedundantFrames, 1, FInputCommandSerializer::MaxFramesPerPacket);
+
+    for (const FS_InputActionBinding &Binding : Profile.ActionBindings)
+    {
+        if (!Binding.InputActionName.IsNone())
+        {
+            Layout.DigitalActions.AddUnique(Binding.InputActionName);
+        }
+    }
+
+    for (const FS_InputAxisBinding &Binding : Profile.AxisBindings)
+    {
+        if (Binding.InputAxisName.IsNone() || Layout.Axes.ContainsByPredicate([&Binding](const FAxis &Axis)
+                                                                               { return Axis.Name == Binding.InputAxisName; }))
+        {
+            continue;
+        }
+        if (Binding.ValueType == EInputActionValueType::Boolean)
+        {
+            Layout.DigitalActions.AddUnique(Binding.InputAxisName);
+            continue;
+        }
+
+        FAxis &Axis = Layout.Axes.AddDefaulted_GetRef();
+        Axis.Name = Binding.InputAxisName;
+        Axis.Components = GetComponentCount(Binding.ValueType);
+    }
+    Layout.DigitalActions.Sort(FNameLexicalLess());
+    Layout.Axes.Sort([](const FAxis &A, const FAxis &B)
+                     { return A.Name.LexicalLess(B.Name); });
+
+    uint32 Hash = FCrc::MemCrc32(&Layout.Settings.AxisBits, sizeof(int32));
+    Hash = FCrc::MemCrc32(&Layout.Settings.AxisRange, sizeof(float), Hash);
+    for (const FName &Name : Layout.DigitalActions)
+    {
+        Hash = FCrc::StrCrc32(*Name.ToString(), Hash);
+    }
+    for (const FAxis &Axis : Layout.Axes)
+    {
+        Hash = FCrc::StrCrc32(*Axis.Name.ToString(), Hash);
+        Hash = FCrc::MemCrc32(&Axis.Components, sizeof(int32), Hash);
+        Layout.NumAxisComponents += Axis.Components;
+    }
+    Layout.Hash = Hash;
+
+    return Layout;
+}
+
+int32 FInputCommandLayout::Quantize(float Value) const
+{
+    const int32 MaxQ = GetMaxQuantized();
+    const float Normalized = FMath::Clamp(Value / Settings.AxisRange, -1.0f, 1.0f);
+    return FMath::Clamp(FMath::RoundToInt(Normalized * MaxQ), -MaxQ, MaxQ);
+}
+
+float FInputCommandLayout::Dequantize(int32 Quantized) const
+{
+    return static_cast<float>(Quantized) / GetMaxQuantized() * Settings.AxisRange;
+}
+
+// ==================== Frame / History ====================
+
+void FInputCommandFrame::Reset(const FInputCommandLayout &Layout, int32 InFrame)
+{
+    Frame = InFrame;
+    DigitalBits.Init(0u, Layout.GetDigitalWordCount());
+    AxisValues.Init(0, Layout.NumAxisComponents);
+}
+
+void FInputCommandFrame::SetDigital(int32 Index, bool bValue)
+{
+    const uint32 Mask = 1u << (Index & 31);
+    if (bValue)
+    {
+        DigitalBits[Index >> 5] |= Mask;
+    }
+    else
+    {
+        DigitalBits[Index >> 5] &= ~Mask;
+    }
+}
+
+const FInputCommandFrame *FInputCommandHistory::Find(int32 Frame) const
+{
+    if (Frame == INDEX_NONE)
+    {
+        return nullptr;
+    }
+    const FInputCommandFrame &Slot = Frames[Frame & (HistorySize - 1)];
+    return Slot.Frame == Frame ? &Slot : nullptr;
+}
+
+void FInputCommandHistory::Reset()
+{
+    for (FInputCommandFrame &Slot : Frames)
+    {
+        Slot = FInputCommandFrame();
+    }
+}
+
+// ==================== Codec ====================
+
+void FInputCommandSerializer::Write(FBitWriter &Writer, const FInputCommandLayout &Layout, TConstArrayView<FInputCommandFrame> Frames, const FInputCommandFrame *Baseline)
+{
+    check(Frames.Num() > 0 && Frames.Num() <= MaxFramesPerPacket);
+
+    uint32 LayoutHash = Layout.Hash;
+    int32 NewestFrame = Frames.Last().Frame;
+    Writer << LayoutHash;
+    Writer << NewestFrame;
+    WriteBits(Writer, Frames.Num() - 1, 3);
+
+    FInputCommandFrame Zero;
+    Zero.Reset(Layout);
+    const bool bHasBaseline = Baseline != nullptr;
+    Writer.WriteBit(bHasBaseline ? 1 : 0);
+    if (bHasBaseline)
+    {
+        uint32 BaselineOffset = static_cast<uint32>(NewestFrame - Baseline->Frame);
+        Writer.SerializeIntPacked(BaselineOffset);
+    }
+
+    const int32 AxisBits = Layout.Settings.AxisBits;
+    const int32 MaxQ = Layout.GetMaxQuantized();
+    const FInputCommandFrame *Previous = bHasBaseline ? Baseline : &Zero;
+
+    for (const FInputCommandFrame &Frame : Frames)
+    {
+        const bool bDigitalChanged = Frame.DigitalBits != Previous->DigitalBits;
+        Writer.WriteBit(bDigitalChanged ? 1 : 0);
+        if (bDigitalChanged)
+        {
+            for (int32 Index = 0; Index < Layout.DigitalActions.Num(); ++Index)
+            {
+                Writer.WriteBit(Frame.GetDigital(Index) ? 1 : 0);
+            }
+        }
+
+        for (int32 Component = 0; Component < Layout.NumAxisComponents; ++Component)
+        {
+            const bool bChanged = Frame.AxisValues[Component] != Previous->AxisValues[Component];
+            Writer.WriteBit(bChanged ? 1 : 0);
+            if (bChanged)
+            {
+                WriteBits(Writer, static_cast<uint32>(Frame.AxisValues[Component] + MaxQ), AxisBits);
+            }
+        }
+
+        Previous = &Frame;
+    }
+}
+
+bool FInputCommandSerializer::Read(FBitReader &Reader, const FInputCommandLayout &Layout, const FInputCommandHistory &History, FFrameArray &OutFrames)
+{
+    OutFrames.Reset();
+
+    uint32 LayoutHash = 0;
+    int32 NewestFrame = 0;
+    Reader << LayoutHash;
+    Reader << NewestFrame;
+    if (Reader.IsError() || LayoutHash != Layout.Hash)
+    {
+        return false;
+    }
+
+    const int32 FrameCount = static_cast<int32>(ReadBits(Reader, 3)) + 1;
+
+    FInputCommandFrame Zero;
+    Zero.Reset(Layout);
+    const FInputCommandFrame *Previous = &Zero;
+    if (Reader.ReadBit())
+    {
+        uint32 BaselineOffset = 0;
+        Reader.SerializeIntPacked(BaselineOffset);
+        Previous = History.Find(NewestFrame - static_cast<int32>(BaselineOffset));
+        if (!Previous)
+        {
+            return false;
+        }
+    }
+
+    const int32 AxisBits = Layout.Settings.AxisBits;
+    const int32 MaxQ = Layout.GetMaxQuantized();
+    OutFrames.Reserve(FrameCount);
+
+    for (int32 FrameIndex = 0; FrameIndex < FrameCount; ++FrameIndex)
+    {
+        FInputCommandFrame &Frame = OutFrames.AddDefaulted_GetRef();
+        Frame = *Previous;
+        Frame.Frame = NewestFrame - (FrameCount - 1 - FrameIndex);
+
+        if (Reader.ReadBit())
+        {
+            for (int32 Index = 0; Index < Layout.DigitalActions.Num(); ++Index)
+            {
+                Frame.SetDigital(Index, Reader.ReadBit() != 0);
+            }
+        }
+
+        for (int32 Component = 0; Component < Layout.NumAxisComponents; ++Component)
+        {
+            if (Reader.ReadBit())
+            {
+                Frame.AxisValues[Component] = FMath::Clamp(static_cast<int32>(ReadBits(Reader, AxisBits)) - MaxQ, -MaxQ, MaxQ);
+            }
+        }
+
+        // OutFrames was reserved, so the reference stays valid for the next delta
+        Previous = &Frame;
+    }
+
+    return !Reader.IsError();
+}
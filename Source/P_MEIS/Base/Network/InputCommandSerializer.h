@@ -0,0 +1,118 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Command Serializer - Bit-packs per-frame action state for client to server replication
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputBinding/FS_InputCommand.h"
+#include "InputBinding/FS_InputProfile.h"
+
+class FBitWriter;
+class FBitReader;
+
+/**
+ * Which actions a command carries and how, built from a profile's action list
+ *
+ * Digital actions (every action binding) become one bit each; axis bindings become 1-3
+ * quantized components depending on their value type. Names are sorted so client and server
+ * agree on the order; the hash covers names, component counts and quantization settings.
+ */
+struct P_MEIS_API FInputCommandLayout
+{
+    struct FAxis
+    {
+        FName Name;
+        int32 Components = 1;
+    };
+
+    TArray<FName> DigitalActions;
+    TArray<FAxis> Axes;
+    FS_InputCommandSettings Settings;
+    int32 NumAxisComponents = 0;
+    uint32 Hash = 0;
+
+    static FInputCommandLayout Build(const FS_InputProfile &Profile, const FS_InputCommandSettings &InSettings);
+
+    bool IsValid() const { return DigitalActions.Num() > 0 || Axes.Num() > 0; }
+    int32 GetDigitalWordCount() const { return FMath::DivideAndRoundUp(DigitalActions.Num(), 32); }
+
+    /** Float <-> signed quantized value in [-MaxQ, MaxQ], MaxQ = 2^(AxisBits-1) - 1 */
+    int32 Quantize(float Value) const;
+    float Dequantize(int32 Quantized) const;
+    int32 GetMaxQuantized() const { return (1 << (Settings.AxisBits - 1)) - 1; }
+};
+
+/**
+ * One frame of input: digital bitset plus quantized axis components
+ * Inline storage covers 64 digital actions and 8 axis components, so the history ring never touches the heap.
+ */
+struct P_MEIS_API FInputCommandFrame
+{
+    int32 Frame = INDEX_NONE;
+    TArray<uint32, TInlineAllocator<2>> DigitalBits;
+    TArray<int32, TInlineAllocator<8>> AxisValues;
+
+    /** Zeroed frame shaped for Layout (the implicit baseline when nothing is acknowledged) */
+    void Reset(const FInputCommandLayout &Layout, int32 InFrame = INDEX_NONE);
+
+    bool GetDigital(int32 Index) const { return (DigitalBits[Index >> 5] & (1u << (Index & 31))) != 0; }
+    void SetDigital(int32 Index, bool bValue);
+
+    bool HasSameState(const FInputCommandFrame &Other) const
+    {
+        return DigitalBits == Other.DigitalBits && AxisValues == Other.AxisValues;
+    }
+};
+
+/**
+ * Fixed ring of recent frames, looked up by frame number
+ */
+class P_MEIS_API FInputCommandHistory
+{
+public:
+    static constexpr int32 HistorySize = 64;
+
+    void Store(const FInputCommandFrame &Frame) { Frames[Frame.Frame & (HistorySize - 1)] = Frame; }
+
+    /** Frame if it is still in the ring, nullptr once overwritten */
+    const FInputCommandFrame *Find(int32 Frame) const;
+
+    void Reset();
+
+private:
+    FInputCommandFrame Frames[HistorySize];
+};
+
+/**
+ * Packet codec
+ *
+ * A packet carries a run of consecutive frames ending at the newest one. The first frame is
+ * delta-coded against the last frame the server acknowledged (or zero), each following frame
+ * against the one before it. Unchanged digital sets and axis components cost one bit each.
+ *
+ * Layout: [LayoutHash:32][NewestFrame:32][FrameCount-1:3][HasBaseline:1][NewestFrame-Baseline:packed]
+ *         per frame: [DigitalChanged:1][Digital bits...] then per axis component [Changed:1][Value:AxisBits]
+ */
+class P_MEIS_API FInputCommandSerializer
+{
+public:
+    static constexpr int32 MaxFramesPerPacket = 8;
+
+    using FFrameArray = TArray<FInputCommandFrame, TInlineAllocator<MaxFramesPerPacket>>;
+
+    /**
+     * Write Frames (oldest first, consecutive frame numbers)
+     * @param Baseline Acknowledged frame to delta against, or nullptr to delta against zero
+     */
+    static void Write(FBitWriter &Writer, const FInputCommandLayout &Layout, TConstArrayView<FInputCommandFrame> Frames, const FInputCommandFrame *Baseline);
+
+    /**
+     * Read a packet written by Write
+     * @param History Receiver's decoded frames, used to resolve the sender's baseline
+     * @return False on layout mismatch, missing baseline or truncated data
+     */
+    static bool Read(FBitReader &Reader, const FInputCommandLayout &Layout, const FInputCommandHistory &History, FFrameArray &OutFrames);
+};
@@ -0,0 +1,230 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Compressed File Implementation
+ * @Date: 19/10/2026
+ */
+
+#include "Storage/CPP_InputCompressedFile.h"
+#include "HAL/FileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+    const uint32 CompressedFileMagic = 0x315A4D50; // "PMZ1" little-endian
+    // 2: every block carries an explicit stored/compressed flag (1 inferred it from PackedSize == RawSize)
+    const uint8 CompressedFileVersion = 2;
+
+    // Blocks are compressed independently so the reader only ever holds one compressed block in memory
+    const int32 CompressionBlockSize = 64 * 1024;
+
+    // Largest block size a reader accepts from a file header (writers use CompressionBlockSize)
+    const int32 MaxCompressionBlockSize = 16 * 1024 * 1024;
+
+    enum class EBlockStorage : uint8
+    {
+        Stored = 0,
+        Compressed = 1
+    };
+
+    FName GetCompressionMethod(EP_MEIS_CompressionFormat Format)
+    {
+        return Format == EP_MEIS_CompressionFormat::Oodle ? NAME_Oodle : NAME_Zlib;
+    }
+}
+
+void UCPP_InputCompressedFile::WriteCompressed(FArchive &Writer, const FTCHARToUTF8 &Utf8, EP_MEIS_CompressionFormat Format)
+{
+    const FName Method = GetCompressionMethod(Format);
+    const int64 UncompressedSize = Utf8.Length();
+
+    uint32 Magic = CompressedFileMagic;
+    uint8 Version = CompressedFileVersion;
+    uint8 FormatByte = static_cast<uint8>(Format);
+    int32 BlockSize = CompressionBlockSize;
+    int64 TotalSize = UncompressedSize;
+    Writer << Magic << Version << FormatByte << BlockSize << TotalSize;
+
+    TArray<uint8> CompressedBlock;
+    CompressedBlock.SetNumUninitialized(FCompression::CompressMemoryBound(Method, CompressionBlockSize));
+
+    const uint8 *Source = reinterpret_cast<const uint8 *>(Utf8.Get());
+    for (int64 Offset = 0; Offset < UncompressedSize; Offset += CompressionBlockSize)
+    {
+        int32 RawSize = static_cast<int32>(FMath::Min<int64>(CompressionBlockSize, UncompressedSize - Offset));
+        int32 PackedSize = CompressedBlock.Num();
+        uint8 Storage = static_cast<uint8>(EBlockStorage::Compressed);
+
+        if (!FCompression::CompressMemory(Method, CompressedBlock.GetData(), PackedSize, Source + Offset, RawSize) || PackedSize >= RawSize)
+        {
+            // Incompressible or codec unavailable: store the block raw
+            Storage = static_cast<uint8>(EBlockStorage::Stored);
+            PackedSize = RawSize;
+            FMemory::Memcpy(CompressedBlock.GetData(), Source + Offset, RawSize);
+        }
+
+        Writer << Storage << RawSize << PackedSize;
+        Writer.Serialize(CompressedBlock.GetData(), PackedSize);
+    }
+}
+
+bool UCPP_InputCompressedFile::ReadCompressed(FArchive &Reader, FString &OutText)
+{
+    uint32 Magic = 0;
+    uint8 Version = 0;
+    uint8 FormatByte = 0;
+    int32 BlockSize = 0;
+    int64 TotalSize = 0;
+    Reader << Magic << Version << FormatByte << BlockSize << TotalSize;
+
+    if (Magic != CompressedFileMagic || Version == 0 || Version > CompressedFileVersion || BlockSize <= 0 || BlockSize > MaxCompressionBlockSize ||
+        TotalSize < 0 || TotalSize > MAX_int32)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Unsupported compressed file header"));
+        return false;
+    }
+
+    const FName Method = GetCompressionMethod(static_cast<EP_MEIS_CompressionFormat>(FormatByte));
+
+    // Grown block by block, so a lying TotalSize cannot make us allocate more than the blocks actually present
+    TArray<uint8> Utf8;
+    TArray<uint8> CompressedBlock;
+    int64 Offset = 0;
+    while (Offset < TotalSize)
+    {
+        uint8 Storage = static_cast<uint8>(EBlockStorage::Compressed);
+        int32 RawSize = 0;
+        int32 PackedSize = 0;
+        if (Version >= 2)
+        {
+            Reader << Storage;
+        }
+        Reader << RawSize << PackedSize;
+
+        if (Version < 2 && PackedSize == RawSize)
+        {
+            Storage = static_cast<uint8>(EBlockStorage::Stored);
+        }
+
+        const bool bStored = Storage == static_cast<uint8>(EBlockStorage::Stored);
+        const bool bValidStorage = bStored || Storage == static_cast<uint8>(EBlockStorage::Compressed);
+        if (Reader.IsError() || !bValidStorage || RawSize <= 0 || RawSize > BlockSize || Offset + RawSize > TotalSize || PackedSize <= 0 ||
+            (bStored ? PackedSize != RawSize : PackedSize > FCompression::CompressMemoryBound(Method, RawSize)) ||
+            PackedSize > Reader.TotalSize() - Reader.Tell())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Corrupt block in compressed file"));
+            return false;
+        }
+
+        Utf8.SetNumUninitialized(static_cast<int32>(Offset + RawSize), EAllowShrinking::No);
+        uint8 *Dest = Utf8.GetData() + Offset;
+        if (bStored)
+        {
+            Reader.Serialize(Dest, RawSize);
+        }
+        else
+        {
+            CompressedBlock.SetNumUninitialized(PackedSize, EAllowShrinking::No);
+            Reader.Serialize(CompressedBlock.GetData(), PackedSize);
+            if (!FCompression::UncompressMemory(Method, Dest, RawSize, CompressedBlock.GetData(), PackedSize))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to decompress block in compressed file"));
+                return false;
+            }
+        }
+
+        Offset += RawSize;
+    }
+
+    if (Reader.IsError())
+    {
+        return false;
+    }
+
+    FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR *>(Utf8.GetData()), Utf8.Num());
+    OutText = FString(Converted.Length(), Converted.Get());
+    return true;
+}
+
+bool UCPP_InputCompressedFile::SaveStringToFile(const FString &Text, const FString &FilePath, EP_MEIS_CompressionFormat Format)
+{
+    if (Format == EP_MEIS_CompressionFormat::None)
+    {
+        return FFileHelper::SaveStringToFile(Text, *FilePath);
+    }
+
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+    if (!Writer)
+    {
+        return false;
+    }
+
+    FTCHARToUTF8 Utf8(*Text);
+    WriteCompressed(*Writer, Utf8, Format);
+    return Writer->Close();
+}
+
+bool UCPP_InputCompressedFile::LoadFileToString(FString &OutText, const FString &FilePath)
+{
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+    if (!Reader)
+    {
+        return false;
+    }
+
+    uint32 Magic = 0;
+    if (Reader->TotalSize() >= static_cast<int64>(sizeof(Magic)))
+    {
+        *Reader << Magic;
+    }
+
+    if (Magic == CompressedFileMagic)
+    {
+        Reader->Seek(0);
+        return ReadCompressed(*Reader, OutText);
+    }
+
+    // Plain text (legacy JSON); let FFileHelper handle BOM / encoding detection
+    Reader.Reset();
+    return FFileHelper::LoadFileToString(OutText, *FilePath);
+}
+
+void UCPP_InputCompressedFile::EncodeString(const FString &Text, EP_MEIS_CompressionFormat Format, TArray<uint8> &OutBytes)
+{
+    OutBytes.Reset();
+
+    FTCHARToUTF8 Utf8(*Text);
+    if (Format == EP_MEIS_CompressionFormat::None)
+    {
+        OutBytes.Append(reinterpret_cast<const uint8 *>(Utf8.Get()), Utf8.Length());
+        return;
+    }
+
+    FMemoryWriter Writer(OutBytes);
+    WriteCompressed(Writer, Utf8, Format);
+}
+
+bool UCPP_InputCompressedFile::DecodeString(const TArray<uint8> &Bytes, FString &OutText)
+{
+    if (IsCompressed(Bytes))
+    {
+        FMemoryReader Reader(Bytes);
+        return ReadCompressed(Reader, OutText);
+    }
+
+    FFileHelper::BufferToString(OutText, Bytes.GetData(), Bytes.Num());
+    return true;
+}
+
+bool UCPP_InputCompressedFile::IsCompressed(const TArray<uint8> &Bytes)
+{
+    uint32 Magic = 0;
+    if (Bytes.Num() < static_cast<int32>(sizeof(Magic)))
+    {
+        return false;
+    }
+    FMemory::Memcpy(&Magic, Bytes.GetData(), sizeof(Magic));
+    return INTEL_ORDER32(Magic) == CompressedFileMagic;
+}
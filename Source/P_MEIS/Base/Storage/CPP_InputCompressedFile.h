@@ -0,0 +1,61 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Compressed File - Optional FCompression codec for profile, template and analytics files
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CPP_InputCompressedFile.generated.h"
+
+/**
+ * Compression applied when writing P_MEIS files. Reads always detect the format.
+ */
+UENUM(BlueprintType)
+enum class EP_MEIS_CompressionFormat : uint8
+{
+    None = 0 UMETA(DisplayName = "None (Plain Text)"),
+    Zlib = 1 UMETA(DisplayName = "Zlib"),
+    Oodle = 2 UMETA(DisplayName = "Oodle")
+};
+
+/**
+ * Static utility class for reading/writing text files that may be block-compressed.
+ *
+ * Compressed layout: "PMZ1" magic, header, then independently compressed blocks,
+ * so loading can stream block by block from disk instead of reading the file twice.
+ * Files without the magic are treated as plain text (legacy JSON).
+ */
+UCLASS()
+class P_MEIS_API UCPP_InputCompressedFile : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Write text to disk, compressing it unless Format is None
+     * @param Text - UTF-8 encoded before compression
+     * @param FilePath - Destination file
+     * @param Format - Compression to apply
+     * @return True if the file was written
+     */
+    static bool SaveStringToFile(const FString &Text, const FString &FilePath, EP_MEIS_CompressionFormat Format);
+
+    /**
+     * Read a plain or compressed text file (format detected from the header)
+     * @return True if the file was read and decoded
+     */
+    static bool LoadFileToString(FString &OutText, const FString &FilePath);
+
+    /** In-memory equivalents, for backends that do not write files directly */
+    static void EncodeString(const FString &Text, EP_MEIS_CompressionFormat Format, TArray<uint8> &OutBytes);
+    static bool DecodeString(const TArray<uint8> &Bytes, FString &OutText);
+
+    /** True if the bytes start with the compressed file magic */
+    static bool IsCompressed(const TArray<uint8> &Bytes);
+
+private:
+    static void WriteCompressed(FArchive &Writer, const FTCHARToUTF8 &Utf8, EP_MEIS_CompressionFormat Format);
+    static bool ReadCompressed(FArchive &Reader, FString &OutText);
+};
@@ -5,93 +5,1165 @@
  */
 
 #include "Storage/CPP_InputProfileStorage.h"
+#include "Storage/CPP_InputStorageBackend.h"
+#include "Manager/CPP_InputActionDefinitionRegistry.h"
+#include "P_MEIS_Memory.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Json.h"
 #include "JsonUtilities.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/SecureHash.h"
+
+namespace
+{
+    // ==================== Storage Mode / Chunk Cache ====================
+
+    const TCHAR *ManifestFormatTag = TEXT("P_MEIS.ProfileManifest");
+    const int32 ManifestFormatVersion = 1;
+
+    EInputProfileStorageMode GStorageMode = EInputProfileStorageMode::Json;
+    EP_MEIS_CompressionFormat GCompressionFormat = EP_MEIS_CompressionFormat::None;
+
+    /** Active backend; rooted while active so static access never sees a collected object */
+    UCPP_InputStorageBackend *GStorageBackend = nullptr;
+
+    /** Action definitions that saved bindings are written as deltas against (owned by the manager) */
+    TWeakObjectPtr<UCPP_InputActionDefinitionRegistry> GDefinitionRegistry;
+
+    const TCHAR *ChunkFolder = TEXT("Chunks");
+
+    /** Parsed chunks shared by every profile loaded in this process, keyed by content hash */
+    struct FProfileChunkCache
+    {
+        FCriticalSection Lock;
+        TMap<FString, FS_InputActionBinding> ActionChunks;
+        TMap<FString, FS_InputAxisBinding> AxisChunks;
+        TMap<FString, TArray<FS_InputModifier>> ModifierChunks;
+
+        /** Definition registry revision the cached bindings were expanded against */
+        uint32 DefinitionRevision = 0;
+    };
+
+    FProfileChunkCache &GetChunkCache()
+    {
+        static FProfileChunkCache Cache;
+        return Cache;
+    }
+
+    uint32 GetDefinitionRevision()
+    {
+        const UCPP_InputActionDefinitionRegistry *Registry = GDefinitionRegistry.Get();
+        return Registry ? Registry->GetRevision() : 0;
+    }
+
+    /** Drop cached chunks once definitions changed since they were parsed; call with the cache locked */
+    void SyncChunkCacheRevision(FProfileChunkCache &Cache, uint32 Revision)
+    {
+        if (Cache.DefinitionRevision != Revision)
+        {
+            Cache.ActionChunks.Empty();
+            Cache.AxisChunks.Empty();
+            Cache.ModifierChunks.Empty();
+            Cache.DefinitionRevision = Revision;
+        }
+    }
+
+    // ==================== JSON Blocks ====================
+
+    FString WriteJsonCondensed(const TSharedRef<FJsonObject> &JsonObject)
+    {
+        FString OutputString;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutputString);
+        FJsonSerializer::Serialize(JsonObject, Writer);
+        return OutputString;
+    }
+
+    TSharedPtr<FJsonObject> ParseJsonObject(const FString &JsonString)
+    {
+        TSharedPtr<FJsonObject> JsonObject;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+        if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+        {
+            return nullptr;
+        }
+        return JsonObject;
+    }
+
+    FString HashChunk(const FString &ChunkJson)
+    {
+        FTCHARToUTF8 Utf8(*ChunkJson);
+        FSHAHash Hash;
+        FSHA1::HashBuffer(Utf8.Get(), Utf8.Length(), Hash.Hash);
+        return Hash.ToString();
+    }
+
+    /**
+     * Binding display text: a string-table key when set (localizable, a few bytes), else the literal text
+     * Literal text is written via ToString() and so is saved in the current culture only.
+     */
+    void WriteDisplayText(const TSharedRef<FJsonObject> &JsonObject, const TCHAR *Field, const FText &Text, FName Key)
+    {
+        if (Key.IsNone())
+        {
+            JsonObject->SetStringField(Field, Text.ToString());
+        }
+        else
+        {
+            JsonObject->SetStringField(FString(Field) + TEXT("Key"), Key.ToString());
+        }
+    }
+
+    /** Fields missing from the JSON keep the value already on the binding (its definition, or empty) */
+    void ReadDisplayText(const TSharedPtr<FJsonObject> &JsonObject, const TCHAR *Field, FText &OutText, FName &OutKey)
+    {
+        FString Value;
+        if (JsonObject->TryGetStringField(Field, Value))
+        {
+            OutText = FText::FromString(Value);
+        }
+        if (JsonObject->TryGetStringField(FString(Field) + TEXT("Key"), Value))
+        {
+            OutKey = FName(*Value);
+        }
+    }
+
+    /** Action groups are written only when a binding has any (older profiles have none) */
+    void WriteActionGroups(const TSharedRef<FJsonObject> &JsonObject, const TArray<FName> &Groups)
+    {
+        if (Groups.Num() == 0)
+        {
+            return;
+        }
+
+        TArray<TSharedPtr<FJsonValue>> GroupsArray;
+        for (const FName &Group : Groups)
+        {
+            GroupsArray.Add(MakeShareable(new FJsonValueString(Group.ToString())));
+        }
+        JsonObject->SetArrayField(TEXT("ActionGroups"), GroupsArray);
+    }
+
+    void ReadActionGroups(const TSharedPtr<FJsonObject> &JsonObject, TArray<FName> &OutGroups)
+    {
+        const TArray<TSharedPtr<FJsonValue>> *GroupsArray = nullptr;
+        if (JsonObject->TryGetArrayField(TEXT("ActionGroups"), GroupsArray))
+        {
+            OutGroups.Reset(GroupsArray->Num());
+            for (const TSharedPtr<FJsonValue> &GroupValue : *GroupsArray)
+            {
+                OutGroups.Add(FName(*GroupValue->AsString()));
+            }
+        }
+    }
+
+    // ==================== Definition Deltas ====================
+    // A binding whose name has a registered definition only writes the metadata that differs
+    // from it; reads start from the definition and apply whatever fields are present.
+    // Self-contained writes (exports) skip the deltas so the file loads without the definitions.
+
+    const FS_InputActionDefinition *FindDefinitionFor(FName Name, bool bIsAxis)
+    {
+        const UCPP_InputActionDefinitionRegistry *Registry = GDefinitionRegistry.Get();
+        const FS_InputActionDefinition *Definition = Registry ? Registry->FindDefinition(Name) : nullptr;
+        return Definition && Definition->bIsAxis == bIsAxis ? Definition : nullptr;
+    }
+
+    /** Write display text unless it matches the definition; an override writes text and key so neither falls back */
+    void WriteDisplayTextDelta(const TSharedRef<FJsonObject> &JsonObject, const TCHAR *Field, const FText &Text, FName Key,
+                               const FText *DefaultText, FName DefaultKey)
+    {
+        if (!DefaultText)
+        {
+            WriteDisplayText(JsonObject, Field, Text, Key);
+            return;
+        }
+
+        if (Key == DefaultKey && (!Key.IsNone() || Text.ToString() == DefaultText->ToString()))
+        {
+            return;
+        }
+
+        JsonObject->SetStringField(Field, Text.ToString());
+        JsonObject->SetStringField(FString(Field) + TEXT("Key"), Key.IsNone() ? FString() : Key.ToString());
+    }
+
+    void WriteProfileHeader(const FS_InputProfile &Profile, const TSharedRef<FJsonObject> &JsonObject)
+    {
+        JsonObject->SetStringField(TEXT("ProfileName"), Profile.ProfileName.ToString());
+        JsonObject->SetStringField(TEXT("ProfileDescription"), Profile.ProfileDescription.ToString());
+        JsonObject->SetStringField(TEXT("CreatedBy"), Profile.CreatedBy);
+        JsonObject->SetNumberField(TEXT("Version"), Profile.Version);
+        JsonObject->SetBoolField(TEXT("bIsDefault"), Profile.bIsDefault);
+        JsonObject->SetBoolField(TEXT("bIsCompetitive"), Profile.bIsCompetitive);
+        if (!Profile.DisplayStringTable.IsNone())
+        {
+            JsonObject->SetStringField(TEXT("DisplayStringTable"), Profile.DisplayStringTable.ToString());
+        }
+
+        // Optional gameplay preferences (modular; action names provided by game/module)
+        {
+            TArray<TSharedPtr<FJsonValue>> ToggleModeActionsArray;
+            for (const FName &ActionName : Profile.ToggleModeActions)
+            {
+                ToggleModeActionsArray.Add(MakeShareable(new FJsonValueString(ActionName.ToString())));
+            }
+            JsonObject->SetArrayField(TEXT("ToggleModeActions"), ToggleModeActionsArray);
+
+            // Preferred explicit toggle-state map.
+            {
+                TSharedPtr<FJsonObject> ToggleStatesObj = MakeShareable(new FJsonObject());
+                for (const TPair<FName, bool> &Pair : Profile.ToggleActionStates)
+                {
+                    if (Pair.Key.IsNone())
+                    {
+                        continue;
+                    }
+                    ToggleStatesObj->SetBoolField(Pair.Key.ToString(), Pair.Value);
+                }
+                JsonObject->SetObjectField(TEXT("ToggleActionStates"), ToggleStatesObj);
+            }
+        }
+
+        // Stick calibration (only written once used)
+        if (Profile.bAutoCalibrateSticks || Profile.StickCalibrations.Num() > 0)
+        {
+            JsonObject->SetBoolField(TEXT("bAutoCalibrateSticks"), Profile.bAutoCalibrateSticks);
+
+            TArray<TSharedPtr<FJsonValue>> DevicesArray;
+            for (const FS_DeviceStickCalibration &Device : Profile.StickCalibrations)
+            {
+                TArray<TSharedPtr<FJsonValue>> SticksArray;
+                for (const FS_StickCalibration &Stick : Device.Sticks)
+                {
+                    TSharedPtr<FJsonObject> StickObj = MakeShareable(new FJsonObject());
+                    StickObj->SetStringField(TEXT("Stick"), Stick.Stick.ToString());
+                    StickObj->SetNumberField(TEXT("OffsetX"), Stick.CenterOffset.X);
+                    StickObj->SetNumberField(TEXT("OffsetY"), Stick.CenterOffset.Y);
+                    StickObj->SetNumberField(TEXT("NoiseRadius"), Stick.NoiseRadius);
+                    StickObj->SetNumberField(TEXT("DeadZone"), Stick.DeadZone);
+                    StickObj->SetNumberField(TEXT("SampleCount"), Stick.SampleCount);
+                    SticksArray.Add(MakeShareable(new FJsonValueObject(StickObj)));
+                }
+
+                TSharedPtr<FJsonObject> DeviceObj = MakeShareable(new FJsonObject());
+                DeviceObj->SetStringField(TEXT("HardwareId"), Device.HardwareId.ToString());
+                DeviceObj->SetArrayField(TEXT("Sticks"), SticksArray);
+                DevicesArray.Add(MakeShareable(new FJsonValueObject(DeviceObj)));
+            }
+            JsonObject->SetArrayField(TEXT("StickCalibrations"), DevicesArray);
+        }
+    }
+
+    void ReadProfileHeader(const TSharedPtr<FJsonObject> &JsonObject, FS_InputProfile &OutProfile)
+    {
+        OutProfile.ProfileName = FName(*JsonObject->GetStringField(TEXT("ProfileName")));
+        OutProfile.ProfileDescription = FText::FromString(JsonObject->GetStringField(TEXT("ProfileDescription")));
+        OutProfile.CreatedBy = JsonObject->GetStringField(TEXT("CreatedBy"));
+
+        int32 Version = 1;
+        if (JsonObject->TryGetNumberField(TEXT("Version"), Version))
+        {
+            OutProfile.Version = Version;
+        }
+        else
+        {
+            OutProfile.Version = 1;
+        }
+
+        bool bIsDefault = false;
+        if (JsonObject->TryGetBoolField(TEXT("bIsDefault"), bIsDefault))
+        {
+            OutProfile.bIsDefault = bIsDefault;
+        }
+
+        bool bIsCompetitive = false;
+        if (JsonObject->TryGetBoolField(TEXT("bIsCompetitive"), bIsCompetitive))
+        {
+            OutProfile.bIsCompetitive = bIsCompetitive;
+        }
+
+        FString DisplayStringTable;
+        OutProfile.DisplayStringTable = JsonObject->TryGetStringField(TEXT("DisplayStringTable"), DisplayStringTable) ? FName(*DisplayStringTable) : NAME_None;
+
+        // Optional gameplay preferences (safe defaults if missing)
+        OutProfile.ToggleModeActions.Empty();
+        const TArray<TSharedPtr<FJsonValue>> *ToggleModeActionsArray = nullptr;
+        if (JsonObject->TryGetArrayField(TEXT("ToggleModeActions"), ToggleModeActionsArray))
+        {
+            for (const TSharedPtr<FJsonValue> &ActionValue : *ToggleModeActionsArray)
+            {
+                FString ActionNameStr;
+                if (ActionValue->TryGetString(ActionNameStr))
+                {
+                    OutProfile.ToggleModeActions.Add(FName(*ActionNameStr));
+                }
+            }
+        }
+
+        // Preferred explicit toggle state map.
+        OutProfile.ToggleActionStates.Empty();
+        const TSharedPtr<FJsonObject> *ToggleStatesObjPtr = nullptr;
+        if (JsonObject->TryGetObjectField(TEXT("ToggleActionStates"), ToggleStatesObjPtr) && ToggleStatesObjPtr && ToggleStatesObjPtr->IsValid())
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>> &Pair : (*ToggleStatesObjPtr)->Values)
+            {
+                bool bValue = false;
+                if (Pair.Value.IsValid() && Pair.Value->TryGetBool(bValue))
+                {
+                    OutProfile.ToggleActionStates.Add(FName(*Pair.Key), bValue);
+                }
+            }
+        }
+        // If missing, default stays empty (all toggles OFF).
+
+        OutProfile.bAutoCalibrateSticks = false;
+        JsonObject->TryGetBoolField(TEXT("bAutoCalibrateSticks"), OutProfile.bAutoCalibrateSticks);
+
+        OutProfile.StickCalibrations.Empty();
+        const TArray<TSharedPtr<FJsonValue>> *DevicesArray = nullptr;
+        if (JsonObject->TryGetArrayField(TEXT("StickCalibrations"), DevicesArray))
+        {
+            for (const TSharedPtr<FJsonValue> &DeviceValue : *DevicesArray)
+            {
+                // Older saves keyed entries by runtime "DeviceId", which names no particular pad across
+                // sessions; they are dropped and re-estimated
+                const TSharedPtr<FJsonObject> DeviceObj = DeviceValue->AsObject();
+                FString HardwareId;
+                if (!DeviceObj.IsValid() || !DeviceObj->TryGetStringField(TEXT("HardwareId"), HardwareId) || HardwareId.IsEmpty())
+                {
+                    continue;
+                }
+
+                FS_DeviceStickCalibration &Device = OutProfile.StickCalibrations.AddDefaulted_GetRef();
+                Device.HardwareId = FName(*HardwareId);
+
+                const TArray<TSharedPtr<FJsonValue>> *SticksArray = nullptr;
+                if (!DeviceObj->TryGetArrayField(TEXT("Sticks"), SticksArray))
+                {
+                    continue;
+                }
+                for (const TSharedPtr<FJsonValue> &StickValue : *SticksArray)
+                {
+                    const TSharedPtr<FJsonObject> StickObj = StickValue->AsObject();
+                    if (!StickObj.IsValid())
+                    {
+                        continue;
+                    }
+
+                    FS_StickCalibration &Stick = Device.Sticks.AddDefaulted_GetRef();
+                    Stick.Stick = FName(*StickObj->GetStringField(TEXT("Stick")));
+                    double Number = 0.0;
+                    Stick.CenterOffset.X = StickObj->TryGetNumberField(TEXT("OffsetX"), Number) ? Number : 0.0;
+                    Stick.CenterOffset.Y = StickObj->TryGetNumberField(TEXT("OffsetY"), Number) ? Number : 0.0;
+                    Stick.NoiseRadius = StickObj->TryGetNumberField(TEXT("NoiseRadius"), Number) ? static_cast<float>(Number) : 0.0f;
+                    Stick.DeadZone = StickObj->TryGetNumberField(TEXT("DeadZone"), Number) ? static_cast<float>(Number) : 0.0f;
+                    StickObj->TryGetNumberField(TEXT("SampleCount"), Stick.SampleCount);
+                }
+            }
+        }
+    }
+
+    TSharedRef<FJsonObject> ActionBindingToJson(const FS_InputActionBinding &ActionBinding, bool bSelfContained = false)
+    {
+        TSharedRef<FJsonObject> ActionObj = MakeShareable(new FJsonObject());
+        ActionObj->SetStringField(TEXT("InputActionName"), ActionBinding.InputActionName.ToString());
+
+        const FS_InputActionDefinition *Definition = bSelfContained ? nullptr : FindDefinitionFor(ActionBinding.InputActionName, false);
+        WriteDisplayTextDelta(ActionObj, TEXT("DisplayName"), ActionBinding.DisplayName, ActionBinding.DisplayNameKey,
+                              Definition ? &Definition->DisplayName : nullptr, Definition ? Definition->DisplayNameKey : NAME_None);
+        if (!Definition || ActionBinding.Category != Definition->Category)
+        {
+            ActionObj->SetStringField(TEXT("Category"), ActionBinding.Category.ToString());
+        }
+        WriteActionGroups(ActionObj, ActionBinding.ActionGroups);
+        WriteDisplayTextDelta(ActionObj, TEXT("Description"), ActionBinding.Description, ActionBinding.DescriptionKey,
+                              Definition ? &Definition->Description : nullptr, Definition ? Definition->DescriptionKey : NAME_None);
+        if (!Definition || ActionBinding.Priority != Definition->Priority)
+        {
+            ActionObj->SetNumberField(TEXT("Priority"), ActionBinding.Priority);
+        }
+        if (!Definition || ActionBinding.bEnabled != Definition->bEnabled)
+        {
+            ActionObj->SetBoolField(TEXT("bEnabled"), ActionBinding.bEnabled);
+        }
+
+        // Key bindings
+        TArray<TSharedPtr<FJsonValue>> KeyBindingsArray;
+        for (const FS_KeyBinding &KeyBinding : ActionBinding.KeyBindings)
+        {
+            TSharedPtr<FJsonObject> KeyObj = MakeShareable(new FJsonObject());
+            KeyObj->SetStringField(TEXT("Key"), KeyBinding.Key.GetFName().ToString());
+            KeyObj->SetNumberField(TEXT("Value"), KeyBinding.Value);
+            KeyObj->SetBoolField(TEXT("bShift"), KeyBinding.bShift);
+            KeyObj->SetBoolField(TEXT("bCtrl"), KeyBinding.bCtrl);
+            KeyObj->SetBoolField(TEXT("bAlt"), KeyBinding.bAlt);
+            KeyObj->SetBoolField(TEXT("bCmd"), KeyBinding.bCmd);
+            KeyBindingsArray.Add(MakeShareable(new FJsonValueObject(KeyObj)));
+        }
+        ActionObj->SetArrayField(TEXT("KeyBindings"), KeyBindingsArray);
+
+        return ActionObj;
+    }
+
+    void ActionBindingFromJson(const TSharedPtr<FJsonObject> &ActionObj, FS_InputActionBinding &ActionBinding)
+    {
+        ActionBinding = FS_InputActionBinding();
+        ActionBinding.InputActionName = FName(*ActionObj->GetStringField(TEXT("InputActionName")));
+        if (const FS_InputActionDefinition *Definition = FindDefinitionFor(ActionBinding.InputActionName, false))
+        {
+            Definition->ApplyTo(ActionBinding);
+        }
+
+        ReadDisplayText(ActionObj, TEXT("DisplayName"), ActionBinding.DisplayName, ActionBinding.DisplayNameKey);
+        ReadDisplayText(ActionObj, TEXT("Description"), ActionBinding.Description, ActionBinding.DescriptionKey);
+
+        FString CategoryStr;
+        if (ActionObj->TryGetStringField(TEXT("Category"), CategoryStr))
+        {
+            ActionBinding.Category = FName(*CategoryStr);
+        }
+        ReadActionGroups(ActionObj, ActionBinding.ActionGroups);
+
+        double PriorityNum = ActionBinding.Priority;
+        if (ActionObj->TryGetNumberField(TEXT("Priority"), PriorityNum))
+        {
+            ActionBinding.Priority = static_cast<float>(PriorityNum);
+        }
+        ActionObj->TryGetBoolField(TEXT("bEnabled"), ActionBinding.bEnabled);
+
+        // Key bindings (optional for older profiles)
+        ActionBinding.KeyBindings.Empty();
+        const TArray<TSharedPtr<FJsonValue>> *KeyBindingsArray = nullptr;
+        if (ActionObj->TryGetArrayField(TEXT("KeyBindings"), KeyBindingsArray))
+        {
+            for (const TSharedPtr<FJsonValue> &KeyValue : *KeyBindingsArray)
+            {
+                const TSharedPtr<FJsonObject> KeyObj = KeyValue->AsObject();
+                if (!KeyObj.IsValid())
+                {
+                    continue;
+                }
+
+                FS_KeyBinding KeyBinding;
+                KeyBinding.Key = FKey(*KeyObj->GetStringField(TEXT("Key")));
+
+                double ValueNum = 1.0;
+                if (KeyObj->TryGetNumberField(TEXT("Value"), ValueNum))
+                {
+                    KeyBinding.Value = static_cast<float>(ValueNum);
+                }
+
+                KeyObj->TryGetBoolField(TEXT("bShift"), KeyBinding.bShift);
+                KeyObj->TryGetBoolField(TEXT("bCtrl"), KeyBinding.bCtrl);
+                KeyObj->TryGetBoolField(TEXT("bAlt"), KeyBinding.bAlt);
+                KeyObj->TryGetBoolField(TEXT("bCmd"), KeyBinding.bCmd);
+
+                ActionBinding.KeyBindings.Add(KeyBinding);
+            }
+        }
+    }
+
+    TSharedRef<FJsonObject> AxisBindingToJson(const FS_InputAxisBinding &AxisBinding, bool bSelfContained = false)
+    {
+        TSharedRef<FJsonObject> AxisObj = MakeShareable(new FJsonObject());
+        AxisObj->SetStringField(TEXT("InputAxisName"), AxisBinding.InputAxisName.ToString());
+
+        const FS_InputActionDefinition *Definition = bSelfContained ? nullptr : FindDefinitionFor(AxisBinding.InputAxisName, true);
+        WriteDisplayTextDelta(AxisObj, TEXT("DisplayName"), AxisBinding.DisplayName, AxisBinding.DisplayNameKey,
+                              Definition ? &Definition->DisplayName : nullptr, Definition ? Definition->DisplayNameKey : NAME_None);
+        if (!Definition || AxisBinding.Category != Definition->Category)
+        {
+            AxisObj->SetStringField(TEXT("Category"), AxisBinding.Category.ToString());
+        }
+        WriteActionGroups(AxisObj, AxisBinding.ActionGroups);
+        WriteDisplayTextDelta(AxisObj, TEXT("Description"), AxisBinding.Description, AxisBinding.DescriptionKey,
+                              Definition ? &Definition->Description : nullptr, Definition ? Definition->DescriptionKey : NAME_None);
+        if (!Definition || AxisBinding.ValueType != Definition->ValueType)
+        {
+            AxisObj->SetNumberField(TEXT("ValueType"), static_cast<int32>(AxisBinding.ValueType));
+        }
+
+        // Tuning overrides
+        if (!Definition || AxisBinding.DeadZone != Definition->DeadZone)
+        {
+            AxisObj->SetNumberField(TEXT("DeadZone"), AxisBinding.DeadZone);
+        }
+        if (!Definition || AxisBinding.Sensitivity != Definition->Sensitivity)
+        {
+            AxisObj->SetNumberField(TEXT("Sensitivity"), AxisBinding.Sensitivity);
+        }
+        if (!Definition || AxisBinding.Priority != Definition->Priority)
+        {
+            AxisObj->SetNumberField(TEXT("Priority"), AxisBinding.Priority);
+        }
+        if (!Definition || AxisBinding.bInvert != Definition->bInvert)
+        {
+            AxisObj->SetBoolField(TEXT("bInvert"), AxisBinding.bInvert);
+        }
+        if (!Definition || AxisBinding.bEnabled != Definition->bEnabled)
+        {
+            AxisObj->SetBoolField(TEXT("bEnabled"), AxisBinding.bEnabled);
+        }
+
+        // Axis key bindings
+        TArray<TSharedPtr<FJsonValue>> AxisKeysArray;
+        for (const FS_AxisKeyBinding &AxisKey : AxisBinding.AxisBindings)
+        {
+            TSharedPtr<FJsonObject> AxisKeyObj = MakeShareable(new FJsonObject());
+            AxisKeyObj->SetStringField(TEXT("Key"), AxisKey.Key.GetFName().ToString());
+            AxisKeyObj->SetNumberField(TEXT("Scale"), AxisKey.Scale);
+            AxisKeyObj->SetBoolField(TEXT("bSwizzleYXZ"), AxisKey.bSwizzleYXZ);
+            AxisKeysArray.Add(MakeShareable(new FJsonValueObject(AxisKeyObj)));
+        }
+        AxisObj->SetArrayField(TEXT("AxisBindings"), AxisKeysArray);
+
+        return AxisObj;
+    }
+
+    void AxisBindingFromJson(const TSharedPtr<FJsonObject> &AxisObj, FS_InputAxisBinding &AxisBinding)
+    {
+        AxisBinding = FS_InputAxisBinding();
+        AxisBinding.InputAxisName = FName(*AxisObj->GetStringField(TEXT("InputAxisName")));
+        if (const FS_InputActionDefinition *Definition = FindDefinitionFor(AxisBinding.InputAxisName, true))
+        {
+            Definition->ApplyTo(AxisBinding);
+        }
+
+        FString CategoryStr;
+        if (AxisObj->TryGetStringField(TEXT("Category"), CategoryStr))
+        {
+            AxisBinding.Category = FName(*CategoryStr);
+        }
+        ReadActionGroups(AxisObj, AxisBinding.ActionGroups);
+
+        ReadDisplayText(AxisObj, TEXT("DisplayName"), AxisBinding.DisplayName, AxisBinding.DisplayNameKey);
+        ReadDisplayText(AxisObj, TEXT("Description"), AxisBinding.Description, AxisBinding.DescriptionKey);
+
+        int32 ValueTypeInt = static_cast<int32>(AxisBinding.ValueType);
+        if (AxisObj->TryGetNumberField(TEXT("ValueType"), ValueTypeInt))
+        {
+            AxisBinding.ValueType = static_cast<EInputActionValueType>(ValueTypeInt);
+        }
+
+        double TuningNum = 0.0;
+        if (AxisObj->TryGetNumberField(TEXT("DeadZone"), TuningNum))
+        {
+            AxisBinding.DeadZone = static_cast<float>(TuningNum);
+        }
+        if (AxisObj->TryGetNumberField(TEXT("Sensitivity"), TuningNum))
+        {
+            AxisBinding.Sensitivity = static_cast<float>(TuningNum);
+        }
+
+        double PriorityNum = AxisBinding.Priority;
+        if (AxisObj->TryGetNumberField(TEXT("Priority"), PriorityNum))
+        {
+            AxisBinding.Priority = static_cast<float>(PriorityNum);
+        }
+
+        AxisObj->TryGetBoolField(TEXT("bInvert"), AxisBinding.bInvert);
+        AxisObj->TryGetBoolField(TEXT("bEnabled"), AxisBinding.bEnabled);
+
+        // Axis key bindings (optional for older profiles)
+        AxisBinding.AxisBindings.Empty();
+        const TArray<TSharedPtr<FJsonValue>> *AxisKeysArray = nullptr;
+        if (AxisObj->TryGetArrayField(TEXT("AxisBindings"), AxisKeysArray))
+        {
+            for (const TSharedPtr<FJsonValue> &AxisKeyValue : *AxisKeysArray)
+            {
+                const TSharedPtr<FJsonObject> AxisKeyObj = AxisKeyValue->AsObject();
+                if (!AxisKeyObj.IsValid())
+                {
+                    continue;
+                }
+
+                FS_AxisKeyBinding AxisKey;
+                AxisKey.Key = FKey(*AxisKeyObj->GetStringField(TEXT("Key")));
+
+                double ScaleNum = 1.0;
+                if (AxisKeyObj->TryGetNumberField(TEXT("Scale"), ScaleNum))
+                {
+                    AxisKey.Scale = static_cast<float>(ScaleNum);
+                }
+                AxisKeyObj->TryGetBoolField(TEXT("bSwizzleYXZ"), AxisKey.bSwizzleYXZ);
+
+                AxisBinding.AxisBindings.Add(AxisKey);
+            }
+        }
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ModifiersToJson(const TArray<FS_InputModifier> &Modifiers)
+    {
+        TArray<TSharedPtr<FJsonValue>> ModifiersArray;
+        for (const FS_InputModifier &Modifier : Modifiers)
+        {
+            TSharedPtr<FJsonObject> ModObj = MakeShareable(new FJsonObject());
+            ModObj->SetNumberField(TEXT("ModifierType"), static_cast<int32>(Modifier.ModifierType));
+            ModObj->SetNumberField(TEXT("DeadZoneValue"), Modifier.DeadZoneValue);
+            ModObj->SetNumberField(TEXT("ScaleValue"), Modifier.ScaleValue);
+            ModObj->SetBoolField(TEXT("bEnabled"), Modifier.bEnabled);
+
+            ModifiersArray.Add(MakeShareable(new FJsonValueObject(ModObj)));
+        }
+        return ModifiersArray;
+    }
+
+    void ModifiersFromJson(const TArray<TSharedPtr<FJsonValue>> &ModifiersArray, TArray<FS_InputModifier> &OutModifiers)
+    {
+        OutModifiers.Empty();
+        for (const TSharedPtr<FJsonValue> &Value : ModifiersArray)
+        {
+            TSharedPtr<FJsonObject> ModObj = Value->AsObject();
+            if (ModObj.IsValid())
+            {
+                FS_InputModifier Modifier;
+                Modifier.ModifierType = static_cast<EInputModifierType>(ModObj->GetIntegerField(TEXT("ModifierType")));
+                Modifier.DeadZoneValue = ModObj->GetNumberField(TEXT("DeadZoneValue"));
+                Modifier.ScaleValue = ModObj->GetNumberField(TEXT("ScaleValue"));
+                Modifier.bEnabled = ModObj->GetBoolField(TEXT("bEnabled"));
+
+                OutModifiers.Add(Modifier);
+            }
+        }
+    }
+
+    // ==================== Chunk Store ====================
+
+    FString GetChunkKey(const FString &Hash)
+    {
+        return FString(ChunkFolder) / Hash;
+    }
+
+    bool ReadEntryText(const FString &Key, FString &OutText)
+    {
+        TArray<uint8> Bytes;
+        return UCPP_InputProfileStorage::GetStorageBackend()->ReadEntry(Key, Bytes) && UCPP_InputCompressedFile::DecodeString(Bytes, OutText);
+    }
+
+    /**
+     * Write a chunk once; identical blocks from other profiles resolve to the same entry.
+     * Chunks stay plain text: a single binding is too small for compression to pay off.
+     */
+    bool StoreChunk(const FString &ChunkJson, FString &OutHash)
+    {
+        OutHash = HashChunk(ChunkJson);
+
+        UCPP_InputStorageBackend *Backend = UCPP_InputProfileStorage::GetStorageBackend();
+        const FString ChunkKey = GetChunkKey(OutHash);
+        if (Backend->EntryExists(ChunkKey))
+        {
+            return true;
+        }
+
+        TArray<uint8> Bytes;
+        UCPP_InputCompressedFile::EncodeString(ChunkJson, EP_MEIS_CompressionFormat::None, Bytes);
+        if (!Backend->WriteEntry(ChunkKey, Bytes))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to write profile chunk %s"), *Backend->DescribeEntry(ChunkKey));
+            return false;
+        }
+        return true;
+    }
+
+    TSharedPtr<FJsonObject> LoadChunkObject(const FString &Hash)
+    {
+        FString ChunkJson;
+        if (!ReadEntryText(GetChunkKey(Hash), ChunkJson))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Missing profile chunk %s"), *Hash);
+            return nullptr;
+        }
+
+        TSharedPtr<FJsonObject> ChunkObj = ParseJsonObject(ChunkJson);
+        if (!ChunkObj.IsValid())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to parse profile chunk %s"), *Hash);
+        }
+        return ChunkObj;
+    }
+
+    bool ResolveActionChunk(const FString &Hash, FS_InputActionBinding &OutBinding)
+    {
+        FProfileChunkCache &Cache = GetChunkCache();
+        const uint32 Revision = GetDefinitionRevision();
+        {
+            FScopeLock ScopeLock(&Cache.Lock);
+            SyncChunkCacheRevision(Cache, Revision);
+            if (const FS_InputActionBinding *Cached = Cache.ActionChunks.Find(Hash))
+            {
+                OutBinding = *Cached;
+                return true;
+            }
+        }
+
+        TSharedPtr<FJsonObject> ChunkObj = LoadChunkObject(Hash);
+        if (!ChunkObj.IsValid())
+        {
+            return false;
+        }
+
+        ActionBindingFromJson(ChunkObj, OutBinding);
+
+        FScopeLock ScopeLock(&Cache.Lock);
+        if (Cache.DefinitionRevision == Revision)
+        {
+            Cache.ActionChunks.Add(Hash, OutBinding);
+        }
+        return true;
+    }
+
+    bool ResolveAxisChunk(const FString &Hash, FS_InputAxisBinding &OutBinding)
+    {
+        FProfileChunkCache &Cache = GetChunkCache();
+        const uint32 Revision = GetDefinitionRevision();
+        {
+            FScopeLock ScopeLock(&Cache.Lock);
+            SyncChunkCacheRevision(Cache, Revision);
+            if (const FS_InputAxisBinding *Cached = Cache.AxisChunks.Find(Hash))
+            {
+                OutBinding = *Cached;
+                return true;
+            }
+        }
+
+        TSharedPtr<FJsonObject> ChunkObj = LoadChunkObject(Hash);
+        if (!ChunkObj.IsValid())
+        {
+            return false;
+        }
+
+        AxisBindingFromJson(ChunkObj, OutBinding);
+
+        FScopeLock ScopeLock(&Cache.Lock);
+        if (Cache.DefinitionRevision == Revision)
+        {
+            Cache.AxisChunks.Add(Hash, OutBinding);
+        }
+        return true;
+    }
+
+    bool ResolveModifierChunk(const FString &Hash, TArray<FS_InputModifier> &OutModifiers)
+    {
+        FProfileChunkCache &Cache = GetChunkCache();
+        {
+            FScopeLock ScopeLock(&Cache.Lock);
+            if (const TArray<FS_InputModifier> *Cached = Cache.ModifierChunks.Find(Hash))
+            {
+                OutModifiers = *Cached;
+                return true;
+            }
+        }
+
+        TSharedPtr<FJsonObject> ChunkObj = LoadChunkObject(Hash);
+        if (!ChunkObj.IsValid())
+        {
+            return false;
+        }
+
+        const TArray<TSharedPtr<FJsonValue>> *ModifiersArray = nullptr;
+        if (ChunkObj->TryGetArrayField(TEXT("Modifiers"), ModifiersArray))
+        {
+            ModifiersFromJson(*ModifiersArray, OutModifiers);
+        }
+        else
+        {
+            OutModifiers.Empty();
+        }
+
+        FScopeLock ScopeLock(&Cache.Lock);
+        Cache.ModifierChunks.Add(Hash, OutModifiers);
+        return true;
+    }
+
+    bool IsManifest(const TSharedPtr<FJsonObject> &JsonObject)
+    {
+        FString Format;
+        return JsonObject->TryGetStringField(TEXT("Format"), Format) && Format == ManifestFormatTag;
+    }
+
+    /** Split the profile into chunks and return the manifest that references them */
+    bool SerializeProfileToManifest(const FS_InputProfile &Profile, FString &OutManifest)
+    {
+        TSharedRef<FJsonObject> ManifestObj = MakeShareable(new FJsonObject());
+        ManifestObj->SetStringField(TEXT("Format"), ManifestFormatTag);
+        ManifestObj->SetNumberField(TEXT("ManifestVersion"), ManifestFormatVersion);
+        WriteProfileHeader(Profile, ManifestObj);
+
+        TArray<TSharedPtr<FJsonValue>> ActionChunksArray;
+        for (const FS_InputActionBinding &ActionBinding : Profile.ActionBindings)
+        {
+            FString Hash;
+            if (!StoreChunk(WriteJsonCondensed(ActionBindingToJson(ActionBinding)), Hash))
+            {
+                return false;
+            }
+            ActionChunksArray.Add(MakeShareable(new FJsonValueString(Hash)));
+        }
+        ManifestObj->SetArrayField(TEXT("ActionChunks"), ActionChunksArray);
+
+        TArray<TSharedPtr<FJsonValue>> AxisChunksArray;
+        for (const FS_InputAxisBinding &AxisBinding : Profile.AxisBindings)
+        {
+            FString Hash;
+            if (!StoreChunk(WriteJsonCondensed(AxisBindingToJson(AxisBinding)), Hash))
+            {
+                return false;
+            }
+            AxisChunksArray.Add(MakeShareable(new FJsonValueString(Hash)));
+        }
+        ManifestObj->SetArrayField(TEXT("AxisChunks"), AxisChunksArray);
+
+        // The whole modifier set is one chunk; most profiles share it verbatim
+        {
+            TSharedRef<FJsonObject> ModifierSetObj = MakeShareable(new FJsonObject());
+            ModifierSetObj->SetArrayField(TEXT("Modifiers"), ModifiersToJson(Profile.Modifiers));
+
+            FString Hash;
+            if (!StoreChunk(WriteJsonCondensed(ModifierSetObj), Hash))
+            {
+                return false;
+            }
+            ManifestObj->SetStringField(TEXT("ModifierChunk"), Hash);
+        }
+
+        OutManifest = WriteJsonCondensed(ManifestObj);
+        return true;
+    }
+
+    bool DeserializeProfileFromManifest(const TSharedPtr<FJsonObject> &ManifestObj, FS_InputProfile &OutProfile)
+    {
+        ReadProfileHeader(ManifestObj, OutProfile);
+
+        OutProfile.ActionBindings.Empty();
+        const TArray<TSharedPtr<FJsonValue>> *ActionChunksArray = nullptr;
+        if (ManifestObj->TryGetArrayField(TEXT("ActionChunks"), ActionChunksArray))
+        {
+            OutProfile.ActionBindings.Reserve(ActionChunksArray->Num());
+            for (const TSharedPtr<FJsonValue> &Value : *ActionChunksArray)
+            {
+                FS_InputActionBinding ActionBinding;
+                if (!ResolveActionChunk(Value->AsString(), ActionBinding))
+                {
+                    return false;
+                }
+                OutProfile.ActionBindings.Add(MoveTemp(ActionBinding));
+            }
+        }
+
+        OutProfile.AxisBindings.Empty();
+        const TArray<TSharedPtr<FJsonValue>> *AxisChunksArray = nullptr;
+        if (ManifestObj->TryGetArrayField(TEXT("AxisChunks"), AxisChunksArray))
+        {
+            OutProfile.AxisBindings.Reserve(AxisChunksArray->Num());
+            for (const TSharedPtr<FJsonValue> &Value : *AxisChunksArray)
+            {
+                FS_InputAxisBinding AxisBinding;
+                if (!ResolveAxisChunk(Value->AsString(), AxisBinding))
+                {
+                    return false;
+                }
+                OutProfile.AxisBindings.Add(MoveTemp(AxisBinding));
+            }
+        }
+
+        OutProfile.Modifiers.Empty();
+        FString ModifierHash;
+        if (ManifestObj->TryGetStringField(TEXT("ModifierChunk"), ModifierHash) && !ResolveModifierChunk(ModifierHash, OutProfile.Modifiers))
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    void CollectManifestChunks(const TSharedPtr<FJsonObject> &ManifestObj, TSet<FString> &OutHashes)
+    {
+        for (const TCHAR *FieldName : {TEXT("ActionChunks"), TEXT("AxisChunks")})
+        {
+            const TArray<TSharedPtr<FJsonValue>> *ChunksArray = nullptr;
+            if (ManifestObj->TryGetArrayField(FieldName, ChunksArray))
+            {
+                for (const TSharedPtr<FJsonValue> &Value : *ChunksArray)
+                {
+                    OutHashes.Add(Value->AsString());
+                }
+            }
+        }
+
+        FString ModifierHash;
+        if (ManifestObj->TryGetStringField(TEXT("ModifierChunk"), ModifierHash))
+        {
+            OutHashes.Add(ModifierHash);
+        }
+    }
+}
 
 bool UCPP_InputProfileStorage::SaveProfile(const FS_InputProfile &Profile)
 {
-    FString JsonString = SerializeProfileToJson(Profile);
-    FString FilePath = GetProfileFilePath(Profile.ProfileName);
+    LLM_SCOPE_BYTAG(PMEIS_Profiles);
+    TArray<uint8> Bytes;
+    if (!EncodeProfile(Profile, Bytes))
+    {
+        return false;
+    }
 
-    if (FFileHelper::SaveStringToFile(JsonString, *FilePath))
+    UCPP_InputStorageBackend *Backend = GetStorageBackend();
+    const FString Key = Profile.ProfileName.ToString();
+
+    if (Backend->WriteEntry(Key, Bytes))
     {
-        UE_LOG(LogTemp, Log, TEXT("P_MEIS: Profile saved to %s"), *FilePath);
+        UE_LOG(LogTemp, Log, TEXT("P_MEIS: Profile saved to %s"), *Backend->DescribeEntry(Key));
         return true;
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to save profile to %s"), *FilePath);
+    UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to save profile to %s"), *Backend->DescribeEntry(Key));
     return false;
 }
 
 bool UCPP_InputProfileStorage::LoadProfile(const FName &ProfileName, FS_InputProfile &OutProfile)
 {
-    FString FilePath = GetProfileFilePath(ProfileName);
+    LLM_SCOPE_BYTAG(PMEIS_Profiles);
+    UCPP_InputStorageBackend *Backend = GetStorageBackend();
+    const FString Key = ProfileName.ToString();
 
-    if (!FPaths::FileExists(*FilePath))
+    if (!Backend->EntryExists(Key))
     {
         if (IsRunningCommandlet())
         {
-            UE_LOG(LogTemp, Log, TEXT("P_MEIS: Profile file not found: %s"), *FilePath);
+            UE_LOG(LogTemp, Log, TEXT("P_MEIS: Profile file not found: %s"), *Backend->DescribeEntry(Key));
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Profile file not found: %s"), *FilePath);
+            UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Profile file not found: %s"), *Backend->DescribeEntry(Key));
         }
         return false;
     }
 
-    FString JsonString;
-    if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+    TArray<uint8> Bytes;
+    if (!Backend->ReadEntry(Key, Bytes))
     {
-        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to load profile file: %s"), *FilePath);
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to load profile file: %s"), *Backend->DescribeEntry(Key));
         return false;
     }
 
-    return DeserializeProfileFromJson(JsonString, OutProfile);
+    return DecodeProfile(Bytes, OutProfile);
 }
 
 bool UCPP_InputProfileStorage::DeleteProfile(const FName &ProfileName)
 {
-    FString FilePath = GetProfileFilePath(ProfileName);
+    UCPP_InputStorageBackend *Backend = GetStorageBackend();
+    const FString Key = ProfileName.ToString();
 
-    if (IFileManager::Get().Delete(*FilePath))
+    if (Backend->DeleteEntry(Key))
     {
-        UE_LOG(LogTemp, Log, TEXT("P_MEIS: Profile deleted: %s"), *FilePath);
+        UE_LOG(LogTemp, Log, TEXT("P_MEIS: Profile deleted: %s"), *Backend->DescribeEntry(Key));
         return true;
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to delete profile: %s"), *FilePath);
+    UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to delete profile: %s"), *Backend->DescribeEntry(Key));
     return false;
 }
 
 bool UCPP_InputProfileStorage::ProfileExists(const FName &ProfileName)
 {
-    return FPaths::FileExists(*GetProfileFilePath(ProfileName));
+    return GetStorageBackend()->EntryExists(ProfileName.ToString());
 }
 
 void UCPP_InputProfileStorage::GetAvailableProfiles(TArray<FName> &OutProfiles)
 {
-    FString ProfileDir = GetProfileDirectory();
-    IFileManager &FileMgr = IFileManager::Get();
+    // Root entries only; chunk entries live in their own folder
+    TArray<FString> EntryNames;
+    GetStorageBackend()->ListEntries(FString(), EntryNames);
+
+    for (const FString &EntryName : EntryNames)
+    {
+        OutProfiles.Add(FName(*EntryName));
+    }
+}
+
+void UCPP_InputProfileStorage::SaveProfileAsync(const FS_InputProfile &Profile, TFunction<void(bool bSuccess)> OnComplete)
+{
+    TArray<uint8> Bytes;
+    if (!EncodeProfile(Profile, Bytes))
+    {
+        OnComplete(false);
+        return;
+    }
+
+    GetStorageBackend()->WriteEntryAsync(Profile.ProfileName.ToString(), MoveTemp(Bytes), MoveTemp(OnComplete));
+}
+
+void UCPP_InputProfileStorage::LoadProfileAsync(const FName &ProfileName, TFunction<void(bool bSuccess, const FS_InputProfile &Profile)> OnComplete)
+{
+    GetStorageBackend()->ReadEntryAsync(ProfileName.ToString(),
+                                        [OnComplete = MoveTemp(OnComplete)](bool bSuccess, TArray<uint8> &&Bytes)
+                                        {
+                                            FS_InputProfile Profile;
+                                            OnComplete(bSuccess && DecodeProfile(Bytes, Profile), Profile);
+                                        });
+}
+
+void UCPP_InputProfileStorage::SetStorageBackend(UCPP_InputStorageBackend *NewBackend)
+{
+    if (NewBackend == GStorageBackend)
+    {
+        return;
+    }
+
+    if (GStorageBackend)
+    {
+        GStorageBackend->Flush();
+        GStorageBackend->RemoveFromRoot();
+    }
+
+    GStorageBackend = NewBackend;
+    if (GStorageBackend)
+    {
+        GStorageBackend->AddToRoot();
+    }
+
+    // Cached chunks belong to the previous store
+    ClearChunkCache();
+}
+
+void UCPP_InputProfileStorage::SetActionDefinitionRegistry(UCPP_InputActionDefinitionRegistry *Registry)
+{
+    GDefinitionRegistry = Registry;
+
+    // Cached chunks were decoded against the previous definitions
+    ClearChunkCache();
+}
+
+UCPP_InputActionDefinitionRegistry *UCPP_InputProfileStorage::GetActionDefinitionRegistry()
+{
+    return GDefinitionRegistry.Get();
+}
+
+UCPP_InputStorageBackend *UCPP_InputProfileStorage::GetStorageBackend()
+{
+    if (!GStorageBackend)
+    {
+        SetStorageBackend(NewObject<UCPP_InputStorageBackend_File>());
+    }
+    return GStorageBackend;
+}
+
+bool UCPP_InputProfileStorage::EncodeProfile(const FS_InputProfile &Profile, TArray<uint8> &OutBytes)
+{
+    LLM_SCOPE_BYTAG(PMEIS_Profiles);
+    FString JsonString;
+    if (GStorageMode == EInputProfileStorageMode::Deduplicated)
+    {
+        if (!SerializeProfileToManifest(Profile, JsonString))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to write chunks for profile %s"), *Profile.ProfileName.ToString());
+            return false;
+        }
+    }
+    else
+    {
+        JsonString = SerializeProfileToJson(Profile);
+    }
+
+    UCPP_InputCompressedFile::EncodeString(JsonString, GCompressionFormat, OutBytes);
+    return true;
+}
+
+bool UCPP_InputProfileStorage::DecodeProfile(const TArray<uint8> &Bytes, FS_InputProfile &OutProfile)
+{
+    LLM_SCOPE_BYTAG(PMEIS_Profiles);
+    FString JsonString;
+    if (!UCPP_InputCompressedFile::DecodeString(Bytes, JsonString))
+    {
+        return false;
+    }
+    return DeserializeProfileFromJson(JsonString, OutProfile);
+}
+
+void UCPP_InputProfileStorage::SetStorageMode(EInputProfileStorageMode NewMode)
+{
+    GStorageMode = NewMode;
+}
+
+EInputProfileStorageMode UCPP_InputProfileStorage::GetStorageMode()
+{
+    return GStorageMode;
+}
+
+void UCPP_InputProfileStorage::SetCompressionFormat(EP_MEIS_CompressionFormat NewFormat)
+{
+    GCompressionFormat = NewFormat;
+}
+
+EP_MEIS_CompressionFormat UCPP_InputProfileStorage::GetCompressionFormat()
+{
+    return GCompressionFormat;
+}
+
+void UCPP_InputProfileStorage::ClearChunkCache()
+{
+    FProfileChunkCache &Cache = GetChunkCache();
+    FScopeLock ScopeLock(&Cache.Lock);
+    Cache.ActionChunks.Empty();
+    Cache.AxisChunks.Empty();
+    Cache.ModifierChunks.Empty();
+}
+
+int32 UCPP_InputProfileStorage::PurgeUnreferencedChunks()
+{
+    // Gather every hash still referenced by a manifest
+    TSet<FString> ReferencedHashes;
+    TArray<FName> Profiles;
+    GetAvailableProfiles(Profiles);
+    for (const FName &ProfileName : Profiles)
+    {
+        FString JsonString;
+        if (!ReadEntryText(ProfileName.ToString(), JsonString))
+        {
+            continue;
+        }
+
+        TSharedPtr<FJsonObject> JsonObject = ParseJsonObject(JsonString);
+        if (JsonObject.IsValid() && IsManifest(JsonObject))
+        {
+            CollectManifestChunks(JsonObject, ReferencedHashes);
+        }
+    }
 
-    // Find all .json files in the profiles directory
-    TArray<FString> FoundFiles;
-    FileMgr.FindFiles(FoundFiles, *ProfileDir, TEXT("json"));
+    UCPP_InputStorageBackend *Backend = GetStorageBackend();
+    TArray<FString> ChunkHashes;
+    Backend->ListEntries(ChunkFolder, ChunkHashes);
 
-    for (const FString &FilePath : FoundFiles)
+    FProfileChunkCache &Cache = GetChunkCache();
+    int32 RemovedCount = 0;
+    for (const FString &Hash : ChunkHashes)
     {
-        FString FileName = FPaths::GetBaseFilename(FilePath);
-        OutProfiles.Add(FName(*FileName));
+        if (ReferencedHashes.Contains(Hash))
+        {
+            continue;
+        }
+
+        if (Backend->DeleteEntry(GetChunkKey(Hash)))
+        {
+            FScopeLock ScopeLock(&Cache.Lock);
+            Cache.ActionChunks.Remove(Hash);
+            Cache.AxisChunks.Remove(Hash);
+            Cache.ModifierChunks.Remove(Hash);
+            ++RemovedCount;
+        }
     }
+
+    UE_LOG(LogTemp, Log, TEXT("P_MEIS: Purged %d unreferenced profile chunks"), RemovedCount);
+    return RemovedCount;
 }
 
 bool UCPP_InputProfileStorage::ExportProfile(const FS_InputProfile &Profile, const FString &FilePath)
 {
-    FString JsonString = SerializeProfileToJson(Profile);
+    // Exports may be loaded where different (or no) definitions are registered
+    FString JsonString = SerializeProfileToJson(Profile, true);
 
-    if (FFileHelper::SaveStringToFile(JsonString, *FilePath))
+    if (UCPP_InputCompressedFile::SaveStringToFile(JsonString, FilePath, GCompressionFormat))
     {
         UE_LOG(LogTemp, Log, TEXT("P_MEIS: Profile exported to %s"), *FilePath);
         return true;
@@ -109,7 +1181,7 @@ bool UCPP_InputProfileStorage::ImportProfile(const FString &FilePath, FS_InputPr
     }
 
     FString JsonString;
-    if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+    if (!UCPP_InputCompressedFile::LoadFileToString(JsonString, FilePath))
     {
         UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to load import file: %s"), *FilePath);
         return false;
@@ -123,74 +1195,27 @@ FString UCPP_InputProfileStorage::GetProfileDirectory()
     return FPaths::ProjectSavedDir() + TEXT("InputProfiles/");
 }
 
+FString UCPP_InputProfileStorage::GetChunkDirectory()
+{
+    return GetProfileDirectory() + TEXT("Chunks/");
+}
+
 FString UCPP_InputProfileStorage::GetProfileFilePath(const FName &ProfileName)
 {
     return GetProfileDirectory() + ProfileName.ToString() + TEXT(".json");
 }
 
-FString UCPP_InputProfileStorage::SerializeProfileToJson(const FS_InputProfile &Profile)
+FString UCPP_InputProfileStorage::SerializeProfileToJson(const FS_InputProfile &Profile, bool bSelfContained)
 {
-    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
-
-    JsonObject->SetStringField(TEXT("ProfileName"), Profile.ProfileName.ToString());
-    JsonObject->SetStringField(TEXT("ProfileDescription"), Profile.ProfileDescription.ToString());
-    JsonObject->SetStringField(TEXT("CreatedBy"), Profile.CreatedBy);
-    JsonObject->SetNumberField(TEXT("Version"), Profile.Version);
-    JsonObject->SetBoolField(TEXT("bIsDefault"), Profile.bIsDefault);
-    JsonObject->SetBoolField(TEXT("bIsCompetitive"), Profile.bIsCompetitive);
-
-    // Optional gameplay preferences (modular; action names provided by game/module)
-    {
-        TArray<TSharedPtr<FJsonValue>> ToggleModeActionsArray;
-        for (const FName &ActionName : Profile.ToggleModeActions)
-        {
-            ToggleModeActionsArray.Add(MakeShareable(new FJsonValueString(ActionName.ToString())));
-        }
-        JsonObject->SetArrayField(TEXT("ToggleModeActions"), ToggleModeActionsArray);
+    TSharedRef<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
 
-        // Preferred explicit toggle-state map.
-        {
-            TSharedPtr<FJsonObject> ToggleStatesObj = MakeShareable(new FJsonObject());
-            for (const TPair<FName, bool> &Pair : Profile.ToggleActionStates)
-            {
-                if (Pair.Key.IsNone())
-                {
-                    continue;
-                }
-                ToggleStatesObj->SetBoolField(Pair.Key.ToString(), Pair.Value);
-            }
-            JsonObject->SetObjectField(TEXT("ToggleActionStates"), ToggleStatesObj);
-        }
-    }
+    WriteProfileHeader(Profile, JsonObject);
 
     // Serialize action bindings
     TArray<TSharedPtr<FJsonValue>> ActionBindingsArray;
     for (const FS_InputActionBinding &ActionBinding : Profile.ActionBindings)
     {
-        TSharedPtr<FJsonObject> ActionObj = MakeShareable(new FJsonObject());
-        ActionObj->SetStringField(TEXT("InputActionName"), ActionBinding.InputActionName.ToString());
-        ActionObj->SetStringField(TEXT("DisplayName"), ActionBinding.DisplayName.ToString());
-        ActionObj->SetStringField(TEXT("Category"), ActionBinding.Category.ToString());
-        ActionObj->SetStringField(TEXT("Description"), ActionBinding.Description.ToString());
-        ActionObj->SetNumberField(TEXT("Priority"), ActionBinding.Priority);
-        ActionObj->SetBoolField(TEXT("bEnabled"), ActionBinding.bEnabled);
-
-        // Key bindings
-        TArray<TSharedPtr<FJsonValue>> KeyBindingsArray;
-        for (const FS_KeyBinding &KeyBinding : ActionBinding.KeyBindings)
-        {
-            TSharedPtr<FJsonObject> KeyObj = MakeShareable(new FJsonObject());
-            KeyObj->SetStringField(TEXT("Key"), KeyBinding.Key.GetFName().ToString());
-            KeyObj->SetNumberField(TEXT("Value"), KeyBinding.Value);
-            KeyObj->SetBoolField(TEXT("bShift"), KeyBinding.bShift);
-            KeyObj->SetBoolField(TEXT("bCtrl"), KeyBinding.bCtrl);
-            KeyObj->SetBoolField(TEXT("bAlt"), KeyBinding.bAlt);
-            KeyObj->SetBoolField(TEXT("bCmd"), KeyBinding.bCmd);
-            KeyBindingsArray.Add(MakeShareable(new FJsonValueObject(KeyObj)));
-        }
-        ActionObj->SetArrayField(TEXT("KeyBindings"), KeyBindingsArray);
-
-        ActionBindingsArray.Add(MakeShareable(new FJsonValueObject(ActionObj)));
+        ActionBindingsArray.Add(MakeShareable(new FJsonValueObject(ActionBindingToJson(ActionBinding, bSelfContained))));
     }
     JsonObject->SetArrayField(TEXT("ActionBindings"), ActionBindingsArray);
 
@@ -198,121 +1223,35 @@ FString UCPP_InputProfileStorage::SerializeProfileToJson(const FS_InputProfile &
     TArray<TSharedPtr<FJsonValue>> AxisBindingsArray;
     for (const FS_InputAxisBinding &AxisBinding : Profile.AxisBindings)
     {
-        TSharedPtr<FJsonObject> AxisObj = MakeShareable(new FJsonObject());
-        AxisObj->SetStringField(TEXT("InputAxisName"), AxisBinding.InputAxisName.ToString());
-        AxisObj->SetStringField(TEXT("DisplayName"), AxisBinding.DisplayName.ToString());
-        AxisObj->SetStringField(TEXT("Category"), AxisBinding.Category.ToString());
-        AxisObj->SetStringField(TEXT("Description"), AxisBinding.Description.ToString());
-        AxisObj->SetNumberField(TEXT("ValueType"), static_cast<int32>(AxisBinding.ValueType));
-        AxisObj->SetNumberField(TEXT("DeadZone"), AxisBinding.DeadZone);
-        AxisObj->SetNumberField(TEXT("Sensitivity"), AxisBinding.Sensitivity);
-        AxisObj->SetNumberField(TEXT("Priority"), AxisBinding.Priority);
-        AxisObj->SetBoolField(TEXT("bInvert"), AxisBinding.bInvert);
-        AxisObj->SetBoolField(TEXT("bEnabled"), AxisBinding.bEnabled);
-
-        // Axis key bindings
-        TArray<TSharedPtr<FJsonValue>> AxisKeysArray;
-        for (const FS_AxisKeyBinding &AxisKey : AxisBinding.AxisBindings)
-        {
-            TSharedPtr<FJsonObject> AxisKeyObj = MakeShareable(new FJsonObject());
-            AxisKeyObj->SetStringField(TEXT("Key"), AxisKey.Key.GetFName().ToString());
-            AxisKeyObj->SetNumberField(TEXT("Scale"), AxisKey.Scale);
-            AxisKeyObj->SetBoolField(TEXT("bSwizzleYXZ"), AxisKey.bSwizzleYXZ);
-            AxisKeysArray.Add(MakeShareable(new FJsonValueObject(AxisKeyObj)));
-        }
-        AxisObj->SetArrayField(TEXT("AxisBindings"), AxisKeysArray);
-
-        AxisBindingsArray.Add(MakeShareable(new FJsonValueObject(AxisObj)));
+        AxisBindingsArray.Add(MakeShareable(new FJsonValueObject(AxisBindingToJson(AxisBinding, bSelfContained))));
     }
     JsonObject->SetArrayField(TEXT("AxisBindings"), AxisBindingsArray);
 
     // Serialize modifiers
-    TArray<TSharedPtr<FJsonValue>> ModifiersArray;
-    for (const FS_InputModifier &Modifier : Profile.Modifiers)
-    {
-        TSharedPtr<FJsonObject> ModObj = MakeShareable(new FJsonObject());
-        ModObj->SetNumberField(TEXT("ModifierType"), static_cast<int32>(Modifier.ModifierType));
-        ModObj->SetNumberField(TEXT("DeadZoneValue"), Modifier.DeadZoneValue);
-        ModObj->SetNumberField(TEXT("ScaleValue"), Modifier.ScaleValue);
-        ModObj->SetBoolField(TEXT("bEnabled"), Modifier.bEnabled);
-
-        ModifiersArray.Add(MakeShareable(new FJsonValueObject(ModObj)));
-    }
-    JsonObject->SetArrayField(TEXT("Modifiers"), ModifiersArray);
+    JsonObject->SetArrayField(TEXT("Modifiers"), ModifiersToJson(Profile.Modifiers));
 
     FString OutputString;
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+    FJsonSerializer::Serialize(JsonObject, Writer);
 
     return OutputString;
 }
 bool UCPP_InputProfileStorage::DeserializeProfileFromJson(const FString &JsonString, FS_InputProfile &OutProfile)
 {
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    TSharedPtr<FJsonObject> JsonObject = ParseJsonObject(JsonString);
+    if (!JsonObject.IsValid())
     {
         UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to parse JSON"));
         return false;
     }
 
-    OutProfile.ProfileName = FName(*JsonObject->GetStringField(TEXT("ProfileName")));
-    OutProfile.ProfileDescription = FText::FromString(JsonObject->GetStringField(TEXT("ProfileDescription")));
-    OutProfile.CreatedBy = JsonObject->GetStringField(TEXT("CreatedBy"));
-
-    int32 Version = 1;
-    if (JsonObject->TryGetNumberField(TEXT("Version"), Version))
-    {
-        OutProfile.Version = Version;
-    }
-    else
-    {
-        OutProfile.Version = 1;
-    }
-
-    bool bIsDefault = false;
-    if (JsonObject->TryGetBoolField(TEXT("bIsDefault"), bIsDefault))
-    {
-        OutProfile.bIsDefault = bIsDefault;
-    }
-
-    bool bIsCompetitive = false;
-    if (JsonObject->TryGetBoolField(TEXT("bIsCompetitive"), bIsCompetitive))
-    {
-        OutProfile.bIsCompetitive = bIsCompetitive;
-    }
-
-    // Optional gameplay preferences (safe defaults if missing)
-    OutProfile.ToggleModeActions.Empty();
-    const TArray<TSharedPtr<FJsonValue>> *ToggleModeActionsArray = nullptr;
-    if (JsonObject->TryGetArrayField(TEXT("ToggleModeActions"), ToggleModeActionsArray))
+    // Deduplicated profiles only carry chunk hashes; resolve them through the shared chunk cache
+    if (IsManifest(JsonObject))
     {
-        for (const TSharedPtr<FJsonValue> &ActionValue : *ToggleModeActionsArray)
-        {
-            FString ActionNameStr;
-            if (ActionValue->TryGetString(ActionNameStr))
-            {
-                OutProfile.ToggleModeActions.Add(FName(*ActionNameStr));
-            }
-        }
+        return DeserializeProfileFromManifest(JsonObject, OutProfile);
     }
 
-    // Preferred explicit toggle state map.
-    OutProfile.ToggleActionStates.Empty();
-    const TSharedPtr<FJsonObject> *ToggleStatesObjPtr = nullptr;
-    if (JsonObject->TryGetObjectField(TEXT("ToggleActionStates"), ToggleStatesObjPtr) && ToggleStatesObjPtr && ToggleStatesObjPtr->IsValid())
-    {
-        for (const TPair<FString, TSharedPtr<FJsonValue>> &Pair : (*ToggleStatesObjPtr)->Values)
-        {
-            bool bValue = false;
-            if (Pair.Value.IsValid() && Pair.Value->TryGetBool(bValue))
-            {
-                OutProfile.ToggleActionStates.Add(FName(*Pair.Key), bValue);
-            }
-        }
-    }
-    // If missing, default stays empty (all toggles OFF).
+    ReadProfileHeader(JsonObject, OutProfile);
 
     // Deserialize action bindings
     OutProfile.ActionBindings.Empty();
@@ -325,44 +1264,7 @@ bool UCPP_InputProfileStorage::DeserializeProfileFromJson(const FString &JsonStr
             if (ActionObj.IsValid())
             {
                 FS_InputActionBinding ActionBinding;
-                ActionBinding.InputActionName = FName(*ActionObj->GetStringField(TEXT("InputActionName")));
-                ActionBinding.DisplayName = FText::FromString(ActionObj->GetStringField(TEXT("DisplayName")));
-                ActionBinding.Category = FName(*ActionObj->GetStringField(TEXT("Category")));
-                ActionBinding.Description = FText::FromString(ActionObj->GetStringField(TEXT("Description")));
-                ActionBinding.Priority = ActionObj->GetNumberField(TEXT("Priority"));
-                ActionBinding.bEnabled = ActionObj->GetBoolField(TEXT("bEnabled"));
-
-                // Key bindings (optional for older profiles)
-                ActionBinding.KeyBindings.Empty();
-                const TArray<TSharedPtr<FJsonValue>> *KeyBindingsArray = nullptr;
-                if (ActionObj->TryGetArrayField(TEXT("KeyBindings"), KeyBindingsArray))
-                {
-                    for (const TSharedPtr<FJsonValue> &KeyValue : *KeyBindingsArray)
-                    {
-                        const TSharedPtr<FJsonObject> KeyObj = KeyValue->AsObject();
-                        if (!KeyObj.IsValid())
-                        {
-                            continue;
-                        }
-
-                        FS_KeyBinding KeyBinding;
-                        KeyBinding.Key = FKey(*KeyObj->GetStringField(TEXT("Key")));
-
-                        double ValueNum = 1.0;
-                        if (KeyObj->TryGetNumberField(TEXT("Value"), ValueNum))
-                        {
-                            KeyBinding.Value = static_cast<float>(ValueNum);
-                        }
-
-                        KeyObj->TryGetBoolField(TEXT("bShift"), KeyBinding.bShift);
-                        KeyObj->TryGetBoolField(TEXT("bCtrl"), KeyBinding.bCtrl);
-                        KeyObj->TryGetBoolField(TEXT("bAlt"), KeyBinding.bAlt);
-                        KeyObj->TryGetBoolField(TEXT("bCmd"), KeyBinding.bCmd);
-
-                        ActionBinding.KeyBindings.Add(KeyBinding);
-                    }
-                }
-
+                ActionBindingFromJson(ActionObj, ActionBinding);
                 OutProfile.ActionBindings.Add(ActionBinding);
             }
         }
@@ -379,66 +1281,7 @@ bool UCPP_InputProfileStorage::DeserializeProfileFromJson(const FString &JsonStr
             if (AxisObj.IsValid())
             {
                 FS_InputAxisBinding AxisBinding;
-                AxisBinding.InputAxisName = FName(*AxisObj->GetStringField(TEXT("InputAxisName")));
-                AxisBinding.Category = FName(*AxisObj->GetStringField(TEXT("Category")));
-
-                FString DisplayNameStr;
-                if (AxisObj->TryGetStringField(TEXT("DisplayName"), DisplayNameStr))
-                {
-                    AxisBinding.DisplayName = FText::FromString(DisplayNameStr);
-                }
-
-                FString DescriptionStr;
-                if (AxisObj->TryGetStringField(TEXT("Description"), DescriptionStr))
-                {
-                    AxisBinding.Description = FText::FromString(DescriptionStr);
-                }
-
-                int32 ValueTypeInt = static_cast<int32>(AxisBinding.ValueType);
-                if (AxisObj->TryGetNumberField(TEXT("ValueType"), ValueTypeInt))
-                {
-                    AxisBinding.ValueType = static_cast<EInputActionValueType>(ValueTypeInt);
-                }
-
-                AxisBinding.DeadZone = AxisObj->GetNumberField(TEXT("DeadZone"));
-                AxisBinding.Sensitivity = AxisObj->GetNumberField(TEXT("Sensitivity"));
-
-                double PriorityNum = AxisBinding.Priority;
-                if (AxisObj->TryGetNumberField(TEXT("Priority"), PriorityNum))
-                {
-                    AxisBinding.Priority = static_cast<float>(PriorityNum);
-                }
-
-                AxisBinding.bInvert = AxisObj->GetBoolField(TEXT("bInvert"));
-                AxisBinding.bEnabled = AxisObj->GetBoolField(TEXT("bEnabled"));
-
-                // Axis key bindings (optional for older profiles)
-                AxisBinding.AxisBindings.Empty();
-                const TArray<TSharedPtr<FJsonValue>> *AxisKeysArray = nullptr;
-                if (AxisObj->TryGetArrayField(TEXT("AxisBindings"), AxisKeysArray))
-                {
-                    for (const TSharedPtr<FJsonValue> &AxisKeyValue : *AxisKeysArray)
-                    {
-                        const TSharedPtr<FJsonObject> AxisKeyObj = AxisKeyValue->AsObject();
-                        if (!AxisKeyObj.IsValid())
-                        {
-                            continue;
-                        }
-
-                        FS_AxisKeyBinding AxisKey;
-                        AxisKey.Key = FKey(*AxisKeyObj->GetStringField(TEXT("Key")));
-
-                        double ScaleNum = 1.0;
-                        if (AxisKeyObj->TryGetNumberField(TEXT("Scale"), ScaleNum))
-                        {
-                            AxisKey.Scale = static_cast<float>(ScaleNum);
-                        }
-                        AxisKeyObj->TryGetBoolField(TEXT("bSwizzleYXZ"), AxisKey.bSwizzleYXZ);
-
-                        AxisBinding.AxisBindings.Add(AxisKey);
-                    }
-                }
-
+                AxisBindingFromJson(AxisObj, AxisBinding);
                 OutProfile.AxisBindings.Add(AxisBinding);
             }
         }
@@ -449,21 +1292,8 @@ bool UCPP_InputProfileStorage::DeserializeProfileFromJson(const FString &JsonStr
     const TArray<TSharedPtr<FJsonValue>> *ModifiersArray = nullptr;
     if (JsonObject->TryGetArrayField(TEXT("Modifiers"), ModifiersArray))
     {
-        for (const TSharedPtr<FJsonValue> &Value : *ModifiersArray)
-        {
-            TSharedPtr<FJsonObject> ModObj = Value->AsObject();
-            if (ModObj.IsValid())
-            {
-                FS_InputModifier Modifier;
-                Modifier.ModifierType = static_cast<EInputModifierType>(ModObj->GetIntegerField(TEXT("ModifierType")));
-                Modifier.DeadZoneValue = ModObj->GetNumberField(TEXT("DeadZoneValue"));
-                Modifier.ScaleValue = ModObj->GetNumberField(TEXT("ScaleValue"));
-                Modifier.bEnabled = ModObj->GetBoolField(TEXT("bEnabled"));
-
-                OutProfile.Modifiers.Add(Modifier);
-            }
-        }
+        ModifiersFromJson(*ModifiersArray, OutProfile.Modifiers);
     }
 
     return true;
-}
\ No newline at end of file
+}
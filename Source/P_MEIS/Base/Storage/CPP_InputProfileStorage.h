@@ -8,10 +8,29 @@
 
 #include "CoreMinimal.h"
 #include "InputBinding/FS_InputProfile.h"
+#include "Storage/CPP_InputCompressedFile.h"
 #include "CPP_InputProfileStorage.generated.h"
 
+class UCPP_InputStorageBackend;
+class UCPP_InputActionDefinitionRegistry;
+
+/**
+ * How profiles are laid out on disk
+ */
+UENUM(BlueprintType)
+enum class EInputProfileStorageMode : uint8
+{
+    // One self-contained JSON file per profile
+    Json = 0 UMETA(DisplayName = "JSON"),
+    // Profile file is a small manifest of content-addressed chunks shared by every profile
+    Deduplicated = 1 UMETA(DisplayName = "Deduplicated Chunks")
+};
+
 /**
  * Static utility class for profile persistence
+ *
+ * All profile IO goes through the active UCPP_InputStorageBackend (file backend by default).
+ * Import/Export always target an explicit file path.
  */
 UCLASS()
 class P_MEIS_API UCPP_InputProfileStorage : public UObject
@@ -35,6 +54,26 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Input Binding|Storage")
     static void GetAvailableProfiles(TArray<FName> &OutProfiles);
 
+    /** Async variants; callbacks run on the game thread */
+    static void SaveProfileAsync(const FS_InputProfile &Profile, TFunction<void(bool bSuccess)> OnComplete);
+    static void LoadProfileAsync(const FName &ProfileName, TFunction<void(bool bSuccess, const FS_InputProfile &Profile)> OnComplete);
+
+    // Storage backend
+    /** Route all profile IO through NewBackend (kept alive while active) */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Storage")
+    static void SetStorageBackend(UCPP_InputStorageBackend *NewBackend);
+
+    /** Active backend; creates the default file backend on first use */
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Storage")
+    static UCPP_InputStorageBackend *GetStorageBackend();
+
+    /**
+     * Definitions that bindings are saved as deltas against (only fields differing from the definition are written)
+     * Loads fill omitted fields back in from the same registry; parsed chunks are re-read once its definitions change.
+     */
+    static void SetActionDefinitionRegistry(UCPP_InputActionDefinitionRegistry *Registry);
+    static UCPP_InputActionDefinitionRegistry *GetActionDefinitionRegistry();
+
     // Import/Export
     UFUNCTION(BlueprintCallable, Category = "Input Binding|Storage")
     static bool ExportProfile(const FS_InputProfile &Profile, const FString &FilePath);
@@ -42,8 +81,44 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Input Binding|Storage")
     static bool ImportProfile(const FString &FilePath, FS_InputProfile &OutProfile);
 
+    // Storage mode
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Storage")
+    static void SetStorageMode(EInputProfileStorageMode NewMode);
+
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Storage")
+    static EInputProfileStorageMode GetStorageMode();
+
+    /** Compression used for saved profiles and exports; reads detect the format automatically */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Storage")
+    static void SetCompressionFormat(EP_MEIS_CompressionFormat NewFormat);
+
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Storage")
+    static EP_MEIS_CompressionFormat GetCompressionFormat();
+
+    /** Drop every parsed chunk held in memory (chunk files on disk are untouched) */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Storage")
+    static void ClearChunkCache();
+
+    /**
+     * Delete chunk files no longer referenced by any profile manifest
+     * @return Number of chunk files removed
+     */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Storage")
+    static int32 PurgeUnreferencedChunks();
+
+    /** Root folder used by the default file backend */
     static FString GetProfileDirectory();
+    static FString GetChunkDirectory();
     static FString GetProfileFilePath(const FName &ProfileName);
-    static FString SerializeProfileToJson(const FS_InputProfile &Profile);
+    /**
+     * Profile -> JSON
+     * @param bSelfContained Write every field instead of deltas against registered action definitions
+     */
+    static FString SerializeProfileToJson(const FS_InputProfile &Profile, bool bSelfContained = false);
     static bool DeserializeProfileFromJson(const FString &JsonString, FS_InputProfile &OutProfile);
+
+private:
+    /** Profile <-> backend bytes (storage mode + compression applied) */
+    static bool EncodeProfile(const FS_InputProfile &Profile, TArray<uint8> &OutBytes);
+    static bool DecodeProfile(const TArray<uint8> &Bytes, FS_InputProfile &OutProfile);
 };
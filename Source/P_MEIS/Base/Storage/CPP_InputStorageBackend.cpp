@@ -0,0 +1,370 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Storage Backend Implementation
+ * @Date: 19/10/2026
+ */
+
+#include "Storage/CPP_InputStorageBackend.h"
+#include "Storage/CPP_InputProfileStorage.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+// ==================== Base Backend ====================
+
+void UCPP_InputStorageBackend::ListEntriesAsync(const FString &Folder, TFunction<void(TArray<FString> &&Names)> OnComplete)
+{
+    TArray<FString> Names;
+    ListEntries(Folder, Names);
+    OnComplete(MoveTemp(Names));
+}
+
+void UCPP_InputStorageBackend::ReadEntryAsync(const FString &Key, FInputStorageReadCallback OnComplete)
+{
+    TArray<uint8> Bytes;
+    const bool bSuccess = ReadEntry(Key, Bytes);
+    OnComplete(bSuccess, MoveTemp(Bytes));
+}
+
+void UCPP_InputStorageBackend::WriteEntryAsync(const FString &Key, TArray<uint8> Bytes, FInputStorageWriteCallback OnComplete)
+{
+    OnComplete(WriteEntry(Key, Bytes));
+}
+
+void UCPP_InputStorageBackend::DeleteEntryAsync(const FString &Key, FInputStorageWriteCallback OnComplete)
+{
+    OnComplete(DeleteEntry(Key));
+}
+
+FString UCPP_InputStorageBackend::GetEntryFolder(const FString &Key)
+{
+    int32 SlashIndex = INDEX_NONE;
+    return Key.FindLastChar(TEXT('/'), SlashIndex) ? Key.Left(SlashIndex) : FString();
+}
+
+// ==================== File Backend ====================
+
+UCPP_InputStorageBackend_File::UCPP_InputStorageBackend_File()
+{
+    RootDirectory = UCPP_InputProfileStorage::GetProfileDirectory();
+}
+
+FString UCPP_InputStorageBackend_File::GetEntryPath(const FString &Key) const
+{
+    return RootDirectory + Key + TEXT(".json");
+}
+
+void UCPP_InputStorageBackend_File::ListEntries(const FString &Folder, TArray<FString> &OutNames)
+{
+    const FString Directory = Folder.IsEmpty() ? RootDirectory : RootDirectory + Folder + TEXT("/");
+
+    TArray<FString> FoundFiles;
+    IFileManager::Get().FindFiles(FoundFiles, *Directory, TEXT("json"));
+
+    for (const FString &FilePath : FoundFiles)
+    {
+        OutNames.Add(FPaths::GetBaseFilename(FilePath));
+    }
+}
+
+bool UCPP_InputStorageBackend_File::ReadEntry(const FString &Key, TArray<uint8> &OutBytes)
+{
+    return FFileHelper::LoadFileToArray(OutBytes, *GetEntryPath(Key), FILEREAD_Silent);
+}
+
+bool UCPP_InputStorageBackend_File::WriteEntry(const FString &Key, const TArray<uint8> &Bytes)
+{
+    return FFileHelper::SaveArrayToFile(Bytes, *GetEntryPath(Key));
+}
+
+bool UCPP_InputStorageBackend_File::DeleteEntry(const FString &Key)
+{
+    return IFileManager::Get().Delete(*GetEntryPath(Key));
+}
+
+bool UCPP_InputStorageBackend_File::EntryExists(const FString &Key)
+{
+    return FPaths::FileExists(*GetEntryPath(Key));
+}
+
+void UCPP_InputStorageBackend_File::ReadEntryAsync(const FString &Key, FInputStorageReadCallback OnComplete)
+{
+    // Only the path crosses threads; the backend object is never touched off the game thread
+    Async(EAsyncExecution::ThreadPool,
+          [FilePath = GetEntryPath(Key), OnComplete = MoveTemp(OnComplete)]() mutable
+          {
+              TArray<uint8> Bytes;
+              const bool bSuccess = FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent);
+
+              AsyncTask(ENamedThreads::GameThread,
+                        [bSuccess, Bytes = MoveTemp(Bytes), OnComplete = MoveTemp(OnComplete)]() mutable
+                        { OnComplete(bSuccess, MoveTemp(Bytes)); });
+          });
+}
+
+void UCPP_InputStorageBackend_File::WriteEntryAsync(const FString &Key, TArray<uint8> Bytes, FInputStorageWriteCallback OnComplete)
+{
+    Async(EAsyncExecution::ThreadPool,
+          [FilePath = GetEntryPath(Key), Bytes = MoveTemp(Bytes), OnComplete = MoveTemp(OnComplete)]() mutable
+          {
+              const bool bSuccess = FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+
+              AsyncTask(ENamedThreads::GameThread,
+                        [bSuccess, OnComplete = MoveTemp(OnComplete)]()
+                        { OnComplete(bSuccess); });
+          });
+}
+
+// ==================== Memory Backend ====================
+
+void UCPP_InputStorageBackend_Memory::ListEntries(const FString &Folder, TArray<FString> &OutNames)
+{
+    FScopeLock ScopeLock(&EntriesLock);
+    for (const TPair<FString, TArray<uint8>> &Pair : Entries)
+    {
+        if (GetEntryFolder(Pair.Key) == Folder)
+        {
+            OutNames.Add(Folder.IsEmpty() ? Pair.Key : Pair.Key.RightChop(Folder.Len() + 1));
+        }
+    }
+}
+
+bool UCPP_InputStorageBackend_Memory::ReadEntry(const FString &Key, TArray<uint8> &OutBytes)
+{
+    FScopeLock ScopeLock(&EntriesLock);
+    if (const TArray<uint8> *Found = Entries.Find(Key))
+    {
+        OutBytes = *Found;
+        return true;
+    }
+    return false;
+}
+
+bool UCPP_InputStorageBackend_Memory::WriteEntry(const FString &Key, const TArray<uint8> &Bytes)
+{
+    FScopeLock ScopeLock(&EntriesLock);
+    Entries.Add(Key, Bytes);
+    return true;
+}
+
+bool UCPP_InputStorageBackend_Memory::DeleteEntry(const FString &Key)
+{
+    FScopeLock ScopeLock(&EntriesLock);
+    return Entries.Remove(Key) > 0;
+}
+
+bool UCPP_InputStorageBackend_Memory::EntryExists(const FString &Key)
+{
+    FScopeLock ScopeLock(&EntriesLock);
+    return Entries.Contains(Key);
+}
+
+void UCPP_InputStorageBackend_Memory::Reset()
+{
+    FScopeLock ScopeLock(&EntriesLock);
+    Entries.Empty();
+}
+
+int32 UCPP_InputStorageBackend_Memory::GetEntryCount() const
+{
+    FScopeLock ScopeLock(&EntriesLock);
+    return Entries.Num();
+}
+
+// ==================== SaveGame Backend ====================
+
+UCPP_InputStorageBackend_SaveGame::UCPP_InputStorageBackend_SaveGame()
+    : SlotPrefix(TEXT("P_MEIS_")), UserIndex(0)
+{
+}
+
+FString UCPP_InputStorageBackend_SaveGame::GetSlotName(const FString &Key) const
+{
+    return SlotPrefix + Key.Replace(TEXT("/"), TEXT("_"));
+}
+
+FString UCPP_InputStorageBackend_SaveGame::GetIndexSlotName() const
+{
+    return SlotPrefix + TEXT("_Index");
+}
+
+UCPP_InputProfileSaveGame *UCPP_InputStorageBackend_SaveGame::GetIndex()
+{
+    if (IndexCache && (IndexCacheSlot != GetIndexSlotName() || IndexCacheUserIndex != UserIndex))
+    {
+        // Slot settings changed since the load: the old index still goes to the slot it came from
+        if (bIndexDirty)
+        {
+            UGameplayStatics::SaveGameToSlot(IndexCache, IndexCacheSlot, IndexCacheUserIndex);
+            bIndexDirty = false;
+        }
+        IndexCache = nullptr;
+    }
+
+    if (!IndexCache)
+    {
+        IndexCacheSlot = GetIndexSlotName();
+        IndexCacheUserIndex = UserIndex;
+        IndexCache = Cast<UCPP_InputProfileSaveGame>(UGameplayStatics::LoadGameFromSlot(GetIndexSlotName(), UserIndex));
+        if (!IndexCache)
+        {
+            IndexCache = Cast<UCPP_InputProfileSaveGame>(UGameplayStatics::CreateSaveGameObject(UCPP_InputProfileSaveGame::StaticClass()));
+        }
+    }
+    return IndexCache;
+}
+
+void UCPP_InputStorageBackend_SaveGame::UpdateIndex(const FString &Key, bool bAdd)
+{
+    UCPP_InputProfileSaveGame *Index = GetIndex();
+    const int32 NumBefore = Index->EntryKeys.Num();
+    if (bAdd)
+    {
+        Index->EntryKeys.AddUnique(Key);
+    }
+    else
+    {
+        Index->EntryKeys.Remove(Key);
+    }
+
+    if (Index->EntryKeys.Num() == NumBefore)
+    {
+        return;
+    }
+
+    // Batched: every entry written this frame shares one index save
+    bIndexDirty = true;
+    if (!FlushHandle.IsValid())
+    {
+        TWeakObjectPtr<UCPP_InputStorageBackend_SaveGame> WeakThis(this);
+        FlushHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+            [WeakThis](float)
+            {
+                if (UCPP_InputStorageBackend_SaveGame *Backend = WeakThis.Get())
+                {
+                    Backend->FlushHandle.Reset();
+                    Backend->FlushIndex();
+                }
+                return false;
+            }));
+    }
+}
+
+void UCPP_InputStorageBackend_SaveGame::FlushIndex()
+{
+    if (!bIndexDirty || !IndexCache)
+    {
+        return;
+    }
+
+    bIndexDirty = false;
+    if (!UGameplayStatics::SaveGameToSlot(IndexCache, IndexCacheSlot, IndexCacheUserIndex))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("P_MEIS: Failed to save storage index slot %s"), *IndexCacheSlot);
+    }
+}
+
+void UCPP_InputStorageBackend_SaveGame::BeginDestroy()
+{
+    if (FlushHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(FlushHandle);
+        FlushHandle.Reset();
+    }
+
+    Super::BeginDestroy();
+}
+
+void UCPP_InputStorageBackend_SaveGame::ListEntries(const FString &Folder, TArray<FString> &OutNames)
+{
+    for (const FString &Key : GetIndex()->EntryKeys)
+    {
+        if (GetEntryFolder(Key) == Folder)
+        {
+            OutNames.Add(Folder.IsEmpty() ? Key : Key.RightChop(Folder.Len() + 1));
+        }
+    }
+}
+
+bool UCPP_InputStorageBackend_SaveGame::ReadEntry(const FString &Key, TArray<uint8> &OutBytes)
+{
+    const FString SlotName = GetSlotName(Key);
+    if (!UGameplayStatics::DoesSaveGameExist(SlotName, UserIndex))
+    {
+        return false;
+    }
+
+    const UCPP_InputProfileSaveGame *SaveGame = Cast<UCPP_InputProfileSaveGame>(UGameplayStatics::LoadGameFromSlot(SlotName, UserIndex));
+    if (!SaveGame)
+    {
+        return false;
+    }
+
+    OutBytes = SaveGame->Data;
+    return true;
+}
+
+bool UCPP_InputStorageBackend_SaveGame::WriteEntry(const FString &Key, const TArray<uint8> &Bytes)
+{
+    UCPP_InputProfileSaveGame *SaveGame = Cast<UCPP_InputProfileSaveGame>(UGameplayStatics::CreateSaveGameObject(UCPP_InputProfileSaveGame::StaticClass()));
+    SaveGame->Data = Bytes;
+
+    if (!UGameplayStatics::SaveGameToSlot(SaveGame, GetSlotName(Key), UserIndex))
+    {
+        return false;
+    }
+
+    UpdateIndex(Key, true);
+    return true;
+}
+
+bool UCPP_InputStorageBackend_SaveGame::DeleteEntry(const FString &Key)
+{
+    const bool bDeleted = UGameplayStatics::DeleteGameInSlot(GetSlotName(Key), UserIndex);
+    UpdateIndex(Key, false);
+    return bDeleted;
+}
+
+bool UCPP_InputStorageBackend_SaveGame::EntryExists(const FString &Key)
+{
+    return UGameplayStatics::DoesSaveGameExist(GetSlotName(Key), UserIndex);
+}
+
+void UCPP_InputStorageBackend_SaveGame::ReadEntryAsync(const FString &Key, FInputStorageReadCallback OnComplete)
+{
+    FAsyncLoadGameFromSlotDelegate OnLoaded = FAsyncLoadGameFromSlotDelegate::CreateLambda(
+        [OnComplete = MoveTemp(OnComplete)](const FString &, const int32, USaveGame *LoadedGame)
+        {
+            TArray<uint8> Bytes;
+            const UCPP_InputProfileSaveGame *SaveGame = Cast<UCPP_InputProfileSaveGame>(LoadedGame);
+            if (SaveGame)
+            {
+                Bytes = SaveGame->Data;
+            }
+            OnComplete(SaveGame != nullptr, MoveTemp(Bytes));
+        });
+
+    UGameplayStatics::AsyncLoadGameFromSlot(GetSlotName(Key), UserIndex, OnLoaded);
+}
+
+void UCPP_InputStorageBackend_SaveGame::WriteEntryAsync(const FString &Key, TArray<uint8> Bytes, FInputStorageWriteCallback OnComplete)
+{
+    UCPP_InputProfileSaveGame *SaveGame = Cast<UCPP_InputProfileSaveGame>(UGameplayStatics::CreateSaveGameObject(UCPP_InputProfileSaveGame::StaticClass()));
+    SaveGame->Data = MoveTemp(Bytes);
+
+    TWeakObjectPtr<UCPP_InputStorageBackend_SaveGame> WeakThis(this);
+    FAsyncSaveGameToSlotDelegate OnSaved = FAsyncSaveGameToSlotDelegate::CreateLambda(
+        [WeakThis, Key, OnComplete = MoveTemp(OnComplete)](const FString &, const int32, bool bSuccess)
+        {
+            if (bSuccess && WeakThis.IsValid())
+            {
+                WeakThis->UpdateIndex(Key, true);
+            }
+            OnComplete(bSuccess);
+        });
+
+    UGameplayStatics::AsyncSaveGameToSlot(SaveGame, GetSlotName(Key), UserIndex, OnSaved);
+}
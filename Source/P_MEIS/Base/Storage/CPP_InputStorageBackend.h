@@ -0,0 +1,195 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Input Storage Backend - Pluggable persistence for profiles (file, SaveGame slot, in-memory)
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/SaveGame.h"
+#include "Containers/Ticker.h"
+#include "CPP_InputStorageBackend.generated.h"
+
+/** Completion callbacks for async backend operations (always invoked on the game thread) */
+using FInputStorageReadCallback = TFunction<void(bool bSuccess, TArray<uint8> &&Bytes)>;
+using FInputStorageWriteCallback = TFunction<void(bool bSuccess)>;
+
+/**
+ * Storage backend used by UCPP_InputProfileStorage.
+ *
+ * Entries are opaque byte blobs addressed by a key of the form "Name" or "Folder/Name"
+ * (e.g. "Default", "Chunks/<hash>"). Encoding and compression happen above this layer.
+ *
+ * The async variants default to running the sync version and completing immediately;
+ * backends with a real async path (file IO, platform saves) override them.
+ */
+UCLASS(Abstract)
+class P_MEIS_API UCPP_InputStorageBackend : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * List entry names stored directly in a folder (non-recursive)
+     * @param Folder Folder to list, empty for the root
+     * @param OutNames Entry names without the folder prefix
+     */
+    virtual void ListEntries(const FString &Folder, TArray<FString> &OutNames) PURE_VIRTUAL(UCPP_InputStorageBackend::ListEntries, );
+
+    virtual bool ReadEntry(const FString &Key, TArray<uint8> &OutBytes) PURE_VIRTUAL(UCPP_InputStorageBackend::ReadEntry, return false;);
+    virtual bool WriteEntry(const FString &Key, const TArray<uint8> &Bytes) PURE_VIRTUAL(UCPP_InputStorageBackend::WriteEntry, return false;);
+    virtual bool DeleteEntry(const FString &Key) PURE_VIRTUAL(UCPP_InputStorageBackend::DeleteEntry, return false;);
+    virtual bool EntryExists(const FString &Key) PURE_VIRTUAL(UCPP_InputStorageBackend::EntryExists, return false;);
+
+    // Async variants
+    virtual void ListEntriesAsync(const FString &Folder, TFunction<void(TArray<FString> &&Names)> OnComplete);
+    virtual void ReadEntryAsync(const FString &Key, FInputStorageReadCallback OnComplete);
+    virtual void WriteEntryAsync(const FString &Key, TArray<uint8> Bytes, FInputStorageWriteCallback OnComplete);
+    virtual void DeleteEntryAsync(const FString &Key, FInputStorageWriteCallback OnComplete);
+
+    /** Human readable location of an entry, for logging */
+    virtual FString DescribeEntry(const FString &Key) const { return Key; }
+
+    /** Write out anything the backend batches (called before it stops being the active backend) */
+    virtual void Flush() {}
+
+protected:
+    /** Split "Folder/Name" into its folder part ("" for root entries) */
+    static FString GetEntryFolder(const FString &Key);
+};
+
+/**
+ * Default backend: one file per entry under a root directory (Saved/InputProfiles/ by default)
+ */
+UCLASS()
+class P_MEIS_API UCPP_InputStorageBackend_File : public UCPP_InputStorageBackend
+{
+    GENERATED_BODY()
+
+public:
+    UCPP_InputStorageBackend_File();
+
+    /** Root directory entries are stored under; keys map to <Root><Key>.json */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Binding|Storage")
+    FString RootDirectory;
+
+    virtual void ListEntries(const FString &Folder, TArray<FString> &OutNames) override;
+    virtual bool ReadEntry(const FString &Key, TArray<uint8> &OutBytes) override;
+    virtual bool WriteEntry(const FString &Key, const TArray<uint8> &Bytes) override;
+    virtual bool DeleteEntry(const FString &Key) override;
+    virtual bool EntryExists(const FString &Key) override;
+
+    virtual void ReadEntryAsync(const FString &Key, FInputStorageReadCallback OnComplete) override;
+    virtual void WriteEntryAsync(const FString &Key, TArray<uint8> Bytes, FInputStorageWriteCallback OnComplete) override;
+
+    virtual FString DescribeEntry(const FString &Key) const override { return GetEntryPath(Key); }
+
+    FString GetEntryPath(const FString &Key) const;
+};
+
+/**
+ * Pure in-memory backend. Nothing touches disk, which keeps tests and benchmarks deterministic.
+ */
+UCLASS()
+class P_MEIS_API UCPP_InputStorageBackend_Memory : public UCPP_InputStorageBackend
+{
+    GENERATED_BODY()
+
+public:
+    virtual void ListEntries(const FString &Folder, TArray<FString> &OutNames) override;
+    virtual bool ReadEntry(const FString &Key, TArray<uint8> &OutBytes) override;
+    virtual bool WriteEntry(const FString &Key, const TArray<uint8> &Bytes) override;
+    virtual bool DeleteEntry(const FString &Key) override;
+    virtual bool EntryExists(const FString &Key) override;
+
+    /** Remove every entry */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Storage")
+    void Reset();
+
+    UFUNCTION(BlueprintPure, Category = "Input Binding|Storage")
+    int32 GetEntryCount() const;
+
+private:
+    mutable FCriticalSection EntriesLock;
+    TMap<FString, TArray<uint8>> Entries;
+};
+
+/**
+ * SaveGame object holding one storage entry (or the entry index for the SaveGame backend)
+ */
+UCLASS()
+class P_MEIS_API UCPP_InputProfileSaveGame : public USaveGame
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    TArray<uint8> Data;
+
+    /** Only used by the index slot: every key written through the backend */
+    UPROPERTY()
+    TArray<FString> EntryKeys;
+};
+
+/**
+ * Backend storing each entry in its own USaveGame slot, so consoles go through the
+ * platform save system. Slots cannot be enumerated portably, so an index slot tracks keys.
+ *
+ * The index is loaded once and kept in memory; changes are written back once per frame
+ * (a profile save writing many chunks costs one index save), on FlushIndex, and when the
+ * backend is replaced as the active backend.
+ */
+UCLASS()
+class P_MEIS_API UCPP_InputStorageBackend_SaveGame : public UCPP_InputStorageBackend
+{
+    GENERATED_BODY()
+
+public:
+    UCPP_InputStorageBackend_SaveGame();
+
+    /** Prefix for every slot written by this backend */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Binding|Storage")
+    FString SlotPrefix;
+
+    /** Platform user index passed to the save system */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Binding|Storage")
+    int32 UserIndex;
+
+    virtual void ListEntries(const FString &Folder, TArray<FString> &OutNames) override;
+    virtual bool ReadEntry(const FString &Key, TArray<uint8> &OutBytes) override;
+    virtual bool WriteEntry(const FString &Key, const TArray<uint8> &Bytes) override;
+    virtual bool DeleteEntry(const FString &Key) override;
+    virtual bool EntryExists(const FString &Key) override;
+
+    virtual void ReadEntryAsync(const FString &Key, FInputStorageReadCallback OnComplete) override;
+    virtual void WriteEntryAsync(const FString &Key, TArray<uint8> Bytes, FInputStorageWriteCallback OnComplete) override;
+
+    virtual FString DescribeEntry(const FString &Key) const override { return GetSlotName(Key); }
+
+    FString GetSlotName(const FString &Key) const;
+
+    /** Write the index slot now if it has unsaved changes */
+    UFUNCTION(BlueprintCallable, Category = "Input Binding|Storage")
+    void FlushIndex();
+
+    virtual void Flush() override { FlushIndex(); }
+    virtual void BeginDestroy() override;
+
+private:
+    FString GetIndexSlotName() const;
+    void UpdateIndex(const FString &Key, bool bAdd);
+
+    /** Cached index, loaded from its slot on first use (created empty if the slot does not exist) */
+    UCPP_InputProfileSaveGame *GetIndex();
+
+    UPROPERTY(Transient)
+    UCPP_InputProfileSaveGame *IndexCache = nullptr;
+
+    /** Slot/user the cache was loaded for; SlotPrefix and UserIndex are editable */
+    FString IndexCacheSlot;
+    int32 IndexCacheUserIndex = INDEX_NONE;
+
+    bool bIndexDirty = false;
+    FTSTicker::FDelegateHandle FlushHandle;
+};
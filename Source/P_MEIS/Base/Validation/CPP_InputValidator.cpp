@@ -5,6 +5,7 @@
  */
 
 #include "Validation/CPP_InputValidator.h"
+#include "Validation/InputKeyChordIndex.h"
 
 bool UCPP_InputValidator::ValidateKeyBinding(const FS_KeyBinding& KeyBinding, FString& OutErrorMessage)
 {
@@ -112,27 +113,21 @@ TArray<TPair<FName, FName>>& OutConflicts)
 {
 OutConflicts.Empty();
 
+// Group bindings by chord, then report every pair that shares one
+FInputKeyChordIndex Index;
+Index.Reserve(ActionBindings.Num() * 2);
 for (int32 i = 0; i < ActionBindings.Num(); ++i)
 {
-for (int32 j = i + 1; j < ActionBindings.Num(); ++j)
+for (const FS_KeyBinding& KeyBinding : ActionBindings[i].KeyBindings)
 {
-const FS_InputActionBinding& BindingA = ActionBindings[i];
-const FS_InputActionBinding& BindingB = ActionBindings[j];
-
-for (const FS_KeyBinding& KeyA : BindingA.KeyBindings)
-{
-for (const FS_KeyBinding& KeyB : BindingB.KeyBindings)
-{
-if (KeyA.Key == KeyB.Key && KeyA.bCtrl == KeyB.bCtrl && 
-    KeyA.bShift == KeyB.bShift && KeyA.bAlt == KeyB.bAlt && 
-    KeyA.bCmd == KeyB.bCmd)
-{
-OutConflicts.Add(TPair<FName, FName>(BindingA.InputActionName, BindingB.InputActionName));
-}
-}
-}
+Index.Add(FInputKeyChord(KeyBinding.Key.GetFName(), KeyBinding.bShift, KeyBinding.bCtrl, KeyBinding.bAlt, KeyBinding.bCmd), i);
 }
 }
 
+Index.ForEachConflict([&ActionBindings, &OutConflicts](int32 A, int32 B)
+{
+OutConflicts.Add(TPair<FName, FName>(ActionBindings[A].InputActionName, ActionBindings[B].InputActionName));
+});
+
 return OutConflicts.Num() > 0;
 }
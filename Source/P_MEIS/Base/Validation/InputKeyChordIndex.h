@@ -0,0 +1,113 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Key Chord Index - Hash index from key + modifier chord to binding owners
+ *               Depends on Core only (no UObject/InputCore types) so it can be built outside the engine
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * A key plus the modifier keys that must be held with it
+ */
+struct FInputKeyChord
+{
+    enum EModifier : uint8
+    {
+        Shift = 1 << 0,
+        Ctrl = 1 << 1,
+        Alt = 1 << 2,
+        Cmd = 1 << 3
+    };
+
+    FName KeyName;
+    uint8 Modifiers = 0;
+
+    FInputKeyChord() = default;
+
+    FInputKeyChord(FName InKeyName, bool bShift, bool bCtrl, bool bAlt, bool bCmd)
+        : KeyName(InKeyName), Modifiers((bShift ? Shift : 0) | (bCtrl ? Ctrl : 0) | (bAlt ? Alt : 0) | (bCmd ? Cmd : 0))
+    {
+    }
+
+    bool operator==(const FInputKeyChord &Other) const
+    {
+        return KeyName == Other.KeyName && Modifiers == Other.Modifiers;
+    }
+
+    friend uint32 GetTypeHash(const FInputKeyChord &Chord)
+    {
+        return HashCombine(GetTypeHash(Chord.KeyName), Chord.Modifiers);
+    }
+};
+
+/**
+ * Chord -> owners (binding indices) index
+ *
+ * Conflict detection is one pass over every key instead of comparing every pair of
+ * bindings key by key. Owners are added in ascending order, so each chord's owner
+ * list stays sorted and a binding listing the same chord twice is stored once.
+ */
+class FInputKeyChordIndex
+{
+public:
+    void Reset()
+    {
+        Owners.Reset();
+    }
+
+    void Reserve(int32 NumChords)
+    {
+        Owners.Reserve(NumChords);
+    }
+
+    /** Record that OwnerIndex uses Chord (call with non-decreasing OwnerIndex) */
+    void Add(const FInputKeyChord &Chord, int32 OwnerIndex)
+    {
+        TArray<int32, TInlineAllocator<2>> &List = Owners.FindOrAdd(Chord);
+        if (List.Num() == 0 || List.Last() != OwnerIndex)
+        {
+            List.Add(OwnerIndex);
+        }
+    }
+
+    /** Owners of a chord (nullptr if unused) */
+    const TArray<int32, TInlineAllocator<2>> *Find(const FInputKeyChord &Chord) const
+    {
+        return Owners.Find(Chord);
+    }
+
+    /** Number of distinct chords */
+    int32 Num() const
+    {
+        return Owners.Num();
+    }
+
+    /**
+     * Call Visitor(OwnerA, OwnerB) for every pair of owners sharing a chord (OwnerA < OwnerB)
+     * @return Number of pairs visited
+     */
+    template <typename VisitorType>
+    int32 ForEachConflict(VisitorType &&Visitor) const
+    {
+        int32 Count = 0;
+        for (const TPair<FInputKeyChord, TArray<int32, TInlineAllocator<2>>> &Pair : Owners)
+        {
+            const TArray<int32, TInlineAllocator<2>> &List = Pair.Value;
+            for (int32 A = 0; A < List.Num(); ++A)
+            {
+                for (int32 B = A + 1; B < List.Num(); ++B)
+                {
+                    Visitor(List[A], List[B]);
+                    Count++;
+                }
+            }
+        }
+        return Count;
+    }
+
+private:
+    TMap<FInputKeyChord, TArray<int32, TInlineAllocator<2>>> Owners;
+};
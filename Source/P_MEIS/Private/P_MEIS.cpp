@@ -5,6 +5,7 @@
  */
 
 #include "P_MEIS.h"
+#include "P_MEIS_Memory.h"
 
 #define LOCTEXT_NAMESPACE "FP_MEISModule"
 
@@ -13,6 +14,10 @@ void FP_MEISModule::StartupModule()
 // This code will execute after your module is loaded into memory
 // The exact timing is specified in the .uplugin file per-module
 UE_LOG(LogTemp, Log, TEXT("P_MEIS: Module Started"));
+
+#if !UE_BUILD_SHIPPING
+FP_MEIS_AllocationCounter::InstallAtStartup();
+#endif
 }
 
 void FP_MEISModule::ShutdownModule()
@@ -0,0 +1,290 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - LLM tags, allocation counter and hot-path allocation check
+ * @Date: 19/10/2026
+ */
+
+#include "P_MEIS_Memory.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Engine/Engine.h"
+#include "GameFramework/PlayerController.h"
+#include "Manager/CPP_InputBindingManager.h"
+#include "Integration/CPP_EnhancedInputIntegration.h"
+
+LLM_DEFINE_TAG(PMEIS);
+LLM_DEFINE_TAG(PMEIS_Profiles);
+LLM_DEFINE_TAG(PMEIS_Templates);
+LLM_DEFINE_TAG(PMEIS_UObjects);
+LLM_DEFINE_TAG(PMEIS_Analytics);
+LLM_DEFINE_TAG(PMEIS_Recordings);
+
+#if !UE_BUILD_SHIPPING
+
+namespace P_MEIS_Memory
+{
+/**
+ * GMalloc wrapper that counts game-thread Malloc/Realloc calls
+ * Installed once at startup and never removed; everything else forwards to the wrapped allocator.
+ */
+class FCountingMalloc final : public FMalloc
+{
+public:
+FMalloc* Inner = nullptr;
+int64 GameThreadAllocations = 0;
+
+virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+{
+CountAllocation();
+return Inner->Malloc(Count, Alignment);
+}
+
+virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+{
+CountAllocation();
+return Inner->Realloc(Original, Count, Alignment);
+}
+
+virtual void Free(void* Original) override
+{
+Inner->Free(Original);
+}
+
+virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+{
+return Inner->QuantizeSize(Count, Alignment);
+}
+
+virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+{
+return Inner->GetAllocationSize(Original, SizeOut);
+}
+
+virtual void Trim(bool bTrimThreadCaches) override
+{
+Inner->Trim(bTrimThreadCaches);
+}
+
+virtual void SetupTLSCachesOnCurrentThread() override
+{
+Inner->SetupTLSCachesOnCurrentThread();
+}
+
+virtual void MarkTLSCachesAsUsedOnCurrentThread() override
+{
+Inner->MarkTLSCachesAsUsedOnCurrentThread();
+}
+
+virtual void MarkTLSCachesAsUnusedOnCurrentThread() override
+{
+Inner->MarkTLSCachesAsUnusedOnCurrentThread();
+}
+
+virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+{
+Inner->ClearAndDisableTLSCachesOnCurrentThread();
+}
+
+virtual void UpdateStats() override
+{
+Inner->UpdateStats();
+}
+
+virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override
+{
+Inner->GetAllocatorStats(OutStats);
+}
+
+virtual void DumpAllocatorStats(FOutputDevice& Ar) override
+{
+Inner->DumpAllocatorStats(Ar);
+}
+
+virtual bool ValidateHeap() override
+{
+return Inner->ValidateHeap();
+}
+
+virtual void OnMallocInitialized() override
+{
+Inner->OnMallocInitialized();
+}
+
+virtual void OnPreFork() override
+{
+Inner->OnPreFork();
+}
+
+virtual void OnPostFork() override
+{
+Inner->OnPostFork();
+}
+
+virtual bool IsInternallyThreadSafe() const override
+{
+return Inner->IsInternallyThreadSafe();
+}
+
+virtual const TCHAR* GetDescriptiveName() override
+{
+return TEXT("P_MEIS Counting Malloc");
+}
+
+private:
+void CountAllocation()
+{
+if (IsInGameThread())
+{
+GameThreadAllocations++;
+}
+}
+};
+
+static FCountingMalloc& GetCountingMalloc()
+{
+static FCountingMalloc CountingMalloc;
+return CountingMalloc;
+}
+}
+
+void FP_MEIS_AllocationCounter::InstallAtStartup()
+{
+P_MEIS_Memory::FCountingMalloc& CountingMalloc = P_MEIS_Memory::GetCountingMalloc();
+if (CountingMalloc.Inner || !GMalloc || !FParse::Param(FCommandLine::Get(), TEXT("PMEISCountAllocs")))
+{
+return;
+}
+
+CountingMalloc.Inner = GMalloc;
+FPlatformMisc::MemoryBarrier();
+GMalloc = &CountingMalloc;
+UE_LOG(LogTemp, Log, TEXT("P_MEIS: Counting allocator installed over %s"), CountingMalloc.Inner->GetDescriptiveName());
+}
+
+bool FP_MEIS_AllocationCounter::IsAvailable()
+{
+return GMalloc == &P_MEIS_Memory::GetCountingMalloc();
+}
+
+FP_MEIS_AllocationCounter::FP_MEIS_AllocationCounter()
+{
+check(IsInGameThread());
+StartCount = P_MEIS_Memory::GetCountingMalloc().GameThreadAllocations;
+}
+
+int64 FP_MEIS_AllocationCounter::GetAllocationCount() const
+{
+return P_MEIS_Memory::GetCountingMalloc().GameThreadAllocations - StartCount;
+}
+
+// ==================== Hot Path Allocation Check ====================
+
+FP_MEIS_HotPathAllocationCheck::FResult FP_MEIS_HotPathAllocationCheck::Run(const TArray<FName>& ActionNames, int32 Iterations)
+{
+check(IsInGameThread());
+
+// Its own integration: nothing the players see is bound to it, and its stats are thrown away with it
+TStrongObjectPtr<UCPP_EnhancedInputIntegration> Integration(NewObject<UCPP_EnhancedInputIntegration>(GetTransientPackage()));
+
+// A consuming listener per action keeps the chain walk in the measured path
+for (const FName& ActionName : ActionNames)
+{
+Integration->AddActionListenerNative(ActionName, MAX_int32, [](FName, ETriggerEvent, const FInputActionValue&)
+{ return true; });
+}
+
+auto RunPass = [&Integration, &ActionNames]()
+{
+for (const FName& ActionName : ActionNames)
+{
+Integration->DispatchActionEvent(ActionName, ETriggerEvent::Started, FInputActionValue(true));
+Integration->DispatchActionEvent(ActionName, ETriggerEvent::Triggered, FInputActionValue(true));
+Integration->DispatchActionEvent(ActionName, ETriggerEvent::Completed, FInputActionValue(false));
+Integration->DispatchActionEvent(ActionName, ETriggerEvent::Triggered, FInputActionValue(FVector2D(0.5f, 0.5f)));
+Integration->IsActionHeld(ActionName);
+Integration->GetActionValue(ActionName);
+Integration->GetActionRates(ActionName);
+Integration->GetActionListenerCount(ActionName);
+}
+Integration->GetPlayerRates();
+};
+
+// First pass creates per-action state; only steady state is measured
+RunPass();
+
+FResult Result;
+{
+FP_MEIS_AllocationCounter Counter;
+for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+{
+RunPass();
+}
+Result.Allocations = Counter.GetAllocationCount();
+}
+Result.Events = Iterations * ActionNames.Num() * 4;
+Result.bCounted = FP_MEIS_AllocationCounter::IsAvailable();
+return Result;
+}
+
+/**
+ * Runs the hot-path check over the action names of every local player's integration
+ * The players' integrations are only read for their action names.
+ */
+static void CheckHotPathAllocations(const TArray<FString>& Args)
+{
+const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100;
+
+UCPP_InputBindingManager* Manager = GEngine ? GEngine->GetEngineSubsystem<UCPP_InputBindingManager>() : nullptr;
+if (!Manager)
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: CheckHotPathAllocations - no Input Binding Manager"));
+return;
+}
+
+TArray<APlayerController*> Players;
+Manager->GetRegisteredPlayers(Players);
+
+TArray<FName> ActionNames;
+for (APlayerController* PlayerController : Players)
+{
+UCPP_EnhancedInputIntegration* Integration = Manager->GetIntegrationForPlayer(PlayerController);
+if (Integration && PlayerController->IsLocalController())
+{
+TArray<FName> PlayerActionNames;
+Integration->GetAllInputActionNames(PlayerActionNames);
+for (const FName& ActionName : PlayerActionNames)
+{
+ActionNames.AddUnique(ActionName);
+}
+}
+}
+
+if (ActionNames.Num() == 0)
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: CheckHotPathAllocations - no local player has any actions"));
+return;
+}
+
+const FP_MEIS_HotPathAllocationCheck::FResult Result = FP_MEIS_HotPathAllocationCheck::Run(ActionNames, Iterations);
+if (!Result.bCounted)
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: CheckHotPathAllocations - start with -PMEISCountAllocs to count allocations (%d events dispatched)"), Result.Events);
+}
+else if (Result.Allocations > 0)
+{
+UE_LOG(LogTemp, Warning, TEXT("P_MEIS: %lld heap allocations over %d dispatched events for %d actions (expected 0)"), Result.Allocations, Result.Events, ActionNames.Num());
+}
+else
+{
+UE_LOG(LogTemp, Log, TEXT("P_MEIS: No heap allocations over %d dispatched events for %d actions"), Result.Events, ActionNames.Num());
+}
+}
+
+static FAutoConsoleCommand CheckHotPathAllocationsCommand(
+TEXT("p_meis.CheckHotPathAllocations"),
+TEXT("Dispatch/query the local players' actions N times (default 100) on a scratch integration and report steady-state heap allocations (needs -PMEISCountAllocs)"),
+FConsoleCommandWithArgsDelegate::CreateStatic(&CheckHotPathAllocations));
+
+#endif
@@ -0,0 +1,34 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - Hot path allocation automation test
+ * @Date: 19/10/2026
+ */
+
+#include "P_MEIS_Memory.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && !UE_BUILD_SHIPPING
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FP_MEIS_HotPathAllocationTest, "P_MEIS.Memory.HotPathAllocations",
+EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FP_MEIS_HotPathAllocationTest::RunTest(const FString& Parameters)
+{
+const TArray<FName> ActionNames = { TEXT("Jump"), TEXT("Fire"), TEXT("Move"), TEXT("Look"), TEXT("Interact") };
+const int32 Iterations = 100;
+
+const FP_MEIS_HotPathAllocationCheck::FResult Result = FP_MEIS_HotPathAllocationCheck::Run(ActionNames, Iterations);
+TestEqual(TEXT("Dispatched events"), Result.Events, Iterations * ActionNames.Num() * 4);
+
+// Without the counter nothing was checked, so this must not pass
+if (!Result.bCounted)
+{
+AddError(TEXT("Counting allocator not installed; run with -PMEISCountAllocs to check allocations"));
+return false;
+}
+
+TestEqual(TEXT("Heap allocations in the warmed-up hot path"), Result.Allocations, static_cast<int64>(0));
+return true;
+}
+
+#endif
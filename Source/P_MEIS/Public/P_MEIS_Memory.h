@@ -0,0 +1,79 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - LLM memory tags and allocation counting
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/**
+ * LLM tags (run with -llm / -llmcsv); underscores become the hierarchy, so these
+ * report as PMEIS, PMEIS/Profiles, PMEIS/Templates, ...
+ */
+LLM_DECLARE_TAG_API(PMEIS, P_MEIS_API);
+LLM_DECLARE_TAG_API(PMEIS_Profiles, P_MEIS_API);
+LLM_DECLARE_TAG_API(PMEIS_Templates, P_MEIS_API);
+LLM_DECLARE_TAG_API(PMEIS_UObjects, P_MEIS_API);
+LLM_DECLARE_TAG_API(PMEIS_Analytics, P_MEIS_API);
+LLM_DECLARE_TAG_API(PMEIS_Recordings, P_MEIS_API);
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * Counts game-thread heap allocations (Malloc + Realloc) while in scope
+ *
+ * Reads a counting allocator that wraps GMalloc once, at module startup, when the
+ * process runs with -PMEISCountAllocs; it stays installed until exit and GMalloc is
+ * never swapped while the game runs. Without it IsAvailable() is false and counts
+ * stay zero. Development tool only - it relies on allocations going through GMalloc.
+ */
+class P_MEIS_API FP_MEIS_AllocationCounter
+{
+public:
+FP_MEIS_AllocationCounter();
+
+/** Game-thread allocations since this counter was created */
+int64 GetAllocationCount() const;
+
+/** True if the counting allocator was installed at startup */
+static bool IsAvailable();
+
+/** Wrap GMalloc if -PMEISCountAllocs is on the command line (called once from StartupModule) */
+static void InstallAtStartup();
+
+private:
+int64 StartCount = 0;
+};
+
+/**
+ * Steady-state heap allocation check of the action dispatch and query hot path
+ *
+ * Runs against an integration it creates and discards itself, so no player's listeners,
+ * rate counters or timing stats are touched.
+ */
+class P_MEIS_API FP_MEIS_HotPathAllocationCheck
+{
+public:
+struct FResult
+{
+/** Allocations over the measured passes (0 when not counted) */
+int64 Allocations = 0;
+
+/** Events dispatched during the measured passes */
+int32 Events = 0;
+
+/** False if the counting allocator is not installed */
+bool bCounted = false;
+};
+
+/**
+ * Dispatch press/trigger/release/axis events and run the per-action queries for every name,
+ * once to warm up and then Iterations times under an FP_MEIS_AllocationCounter
+ */
+static FResult Run(const TArray<FName>& ActionNames, int32 Iterations);
+};
+
+#endif
@@ -0,0 +1,38 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - Editor Build.cs.
+ * @Date: 19/10/2026
+ */
+
+using UnrealBuildTool;
+
+// Build configuration for the P_MEIS Blueprint node module (editor and cook only)
+public class P_MEISEditor : ModuleRules
+{
+	public P_MEISEditor(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		// Public dependencies - modules that are required by public headers
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"BlueprintGraph",
+				"P_MEIS",
+			}
+			);
+
+		// Private dependencies - modules only needed for implementation
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"InputCore",
+				"KismetCompiler",
+				"UnrealEd",
+			}
+			);
+	}
+}
@@ -0,0 +1,124 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Action name lookup and validation shared by the P_MEIS Blueprint action nodes
+ * @Date: 19/10/2026
+ */
+
+#include "InputActionNodeNames.h"
+#include "Manager/CPP_InputBindingManager.h"
+#include "Manager/CPP_InputActionDefinitionRegistry.h"
+#include "K2Node.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "Engine/Engine.h"
+
+namespace
+{
+/** Templates may be read from disk; one scan serves a whole Blueprint compile */
+const double NameCacheLifetime = 2.0;
+
+struct FNameCache
+{
+    TArray<FName> Names;
+    double GatheredAt = -1.0;
+};
+
+FNameCache NameCaches[2];
+}
+
+TArray<FName> FInputActionNodeNames::Gather(bool bIncludeAxes)
+{
+    FNameCache &Cache = NameCaches[bIncludeAxes ? 1 : 0];
+    const double Now = FPlatformTime::Seconds();
+    if (Cache.GatheredAt >= 0.0 && Now - Cache.GatheredAt < NameCacheLifetime)
+    {
+        return Cache.Names;
+    }
+
+    TSet<FName> Names;
+    UCPP_InputBindingManager *Manager = GEngine ? GEngine->GetEngineSubsystem<UCPP_InputBindingManager>() : nullptr;
+    if (Manager)
+    {
+        if (const UCPP_InputActionDefinitionRegistry *Registry = Manager->GetActionDefinitionRegistry())
+        {
+            for (int32 Index = 0; Index < Registry->GetDefinitionCount(); ++Index)
+            {
+                const FS_InputActionDefinition *Definition = Registry->FindDefinitionByIndex(Index);
+                if (Definition && (bIncludeAxes || !Definition->bIsAxis))
+                {
+                    Names.Add(Definition->ActionName);
+                }
+            }
+        }
+
+        TArray<FName> Templates;
+        Manager->GetAvailableTemplates(Templates);
+        for (const FName &TemplateName : Templates)
+        {
+            FS_InputProfile Template;
+            if (!Manager->GetTemplate(TemplateName, Template))
+            {
+                continue;
+            }
+
+            for (const FS_InputActionBinding &Binding : Template.ActionBindings)
+            {
+                Names.Add(Binding.InputActionName);
+            }
+            if (bIncludeAxes)
+            {
+                for (const FS_InputAxisBinding &Binding : Template.AxisBindings)
+                {
+                    Names.Add(Binding.InputAxisName);
+                }
+            }
+        }
+    }
+    Names.Remove(NAME_None);
+
+    Cache.Names = Names.Array();
+    Cache.Names.Sort(FNameLexicalLess());
+    Cache.GatheredAt = Now;
+    return Cache.Names;
+}
+
+TArray<FString> FInputActionNodeNames::GetOptions(bool bIncludeAxes)
+{
+    TArray<FString> Options;
+    for (const FName &Name : Gather(bIncludeAxes))
+    {
+        Options.Add(Name.ToString());
+    }
+    return Options;
+}
+
+void FInputActionNodeNames::Validate(const UK2Node *Node, FName ActionName, bool bIncludeAxes, FCompilerResultsLog &MessageLog)
+{
+    if (ActionName.IsNone())
+    {
+        MessageLog.Error(TEXT("@@ has no input action selected"), Node);
+        return;
+    }
+
+    const TArray<FName> Known = Gather(bIncludeAxes);
+    if (Known.Num() == 0)
+    {
+        MessageLog.Warning(*FString::Printf(TEXT("@@: no input templates or action definitions are loaded, so '%s' could not be checked"), *ActionName.ToString()), Node);
+        return;
+    }
+
+    if (!Known.Contains(ActionName))
+    {
+        MessageLog.Error(*FString::Printf(TEXT("@@ uses unknown input action '%s'"), *ActionName.ToString()), Node);
+        return;
+    }
+
+    // Ids are what the compiled graph carries, so two known actions must never share one
+    const int32 ActionId = UCPP_InputActionDefinitionRegistry::MakeActionId(ActionName);
+    for (const FName &Other : Known)
+    {
+        if (Other != ActionName && UCPP_InputActionDefinitionRegistry::MakeActionId(Other) == ActionId)
+        {
+            MessageLog.Error(*FString::Printf(TEXT("@@: input actions '%s' and '%s' have the same id; rename one"), *ActionName.ToString(), *Other.ToString()), Node);
+        }
+    }
+}
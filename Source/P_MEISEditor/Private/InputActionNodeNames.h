@@ -0,0 +1,28 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Action name lookup and validation shared by the P_MEIS Blueprint action nodes
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UK2Node;
+class FCompilerResultsLog;
+
+/**
+ * Actions known to the editor: every profile template plus the registered action definitions
+ * Read through the engine-subsystem manager, which also runs in the editor.
+ */
+struct FInputActionNodeNames
+{
+    /** Sorted action names (axes too when bIncludeAxes); re-read at most every couple of seconds */
+    static TArray<FName> Gather(bool bIncludeAxes);
+
+    /** Dropdown entries for a node's ActionName property */
+    static TArray<FString> GetOptions(bool bIncludeAxes);
+
+    /** Error on an unset, unknown or id-colliding ActionName; warning if nothing is loaded to check against */
+    static void Validate(const UK2Node *Node, FName ActionName, bool bIncludeAxes, FCompilerResultsLog &MessageLog);
+};
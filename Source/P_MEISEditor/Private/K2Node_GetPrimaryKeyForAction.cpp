@@ -0,0 +1,103 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Blueprint node - primary key of an action picked from a dropdown and resolved at compile time
+ * @Date: 19/10/2026
+ */
+
+#include "K2Node_GetPrimaryKeyForAction.h"
+#include "InputActionNodeNames.h"
+#include "Manager/CPP_BPL_InputBinding.h"
+#include "Manager/CPP_InputActionDefinitionRegistry.h"
+#include "K2Node_CallFunction.h"
+#include "EdGraphSchema_K2.h"
+#include "KismetCompiler.h"
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "InputCoreTypes.h"
+
+#define LOCTEXT_NAMESPACE "K2Node_GetPrimaryKeyForAction"
+
+namespace
+{
+const FName PlayerControllerPinName(TEXT("PlayerController"));
+const FName ActionIdPinName(TEXT("ActionId"));
+}
+
+TArray<FString> UK2Node_GetPrimaryKeyForAction::GetActionNameOptions() const
+{
+    return FInputActionNodeNames::GetOptions(false);
+}
+
+void UK2Node_GetPrimaryKeyForAction::AllocateDefaultPins()
+{
+    CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Object, APlayerController::StaticClass(), PlayerControllerPinName);
+    CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Struct, FKey::StaticStruct(), UEdGraphSchema_K2::PN_ReturnValue);
+
+    Super::AllocateDefaultPins();
+}
+
+FText UK2Node_GetPrimaryKeyForAction::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+    if (ActionName.IsNone() || TitleType == ENodeTitleType::MenuTitle)
+    {
+        return LOCTEXT("MenuTitle", "Get Primary Key For Action (Compiled)");
+    }
+    return FText::Format(LOCTEXT("Title", "Get Primary Key For {0}"), FText::FromName(ActionName));
+}
+
+FText UK2Node_GetPrimaryKeyForAction::GetTooltipText() const
+{
+    return LOCTEXT("Tooltip", "Primary (first) key bound to the selected action for a player.\nThe action is picked in the node's details and checked when the Blueprint compiles; the compiled graph uses its id, not its name.");
+}
+
+void UK2Node_GetPrimaryKeyForAction::PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UK2Node_GetPrimaryKeyForAction, ActionName))
+    {
+        ReconstructNode();
+        FBlueprintEditorUtils::MarkBlueprintAsModified(GetBlueprint());
+    }
+}
+
+void UK2Node_GetPrimaryKeyForAction::ExpandNode(FKismetCompilerContext &CompilerContext, UEdGraph *SourceGraph)
+{
+    Super::ExpandNode(CompilerContext, SourceGraph);
+
+    UK2Node_CallFunction *CallNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+    CallNode->FunctionReference.SetExternalMember(GET_FUNCTION_NAME_CHECKED(UCPP_BPL_InputBinding, GetPrimaryKeyForActionId), UCPP_BPL_InputBinding::StaticClass());
+    CallNode->AllocateDefaultPins();
+
+    CallNode->FindPinChecked(ActionIdPinName)->DefaultValue = LexToString(UCPP_InputActionDefinitionRegistry::MakeActionId(ActionName));
+    CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(PlayerControllerPinName), *CallNode->FindPinChecked(PlayerControllerPinName));
+    CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(UEdGraphSchema_K2::PN_ReturnValue), *CallNode->GetReturnValuePin());
+
+    BreakAllNodeLinks();
+}
+
+void UK2Node_GetPrimaryKeyForAction::ValidateNodeDuringCompilation(FCompilerResultsLog &MessageLog) const
+{
+    Super::ValidateNodeDuringCompilation(MessageLog);
+    FInputActionNodeNames::Validate(this, ActionName, false, MessageLog);
+}
+
+void UK2Node_GetPrimaryKeyForAction::GetMenuActions(FBlueprintActionDatabaseRegistrar &ActionRegistrar) const
+{
+    UClass *ActionKey = GetClass();
+    if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+    {
+        UBlueprintNodeSpawner *NodeSpawner = UBlueprintNodeSpawner::Create(ActionKey);
+        check(NodeSpawner != nullptr);
+        ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+    }
+}
+
+FText UK2Node_GetPrimaryKeyForAction::GetMenuCategory() const
+{
+    return LOCTEXT("MenuCategory", "Input Binding|Player Action");
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,100 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Blueprint node - Wait For Input Action on an action picked from a dropdown and resolved at compile time
+ * @Date: 19/10/2026
+ */
+
+#include "K2Node_WaitForInputAction.h"
+#include "InputActionNodeNames.h"
+#include "Manager/CPP_BPL_InputBinding.h"
+#include "Manager/CPP_InputActionDefinitionRegistry.h"
+#include "Integration/CPP_AsyncAction_WaitForInputAction.h"
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+
+#define LOCTEXT_NAMESPACE "K2Node_WaitForInputAction"
+
+UK2Node_WaitForInputAction::UK2Node_WaitForInputAction()
+{
+    ProxyFactoryFunctionName = GET_FUNCTION_NAME_CHECKED(UCPP_BPL_InputBinding, WaitForInputActionById);
+    ProxyFactoryClass = UCPP_BPL_InputBinding::StaticClass();
+    ProxyClass = UAsyncAction_WaitForInputAction::StaticClass();
+    ProxyActivateFunctionName = GET_FUNCTION_NAME_CHECKED(UBlueprintAsyncActionBase, Activate);
+}
+
+TArray<FString> UK2Node_WaitForInputAction::GetActionNameOptions() const
+{
+    return FInputActionNodeNames::GetOptions(true);
+}
+
+void UK2Node_WaitForInputAction::AllocateDefaultPins()
+{
+    Super::AllocateDefaultPins();
+    UpdateActionIdPin();
+}
+
+void UK2Node_WaitForInputAction::UpdateActionIdPin()
+{
+    if (UEdGraphPin *ActionIdPin = FindPin(TEXT("ActionId")))
+    {
+        ActionIdPin->bHidden = true;
+        ActionIdPin->DefaultValue = LexToString(UCPP_InputActionDefinitionRegistry::MakeActionId(ActionName));
+    }
+}
+
+FText UK2Node_WaitForInputAction::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+    if (ActionName.IsNone() || TitleType == ENodeTitleType::MenuTitle)
+    {
+        return LOCTEXT("MenuTitle", "Wait For Input Action (Compiled)");
+    }
+    return FText::Format(LOCTEXT("Title", "Wait For {0}"), FText::FromName(ActionName));
+}
+
+FText UK2Node_WaitForInputAction::GetTooltipText() const
+{
+    return LOCTEXT("Tooltip", "Wait for the selected action to fire events.\nThe action is picked in the node's details and checked when the Blueprint compiles; the compiled graph uses its id, not its name.");
+}
+
+void UK2Node_WaitForInputAction::PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UK2Node_WaitForInputAction, ActionName))
+    {
+        ReconstructNode();
+        FBlueprintEditorUtils::MarkBlueprintAsModified(GetBlueprint());
+    }
+}
+
+void UK2Node_WaitForInputAction::ExpandNode(FKismetCompilerContext &CompilerContext, UEdGraph *SourceGraph)
+{
+    // The base expansion passes the hidden pin's default on to the factory call
+    UpdateActionIdPin();
+    Super::ExpandNode(CompilerContext, SourceGraph);
+}
+
+void UK2Node_WaitForInputAction::ValidateNodeDuringCompilation(FCompilerResultsLog &MessageLog) const
+{
+    Super::ValidateNodeDuringCompilation(MessageLog);
+    FInputActionNodeNames::Validate(this, ActionName, true, MessageLog);
+}
+
+void UK2Node_WaitForInputAction::GetMenuActions(FBlueprintActionDatabaseRegistrar &ActionRegistrar) const
+{
+    UClass *ActionKey = GetClass();
+    if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+    {
+        UBlueprintNodeSpawner *NodeSpawner = UBlueprintNodeSpawner::Create(ActionKey);
+        check(NodeSpawner != nullptr);
+        ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+    }
+}
+
+FText UK2Node_WaitForInputAction::GetMenuCategory() const
+{
+    return LOCTEXT("MenuCategory", "P_MEIS|Async");
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,24 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - Editor Module Implementation
+ * @Date: 19/10/2026
+ */
+
+#include "P_MEISEditor.h"
+
+#define LOCTEXT_NAMESPACE "FP_MEISEditorModule"
+
+void FP_MEISEditorModule::StartupModule()
+{
+// K2 nodes register themselves through GetMenuActions; nothing to set up here
+UE_LOG(LogTemp, Log, TEXT("P_MEIS: Editor Module Started"));
+}
+
+void FP_MEISEditorModule::ShutdownModule()
+{
+UE_LOG(LogTemp, Log, TEXT("P_MEIS: Editor Module Shutdown"));
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FP_MEISEditorModule, P_MEISEditor)
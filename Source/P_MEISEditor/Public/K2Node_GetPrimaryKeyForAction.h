@@ -0,0 +1,45 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Blueprint node - primary key of an action picked from a dropdown and resolved at compile time
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node.h"
+#include "K2Node_GetPrimaryKeyForAction.generated.h"
+
+/**
+ * Get Primary Key For Action, with the action chosen in the node's details instead of typed into a name pin
+ *
+ * The action list comes from the profile templates and action definitions. Compiling fails on an
+ * unknown action, and the node expands to UCPP_BPL_InputBinding::GetPrimaryKeyForActionId with the
+ * action's id baked in, so no name is built or searched for at runtime.
+ */
+UCLASS()
+class P_MEISEDITOR_API UK2Node_GetPrimaryKeyForAction : public UK2Node
+{
+    GENERATED_BODY()
+
+public:
+    /** Action to look up; resolved to its id when the Blueprint compiles */
+    UPROPERTY(EditAnywhere, Category = "Input Action", meta = (GetOptions = "GetActionNameOptions"))
+    FName ActionName;
+
+    UFUNCTION()
+    TArray<FString> GetActionNameOptions() const;
+
+    // UEdGraphNode interface
+    virtual void AllocateDefaultPins() override;
+    virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+    virtual FText GetTooltipText() const override;
+    virtual void PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent) override;
+
+    // UK2Node interface
+    virtual bool IsNodePure() const override { return true; }
+    virtual void ExpandNode(FKismetCompilerContext &CompilerContext, UEdGraph *SourceGraph) override;
+    virtual void ValidateNodeDuringCompilation(FCompilerResultsLog &MessageLog) const override;
+    virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar &ActionRegistrar) const override;
+    virtual FText GetMenuCategory() const override;
+};
@@ -0,0 +1,49 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Blueprint node - Wait For Input Action on an action picked from a dropdown and resolved at compile time
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node_BaseAsyncTask.h"
+#include "K2Node_WaitForInputAction.generated.h"
+
+/**
+ * Wait For Input Action with the action chosen in the node's details instead of typed into a name pin
+ *
+ * Same output pins as the regular async node. Compiling fails on an unknown action, and the node
+ * calls UCPP_BPL_InputBinding::WaitForInputActionById with the action's id baked into a hidden pin.
+ */
+UCLASS()
+class P_MEISEDITOR_API UK2Node_WaitForInputAction : public UK2Node_BaseAsyncTask
+{
+    GENERATED_BODY()
+
+public:
+    UK2Node_WaitForInputAction();
+
+    /** Action to wait for (actions and axes); resolved to its id when the Blueprint compiles */
+    UPROPERTY(EditAnywhere, Category = "Input Action", meta = (GetOptions = "GetActionNameOptions"))
+    FName ActionName;
+
+    UFUNCTION()
+    TArray<FString> GetActionNameOptions() const;
+
+    // UEdGraphNode interface
+    virtual void AllocateDefaultPins() override;
+    virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+    virtual FText GetTooltipText() const override;
+    virtual void PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent) override;
+
+    // UK2Node interface
+    virtual void ExpandNode(FKismetCompilerContext &CompilerContext, UEdGraph *SourceGraph) override;
+    virtual void ValidateNodeDuringCompilation(FCompilerResultsLog &MessageLog) const override;
+    virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar &ActionRegistrar) const override;
+    virtual FText GetMenuCategory() const override;
+
+private:
+    /** Hide the id pin and give it the id of ActionName */
+    void UpdateActionIdPin();
+};
@@ -0,0 +1,23 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - Editor Module Header
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+/**
+ * P_MEISEditor Module Interface
+ * Blueprint nodes that resolve input actions at compile time
+ */
+class FP_MEISEditorModule : public IModuleInterface
+{
+public:
+
+/** IModuleInterface implementation */
+virtual void StartupModule() override;
+virtual void ShutdownModule() override;
+};
@@ -0,0 +1,26 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - Low level tests Build.cs.
+ * @Date: 19/10/2026
+ */
+
+using UnrealBuildTool;
+
+// Catch2 tests and microbenchmarks for the data cores of the P_MEIS runtime module
+public class P_MEISTests : TestModuleRules
+{
+	public P_MEISTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"InputCore",
+				"EnhancedInput",
+				"Json",
+				"P_MEIS",
+			}
+			);
+	}
+}
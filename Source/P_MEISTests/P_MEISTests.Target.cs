@@ -0,0 +1,23 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - Low level tests Target.cs.
+ * @Date: 19/10/2026
+ */
+
+using UnrealBuildTool;
+
+// Standalone Catch2 program; no editor, world or GEngine is created
+public class P_MEISTestsTarget : TestTargetRules
+{
+	public P_MEISTestsTarget(TargetInfo Target) : base(Target)
+	{
+		// P_MEIS links Engine and its types need UObject reflection
+		bTestsRequireCoreUObject = true;
+		bTestsRequireEngine = true;
+		bTestsRequireApplicationCore = true;
+		bMockEngineDefaults = true;
+
+		EnablePlugins.Add("EnhancedInput");
+		EnablePlugins.Add("P_MEIS");
+	}
+}
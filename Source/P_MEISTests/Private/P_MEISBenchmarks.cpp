@@ -0,0 +1,150 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - Benchmarks for the profile, network, macro and analytics cores
+ * @Date: 19/10/2026
+ */
+
+#include "TestHarness.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "P_MEISTestProfiles.h"
+#include "Manager/CPP_InputAnalytics.h"
+#include "Manager/CPP_InputMacroSystem.h"
+#include "Network/InputCommandSerializer.h"
+#include "Storage/CPP_InputCompressedFile.h"
+#include "Storage/CPP_InputProfileStorage.h"
+#include "Validation/CPP_InputValidator.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+// Hidden from the default run; select with "[benchmark]"
+
+TEST_CASE("P_MEIS::Benchmarks::ProfileCodecs", "[.][benchmark][P_MEIS]")
+{
+    const FS_InputProfile Profile = P_MEISTests::MakeTestProfile(128, 8);
+    const FString Json = UCPP_InputProfileStorage::SerializeProfileToJson(Profile);
+
+    TArray<uint8> Compressed;
+    UCPP_InputCompressedFile::EncodeString(Json, EP_MEIS_CompressionFormat::Zlib, Compressed);
+
+    BENCHMARK("Serialize profile to JSON")
+    {
+        return UCPP_InputProfileStorage::SerializeProfileToJson(Profile);
+    };
+
+    BENCHMARK("Deserialize profile from JSON")
+    {
+        FS_InputProfile Loaded;
+        UCPP_InputProfileStorage::DeserializeProfileFromJson(Json, Loaded);
+        return Loaded.ActionBindings.Num();
+    };
+
+    BENCHMARK("Zlib encode")
+    {
+        TArray<uint8> Bytes;
+        UCPP_InputCompressedFile::EncodeString(Json, EP_MEIS_CompressionFormat::Zlib, Bytes);
+        return Bytes.Num();
+    };
+
+    BENCHMARK("Zlib decode")
+    {
+        FString Decoded;
+        UCPP_InputCompressedFile::DecodeString(Compressed, Decoded);
+        return Decoded.Len();
+    };
+}
+
+TEST_CASE("P_MEIS::Benchmarks::InputCommands", "[.][benchmark][P_MEIS]")
+{
+    const FInputCommandLayout Layout = FInputCommandLayout::Build(P_MEISTests::MakeTestProfile(40, 3), FS_InputCommandSettings());
+
+    FInputCommandSerializer::FFrameArray Frames;
+    for (int32 FrameNumber = 0; FrameNumber < Layout.Settings.RedundantFrames; ++FrameNumber)
+    {
+        FInputCommandFrame &Frame = Frames.AddDefaulted_GetRef();
+        Frame.Reset(Layout, FrameNumber);
+        Frame.SetDigital(FrameNumber, true);
+        Frame.AxisValues[0] = Layout.Quantize(0.5f);
+    }
+
+    FBitWriter Packet(0, true);
+    FInputCommandSerializer::Write(Packet, Layout, Frames, nullptr);
+
+    BENCHMARK("Write command packet")
+    {
+        FBitWriter Writer(0, true);
+        FInputCommandSerializer::Write(Writer, Layout, Frames, nullptr);
+        return Writer.GetNumBits();
+    };
+
+    BENCHMARK("Read command packet")
+    {
+        FBitReader Reader(Packet.GetData(), Packet.GetNumBits());
+        FInputCommandHistory History;
+        FInputCommandSerializer::FFrameArray Decoded;
+        return FInputCommandSerializer::Read(Reader, Layout, History, Decoded);
+    };
+}
+
+TEST_CASE("P_MEIS::Benchmarks::DetectConflicts", "[.][benchmark][P_MEIS]")
+{
+    const FS_InputProfile Profile = P_MEISTests::MakeTestProfile(256, 0);
+
+    BENCHMARK("Detect conflicts (256 actions)")
+    {
+        TArray<TPair<FName, FName>> Conflicts;
+        return UCPP_InputValidator::DetectConflicts(Profile.ActionBindings, Conflicts);
+    };
+}
+
+TEST_CASE("P_MEIS::Benchmarks::CompileMacro", "[.][benchmark][P_MEIS]")
+{
+    FS_InputMacro Macro;
+    Macro.MacroName = TEXT("Combo");
+    Macro.bLoop = true;
+    for (int32 Index = 0; Index < 64; ++Index)
+    {
+        FS_MacroStep &Step = Macro.Steps.AddDefaulted_GetRef();
+        Step.ActionName = FName(TEXT("Action"), Index % FMacroProgram::MaxActions + 1);
+        Step.Duration = 0.05f;
+        Step.DelayAfter = 0.02f;
+    }
+
+    const auto ResolveNothing = [](const FKey &Key)
+    {
+        return FName();
+    };
+
+    BENCHMARK("Compile macro (64 steps)")
+    {
+        FMacroProgram Program;
+        UCPP_InputMacroSystem::CompileMacro(Macro, ResolveNothing, Program);
+        return Program.Code.Num();
+    };
+}
+
+TEST_CASE("P_MEIS::Benchmarks::AnalyticsMerge", "[.][benchmark][P_MEIS]")
+{
+    FInputAnalyticsSummary Session;
+    Session.Sessions = 1;
+    Session.DurationSeconds = 600.0;
+    for (int32 Index = 0; Index < 64; ++Index)
+    {
+        FInputKeyUsageTotals &Key = Session.Keys.Add(FName(TEXT("Key"), Index + 1));
+        Key.Presses = 100;
+        Key.HoldTimes.Add(0.1f * (Index + 1));
+
+        FInputActionUsageTotals &Action = Session.Actions.Add(FName(TEXT("Action"), Index + 1));
+        Action.UsesPerContext.Add(TEXT("Gameplay"), 100);
+        Action.HoldTimes = Key.HoldTimes;
+    }
+
+    BENCHMARK("Merge session summary (64 keys, 64 actions)")
+    {
+        FInputAnalyticsSummary Total;
+        for (int32 Index = 0; Index < 16; ++Index)
+        {
+            Total.Merge(Session);
+        }
+        return Total.Sessions;
+    };
+}
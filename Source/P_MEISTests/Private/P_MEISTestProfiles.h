@@ -0,0 +1,72 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - Profiles shared by the low level tests and benchmarks
+ * @Date: 19/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputCoreTypes.h"
+#include "InputBinding/FS_InputProfile.h"
+
+namespace P_MEISTests
+{
+    /** Keys handed out to generated bindings in order; wraps with Shift/Ctrl variants past the end */
+    inline FKey GetTestKey(int32 Index)
+    {
+        static const TCHAR *const KeyNames[] = {
+            TEXT("A"), TEXT("B"), TEXT("C"), TEXT("D"), TEXT("E"), TEXT("F"), TEXT("G"), TEXT("H"),
+            TEXT("I"), TEXT("J"), TEXT("K"), TEXT("L"), TEXT("M"), TEXT("N"), TEXT("O"), TEXT("P"),
+            TEXT("Q"), TEXT("R"), TEXT("S"), TEXT("T"), TEXT("U"), TEXT("V"), TEXT("W"), TEXT("X"),
+            TEXT("Y"), TEXT("Z"), TEXT("One"), TEXT("Two"), TEXT("Three"), TEXT("Four"), TEXT("Five"), TEXT("Six")};
+        return FKey(KeyNames[Index % UE_ARRAY_COUNT(KeyNames)]);
+    }
+
+    /**
+     * Profile with NumActions action bindings (two keys each) and NumAxes 2D axis bindings
+     * Up to 256 actions no two bindings share a chord (32 keys times 16 modifier combinations).
+     */
+    inline FS_InputProfile MakeTestProfile(int32 NumActions, int32 NumAxes)
+    {
+        FS_InputProfile Profile;
+        Profile.ProfileName = TEXT("TestProfile");
+        Profile.ProfileDescription = FText::FromString(TEXT("Generated by P_MEISTests"));
+        Profile.CreatedBy = TEXT("P_MEISTests");
+
+        const int32 KeysPerModifierSet = 32;
+        for (int32 Index = 0; Index < NumActions; ++Index)
+        {
+            FS_InputActionBinding &Action = Profile.ActionBindings.AddDefaulted_GetRef();
+            Action.InputActionName = FName(TEXT("Action"), Index + 1);
+            Action.DisplayName = FText::FromString(FString::Printf(TEXT("Action %d"), Index));
+            Action.Priority = static_cast<float>(Index % 4);
+
+            for (int32 KeySlot = 0; KeySlot < 2; ++KeySlot)
+            {
+                const int32 KeyIndex = Index * 2 + KeySlot;
+                const int32 ModifierSet = KeyIndex / KeysPerModifierSet;
+
+                FS_KeyBinding &KeyBinding = Action.KeyBindings.AddDefaulted_GetRef();
+                KeyBinding.Key = GetTestKey(KeyIndex);
+                KeyBinding.bShift = (ModifierSet & 1) != 0;
+                KeyBinding.bCtrl = (ModifierSet & 2) != 0;
+                KeyBinding.bAlt = (ModifierSet & 4) != 0;
+                KeyBinding.bCmd = (ModifierSet & 8) != 0;
+            }
+        }
+
+        for (int32 Index = 0; Index < NumAxes; ++Index)
+        {
+            FS_InputAxisBinding &Axis = Profile.AxisBindings.AddDefaulted_GetRef();
+            Axis.InputAxisName = FName(TEXT("Axis"), Index + 1);
+            Axis.ValueType = EInputActionValueType::Axis2D;
+            Axis.DeadZone = 0.1f + 0.01f * Index;
+            Axis.Sensitivity = 1.0f + 0.5f * Index;
+
+            FS_AxisKeyBinding &AxisKey = Axis.AxisBindings.AddDefaulted_GetRef();
+            AxisKey.Key = Index % 2 == 0 ? EKeys::Gamepad_Left2D : EKeys::Gamepad_Right2D;
+        }
+        return Profile;
+    }
+}
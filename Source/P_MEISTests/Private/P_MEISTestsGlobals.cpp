@@ -0,0 +1,22 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - Low level test program setup
+ * @Date: 19/10/2026
+ */
+
+#include "TestHarness.h"
+#include "TestCommon/Initialization.h"
+#include "InputCoreTypes.h"
+
+GROUP_BEFORE_GLOBAL(Catch::DefaultGroup)
+{
+    InitAll(true, true);
+
+    // Key validity (macro steps, profile keys) needs the key details table
+    EKeys::Initialize();
+}
+
+GROUP_AFTER_GLOBAL(Catch::DefaultGroup)
+{
+    CleanupAll();
+}
@@ -0,0 +1,134 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - Analytics histogram and summary merge tests
+ * @Date: 19/10/2026
+ */
+
+#include "TestHarness.h"
+#include "Manager/CPP_InputAnalytics.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    FInputAnalyticsSummary MakeSession(float HoldSeconds, FName Context)
+    {
+        FInputAnalyticsSummary Summary;
+        Summary.Sessions = 1;
+        Summary.DurationSeconds = 60.0;
+
+        FInputKeyUsageTotals &Key = Summary.Keys.Add(TEXT("SpaceBar"));
+        Key.Presses = 3;
+        Key.HoldSeconds = 3.0 * HoldSeconds;
+        for (int32 Index = 0; Index < 3; ++Index)
+        {
+            Key.HoldTimes.Add(HoldSeconds);
+        }
+
+        FInputActionUsageTotals &Action = Summary.Actions.Add(TEXT("Jump"));
+        Action.UsesPerContext.Add(Context, 3);
+        Action.Rebinds = 1;
+        Action.SessionsRebound = 1;
+        Action.HoldTimes = Key.HoldTimes;
+        return Summary;
+    }
+}
+
+TEST_CASE("P_MEIS::Analytics::HoldHistogram", "[P_MEIS][Analytics]")
+{
+    FInputHoldHistogram Histogram;
+    CHECK(Histogram.GetPercentile(50.0f) == 0.0f);
+
+    for (int32 Index = 0; Index < 9; ++Index)
+    {
+        Histogram.Add(0.005f);
+    }
+    Histogram.Add(1.0f);
+    REQUIRE(Histogram.Total == 10);
+
+    SECTION("Percentiles report the upper edge of their bucket")
+    {
+        CHECK(Histogram.GetPercentile(50.0f) == FInputHoldHistogram::GetBucketUpperBound(0));
+        CHECK(Histogram.GetPercentile(90.0f) == FInputHoldHistogram::GetBucketUpperBound(0));
+
+        const float Top = Histogram.GetPercentile(100.0f);
+        CHECK(Top >= 1.0f);
+        CHECK(Top < 1.0f * 1.2f + KINDA_SMALL_NUMBER);
+    }
+
+    SECTION("Holds past the last bucket are clamped into it")
+    {
+        Histogram.Add(10000.0f);
+        CHECK(Histogram.GetPercentile(100.0f) == FInputHoldHistogram::GetBucketUpperBound(FInputHoldHistogram::NumBuckets - 1));
+    }
+
+    SECTION("Merging adds counts bucket by bucket")
+    {
+        FInputHoldHistogram Merged = Histogram;
+        Merged.Merge(Histogram);
+        CHECK(Merged.Total == 20);
+        CHECK(Merged.Counts[0] == 18);
+        CHECK(Merged.GetPercentile(95.0f) == Histogram.GetPercentile(95.0f));
+    }
+
+    SECTION("JSON keeps every count")
+    {
+        FInputHoldHistogram Loaded;
+        Loaded.FromJson(Histogram.ToJson());
+        CHECK(Loaded.Total == Histogram.Total);
+        CHECK(FMemory::Memcmp(Loaded.Counts, Histogram.Counts, sizeof(Histogram.Counts)) == 0);
+    }
+}
+
+TEST_CASE("P_MEIS::Analytics::SummaryMerge", "[P_MEIS][Analytics]")
+{
+    FInputAnalyticsSummary Total;
+    Total.Merge(MakeSession(0.1f, TEXT("Gameplay")));
+    Total.Merge(MakeSession(2.0f, TEXT("Menu")));
+
+    CHECK(Total.Sessions == 2);
+    CHECK(FMath::IsNearlyEqual(Total.DurationSeconds, 120.0));
+
+    const FInputKeyUsageTotals *Key = Total.Keys.Find(TEXT("SpaceBar"));
+    REQUIRE(Key != nullptr);
+    CHECK(Key->Presses == 6);
+    CHECK(FMath::IsNearlyEqual(Key->HoldSeconds, 6.3, 1e-4));
+    CHECK(Key->HoldTimes.Total == 6);
+
+    const FInputActionUsageTotals *Action = Total.Actions.Find(TEXT("Jump"));
+    REQUIRE(Action != nullptr);
+    CHECK(Action->UsesPerContext.FindRef(TEXT("Gameplay")) == 3);
+    CHECK(Action->UsesPerContext.FindRef(TEXT("Menu")) == 3);
+    CHECK(Action->Rebinds == 2);
+    CHECK(Action->SessionsRebound == 2);
+    CHECK(Action->HoldTimes.GetPercentile(100.0f) >= 2.0f);
+
+    SECTION("Summaries survive a JSON round trip")
+    {
+        FString Json;
+        const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+        REQUIRE(FJsonSerializer::Serialize(Total.ToJson(), Writer));
+
+        TSharedPtr<FJsonObject> JsonObject;
+        REQUIRE(FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), JsonObject));
+
+        FInputAnalyticsSummary Loaded;
+        REQUIRE(Loaded.FromJson(JsonObject));
+        CHECK(Loaded.Sessions == Total.Sessions);
+        CHECK(Loaded.Keys.FindRef(TEXT("SpaceBar")).Presses == 6);
+        CHECK(Loaded.Keys.FindRef(TEXT("SpaceBar")).HoldTimes.Total == 6);
+        CHECK(Loaded.Actions.FindRef(TEXT("Jump")).UsesPerContext.Num() == 2);
+        CHECK(Loaded.Actions.FindRef(TEXT("Jump")).Rebinds == 2);
+    }
+
+    SECTION("Files from a newer format are rejected")
+    {
+        TSharedRef<FJsonObject> JsonObject = Total.ToJson();
+        JsonObject->SetNumberField(TEXT("Version"), FInputAnalyticsSummary::FormatVersion + 1);
+
+        FInputAnalyticsSummary Loaded;
+        CHECK_FALSE(Loaded.FromJson(JsonObject));
+    }
+}
@@ -0,0 +1,96 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - Compiled profile (hash, command layout, action id) tests
+ * @Date: 19/10/2026
+ */
+
+#include "TestHarness.h"
+#include "Algo/Reverse.h"
+#include "P_MEISTestProfiles.h"
+#include "Integration/CPP_EnhancedInputIntegration.h"
+#include "Manager/CPP_InputActionDefinitionRegistry.h"
+#include "Network/InputCommandSerializer.h"
+
+TEST_CASE("P_MEIS::CompiledProfiles::ProfileHash", "[P_MEIS][CompiledProfiles]")
+{
+    const FS_InputProfile Profile = P_MEISTests::MakeTestProfile(32, 4);
+    const uint32 Hash = UCPP_EnhancedInputIntegration::ComputeProfileHash(Profile);
+
+    SECTION("Metadata outside the bindings does not change the hash")
+    {
+        FS_InputProfile Renamed = Profile;
+        Renamed.ProfileName = TEXT("Renamed");
+        Renamed.ProfileDescription = FText::FromString(TEXT("Other"));
+        Renamed.Timestamp = FDateTime(2026, 10, 19);
+        CHECK(UCPP_EnhancedInputIntegration::ComputeProfileHash(Renamed) == Hash);
+    }
+
+    SECTION("The hash is never the 'nothing applied' value")
+    {
+        CHECK(UCPP_EnhancedInputIntegration::ComputeProfileHash(FS_InputProfile()) != 0);
+        CHECK(Hash != 0);
+    }
+
+    SECTION("A rebind changes the hash")
+    {
+        FS_InputProfile Rebound = Profile;
+        Rebound.ActionBindings[7].KeyBindings[0].Key = EKeys::Gamepad_FaceButton_Bottom;
+        CHECK(UCPP_EnhancedInputIntegration::ComputeProfileHash(Rebound) != Hash);
+    }
+
+    SECTION("Chord modifiers change the hash")
+    {
+        FS_InputProfile Chorded = Profile;
+        Chorded.ActionBindings[0].KeyBindings[0].bCtrl = !Chorded.ActionBindings[0].KeyBindings[0].bCtrl;
+        CHECK(UCPP_EnhancedInputIntegration::ComputeProfileHash(Chorded) != Hash);
+    }
+
+    SECTION("Axis tuning changes the hash")
+    {
+        FS_InputProfile Tuned = Profile;
+        Tuned.AxisBindings[2].Sensitivity *= 2.0f;
+        CHECK(UCPP_EnhancedInputIntegration::ComputeProfileHash(Tuned) != Hash);
+    }
+}
+
+TEST_CASE("P_MEIS::CompiledProfiles::CommandLayout", "[P_MEIS][CompiledProfiles]")
+{
+    const FS_InputProfile Profile = P_MEISTests::MakeTestProfile(20, 3);
+    const FInputCommandLayout Layout = FInputCommandLayout::Build(Profile, FS_InputCommandSettings());
+
+    SECTION("Binding order does not affect the layout")
+    {
+        FS_InputProfile Shuffled = Profile;
+        Algo::Reverse(Shuffled.ActionBindings);
+        Algo::Reverse(Shuffled.AxisBindings);
+
+        const FInputCommandLayout Other = FInputCommandLayout::Build(Shuffled, FS_InputCommandSettings());
+        CHECK(Other.Hash == Layout.Hash);
+        CHECK(Other.DigitalActions == Layout.DigitalActions);
+    }
+
+    SECTION("Quantization settings are part of the hash")
+    {
+        FS_InputCommandSettings Settings;
+        Settings.AxisBits = 12;
+        CHECK(FInputCommandLayout::Build(Profile, Settings).Hash != Layout.Hash);
+    }
+
+    SECTION("Boolean axes become digital actions")
+    {
+        FS_InputProfile WithBoolean = Profile;
+        WithBoolean.AxisBindings[0].ValueType = EInputActionValueType::Boolean;
+
+        const FInputCommandLayout Other = FInputCommandLayout::Build(WithBoolean, FS_InputCommandSettings());
+        CHECK(Other.DigitalActions.Num() == Layout.DigitalActions.Num() + 1);
+        CHECK(Other.Axes.Num() == Layout.Axes.Num() - 1);
+    }
+}
+
+TEST_CASE("P_MEIS::CompiledProfiles::ActionIds", "[P_MEIS][CompiledProfiles]")
+{
+    CHECK(UCPP_InputActionDefinitionRegistry::MakeActionId(NAME_None) == 0);
+    CHECK(UCPP_InputActionDefinitionRegistry::MakeActionId(TEXT("Jump")) != 0);
+    CHECK(UCPP_InputActionDefinitionRegistry::MakeActionId(TEXT("Jump")) == UCPP_InputActionDefinitionRegistry::MakeActionId(TEXT("jump")));
+    CHECK(UCPP_InputActionDefinitionRegistry::MakeActionId(TEXT("Jump")) != UCPP_InputActionDefinitionRegistry::MakeActionId(TEXT("Crouch")));
+}
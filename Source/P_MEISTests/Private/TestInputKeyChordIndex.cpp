@@ -0,0 +1,88 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - Key chord index and conflict detection tests
+ * @Date: 19/10/2026
+ */
+
+#include "TestHarness.h"
+#include "P_MEISTestProfiles.h"
+#include "Validation/InputKeyChordIndex.h"
+#include "Validation/CPP_InputValidator.h"
+
+TEST_CASE("P_MEIS::KeyChordIndex::Chords", "[P_MEIS][KeyChordIndex]")
+{
+    SECTION("Modifiers are part of the chord")
+    {
+        CHECK(FInputKeyChord(TEXT("E"), false, false, false, false) == FInputKeyChord(TEXT("E"), false, false, false, false));
+        CHECK_FALSE(FInputKeyChord(TEXT("E"), true, false, false, false) == FInputKeyChord(TEXT("E"), false, false, false, false));
+        CHECK_FALSE(FInputKeyChord(TEXT("E"), false, true, false, false) == FInputKeyChord(TEXT("E"), false, false, true, false));
+    }
+
+    SECTION("Owners stay sorted and a repeated chord of one owner is stored once")
+    {
+        FInputKeyChordIndex Index;
+        const FInputKeyChord Chord(TEXT("Q"), false, false, false, false);
+        Index.Add(Chord, 0);
+        Index.Add(Chord, 0);
+        Index.Add(Chord, 3);
+
+        const TArray<int32, TInlineAllocator<2>> *Owners = Index.Find(Chord);
+        REQUIRE(Owners != nullptr);
+        REQUIRE(Owners->Num() == 2);
+        CHECK((*Owners)[0] == 0);
+        CHECK((*Owners)[1] == 3);
+        CHECK(Index.Find(FInputKeyChord(TEXT("Q"), true, false, false, false)) == nullptr);
+    }
+
+    SECTION("Every pair sharing a chord is visited once")
+    {
+        FInputKeyChordIndex Index;
+        const FInputKeyChord Shared(TEXT("Space"), false, false, false, false);
+        Index.Add(Shared, 1);
+        Index.Add(Shared, 2);
+        Index.Add(Shared, 5);
+        Index.Add(FInputKeyChord(TEXT("F"), false, false, false, false), 5);
+
+        TArray<TPair<int32, int32>> Pairs;
+        const int32 Count = Index.ForEachConflict([&Pairs](int32 A, int32 B)
+                                                  { Pairs.Emplace(A, B); });
+        CHECK(Count == 3);
+        CHECK(Index.Num() == 2);
+        CHECK(Pairs.Contains(TPair<int32, int32>(1, 2)));
+        CHECK(Pairs.Contains(TPair<int32, int32>(1, 5)));
+        CHECK(Pairs.Contains(TPair<int32, int32>(2, 5)));
+    }
+}
+
+TEST_CASE("P_MEIS::KeyChordIndex::DetectConflicts", "[P_MEIS][KeyChordIndex]")
+{
+    FS_InputProfile Profile = P_MEISTests::MakeTestProfile(64, 0);
+
+    SECTION("Distinct chords do not conflict")
+    {
+        TArray<TPair<FName, FName>> Conflicts;
+        CHECK_FALSE(UCPP_InputValidator::DetectConflicts(Profile.ActionBindings, Conflicts));
+        CHECK(Conflicts.Num() == 0);
+    }
+
+    SECTION("A shared chord is reported once per pair")
+    {
+        Profile.ActionBindings[40].KeyBindings[0] = Profile.ActionBindings[3].KeyBindings[1];
+
+        TArray<TPair<FName, FName>> Conflicts;
+        REQUIRE(UCPP_InputValidator::DetectConflicts(Profile.ActionBindings, Conflicts));
+        REQUIRE(Conflicts.Num() == 1);
+        CHECK(Conflicts[0].Key == Profile.ActionBindings[3].InputActionName);
+        CHECK(Conflicts[0].Value == Profile.ActionBindings[40].InputActionName);
+    }
+
+    SECTION("The same key with different modifiers does not conflict")
+    {
+        FS_KeyBinding KeyBinding = Profile.ActionBindings[3].KeyBindings[1];
+        KeyBinding.bAlt = !KeyBinding.bAlt;
+        Profile.ActionBindings[40].KeyBindings[0] = KeyBinding;
+
+        TArray<TPair<FName, FName>> Conflicts;
+        CHECK_FALSE(UCPP_InputValidator::DetectConflicts(Profile.ActionBindings, Conflicts));
+    }
+}
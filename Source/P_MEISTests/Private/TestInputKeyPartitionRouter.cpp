@@ -0,0 +1,69 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - Shared keyboard partition key selection tests
+ * @Date: 19/10/2026
+ */
+
+#include "TestHarness.h"
+#include "Integration/InputKeyPartitionRouter.h"
+
+namespace
+{
+    FS_InputProfile MakeSharedKeyboardProfile(const FKey &MoveKey, const FKey &FireKey)
+    {
+        FS_InputProfile Profile;
+
+        FS_InputActionBinding &Fire = Profile.ActionBindings.AddDefaulted_GetRef();
+        Fire.InputActionName = TEXT("Fire");
+        Fire.KeyBindings.AddDefaulted_GetRef().Key = FireKey;
+        Fire.KeyBindings.AddDefaulted_GetRef().Key = EKeys::LeftMouseButton;
+        Fire.KeyBindings.AddDefaulted_GetRef().Key = EKeys::Gamepad_RightTrigger;
+
+        FS_InputAxisBinding &Move = Profile.AxisBindings.AddDefaulted_GetRef();
+        Move.InputAxisName = TEXT("Move");
+        Move.AxisBindings.AddDefaulted_GetRef().Key = MoveKey;
+        Move.AxisBindings.AddDefaulted_GetRef().Key = EKeys::Gamepad_Left2D;
+
+        FS_InputAxisBinding &Look = Profile.AxisBindings.AddDefaulted_GetRef();
+        Look.InputAxisName = TEXT("Look");
+        Look.ValueType = EInputActionValueType::Axis2D;
+        Look.AxisBindings.AddDefaulted_GetRef().Key = EKeys::Mouse2D;
+        Look.AxisBindings.AddDefaulted_GetRef().Key = EKeys::MouseX;
+        Look.AxisBindings.AddDefaulted_GetRef().Key = EKeys::MouseWheelAxis;
+        return Profile;
+    }
+}
+
+TEST_CASE("P_MEIS::KeyPartitionRouter::KeyboardKeys", "[P_MEIS][KeyPartitionRouter]")
+{
+    const FS_InputProfile PlayerOne = MakeSharedKeyboardProfile(EKeys::W, EKeys::SpaceBar);
+    const FS_InputProfile PlayerTwo = MakeSharedKeyboardProfile(EKeys::Up, EKeys::Enter);
+
+    TArray<FKey> KeysOne;
+    TArray<FKey> KeysTwo;
+    FInputKeyPartitionRouter::GetKeyboardKeys(PlayerOne, KeysOne);
+    FInputKeyPartitionRouter::GetKeyboardKeys(PlayerTwo, KeysTwo);
+
+    SECTION("Only keyboard keys are partitioned")
+    {
+        CHECK(KeysOne.Num() == 2);
+        CHECK(KeysOne.Contains(EKeys::W));
+        CHECK(KeysOne.Contains(EKeys::SpaceBar));
+    }
+
+    SECTION("Mouse buttons and axes are never partitioned")
+    {
+        for (const FKey &Key : {EKeys::LeftMouseButton, EKeys::Mouse2D, EKeys::MouseX, EKeys::MouseWheelAxis})
+        {
+            CHECK_FALSE(KeysOne.Contains(Key));
+        }
+    }
+
+    SECTION("Players sharing the mouse do not overlap")
+    {
+        for (const FKey &Key : KeysOne)
+        {
+            CHECK_FALSE(KeysTwo.Contains(Key));
+        }
+    }
+}
@@ -0,0 +1,124 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - Macro lowering and assembly tests
+ * @Date: 19/10/2026
+ */
+
+#include "TestHarness.h"
+#include "Manager/CPP_InputMacroSystem.h"
+
+namespace
+{
+    FS_MacroStep MakeStep(FName ActionName, float Duration, float DelayAfter, bool bIsHold = false)
+    {
+        FS_MacroStep Step;
+        Step.ActionName = ActionName;
+        Step.Duration = Duration;
+        Step.DelayAfter = DelayAfter;
+        Step.bIsHold = bIsHold;
+        return Step;
+    }
+
+    // Resolver for macros whose steps all name their action
+    const auto ResolveNothing = [](const FKey &Key)
+    {
+        return FName();
+    };
+}
+
+TEST_CASE("P_MEIS::Macro::LowerSteps", "[P_MEIS][Macro]")
+{
+    SECTION("Tap steps lower to press, wait, release, wait")
+    {
+        TArray<FS_MacroInstruction> Instructions;
+        REQUIRE(UCPP_InputMacroSystem::LowerSteps({MakeStep(TEXT("Jump"), 0.1f, 0.2f)}, false, ResolveNothing, Instructions));
+        REQUIRE(Instructions.Num() == 4);
+        CHECK(Instructions[0].Op == EP_MEIS_MacroOp::Press);
+        CHECK(Instructions[0].ActionName == FName(TEXT("Jump")));
+        CHECK(Instructions[1].Op == EP_MEIS_MacroOp::Wait);
+        CHECK(Instructions[1].Value == 0.1f);
+        CHECK(Instructions[2].Op == EP_MEIS_MacroOp::Release);
+        CHECK(Instructions[3].Op == EP_MEIS_MacroOp::Wait);
+        CHECK(Instructions[3].Value == 0.2f);
+    }
+
+    SECTION("Held steps are not released and loops jump back")
+    {
+        TArray<FS_MacroInstruction> Instructions;
+        REQUIRE(UCPP_InputMacroSystem::LowerSteps({MakeStep(TEXT("Sprint"), 0.0f, 0.0f, true)}, true, ResolveNothing, Instructions));
+        REQUIRE(Instructions.Num() == 2);
+        CHECK(Instructions[0].Op == EP_MEIS_MacroOp::Press);
+        CHECK(Instructions[1].Op == EP_MEIS_MacroOp::Jump);
+    }
+
+    SECTION("Key-only steps lower to the action the key is bound to")
+    {
+        FS_MacroStep Step = MakeStep(NAME_None, 0.0f, 0.0f);
+        Step.Key = EKeys::SpaceBar;
+
+        TArray<FS_MacroInstruction> Instructions;
+        REQUIRE(UCPP_InputMacroSystem::LowerSteps({Step}, false, [](const FKey &Key)
+                                                  { return Key == EKeys::SpaceBar ? FName(TEXT("Jump")) : FName(); },
+                                                  Instructions));
+        REQUIRE(Instructions.Num() == 2);
+        CHECK(Instructions[0].ActionName == FName(TEXT("Jump")));
+        CHECK(Instructions[1].ActionName == FName(TEXT("Jump")));
+    }
+
+    SECTION("An unbound key rejects the macro")
+    {
+        FS_MacroStep Step = MakeStep(NAME_None, 0.0f, 0.0f);
+        Step.Key = EKeys::F13;
+
+        TArray<FS_MacroInstruction> Instructions;
+        CHECK_FALSE(UCPP_InputMacroSystem::LowerSteps({Step}, false, ResolveNothing, Instructions));
+    }
+
+    SECTION("Steps with neither key nor action only wait")
+    {
+        TArray<FS_MacroInstruction> Instructions;
+        REQUIRE(UCPP_InputMacroSystem::LowerSteps({MakeStep(NAME_None, 0.25f, 0.25f)}, false, ResolveNothing, Instructions));
+        REQUIRE(Instructions.Num() == 1);
+        CHECK(Instructions[0].Op == EP_MEIS_MacroOp::Wait);
+        CHECK(Instructions[0].Value == 0.5f);
+    }
+}
+
+TEST_CASE("P_MEIS::Macro::CompileMacro", "[P_MEIS][Macro]")
+{
+    SECTION("Actions are assigned slots once")
+    {
+        FS_InputMacro Macro;
+        Macro.MacroName = TEXT("Combo");
+        Macro.Steps = {MakeStep(TEXT("Light"), 0.05f, 0.0f), MakeStep(TEXT("Heavy"), 0.05f, 0.0f), MakeStep(TEXT("Light"), 0.05f, 0.0f)};
+
+        FMacroProgram Program;
+        REQUIRE(UCPP_InputMacroSystem::CompileMacro(Macro, ResolveNothing, Program));
+        CHECK(Program.Actions.Num() == 2);
+        CHECK(Program.Code.Num() == 9);
+        CHECK(Program.Code[6].Slot == Program.Code[0].Slot);
+    }
+
+    SECTION("Out-of-range jump targets are rejected")
+    {
+        FS_InputMacro Macro;
+        FS_MacroInstruction &Jump = Macro.Instructions.AddDefaulted_GetRef();
+        Jump.Op = EP_MEIS_MacroOp::Jump;
+        Jump.JumpTarget = 5;
+
+        FMacroProgram Program;
+        CHECK_FALSE(UCPP_InputMacroSystem::CompileMacro(Macro, ResolveNothing, Program));
+    }
+
+    SECTION("More actions than slots are rejected")
+    {
+        FS_InputMacro Macro;
+        for (int32 Index = 0; Index <= FMacroProgram::MaxActions; ++Index)
+        {
+            Macro.Steps.Add(MakeStep(FName(TEXT("Action"), Index + 1), 0.0f, 0.0f));
+        }
+
+        FMacroProgram Program;
+        CHECK_FALSE(UCPP_InputMacroSystem::CompileMacro(Macro, ResolveNothing, Program));
+    }
+}
@@ -0,0 +1,189 @@
+﻿/*
+ * @Author: Punal Manalan
+ * @Description: Modular Enhanced Input System - JSON, compressed and bit-packed codec tests
+ * @Date: 19/10/2026
+ */
+
+#include "TestHarness.h"
+#include "P_MEISTestProfiles.h"
+#include "Storage/CPP_InputProfileStorage.h"
+#include "Storage/CPP_InputCompressedFile.h"
+#include "Network/InputCommandSerializer.h"
+#include "Serialization/BitWriter.h"
+#include "Serialization/BitReader.h"
+
+namespace
+{
+    void CheckSameBindings(const FS_InputProfile &Expected, const FS_InputProfile &Actual)
+    {
+        CHECK(Actual.ProfileName == Expected.ProfileName);
+        CHECK(Actual.CreatedBy == Expected.CreatedBy);
+        REQUIRE(Actual.ActionBindings.Num() == Expected.ActionBindings.Num());
+        REQUIRE(Actual.AxisBindings.Num() == Expected.AxisBindings.Num());
+
+        for (int32 Index = 0; Index < Expected.ActionBindings.Num(); ++Index)
+        {
+            const FS_InputActionBinding &A = Expected.ActionBindings[Index];
+            const FS_InputActionBinding &B = Actual.ActionBindings[Index];
+            CHECK(B.InputActionName == A.InputActionName);
+            CHECK(B.DisplayName.ToString() == A.DisplayName.ToString());
+            CHECK(B.Priority == A.Priority);
+            REQUIRE(B.KeyBindings.Num() == A.KeyBindings.Num());
+            for (int32 KeyIndex = 0; KeyIndex < A.KeyBindings.Num(); ++KeyIndex)
+            {
+                CHECK(B.KeyBindings[KeyIndex].Key == A.KeyBindings[KeyIndex].Key);
+                CHECK(B.KeyBindings[KeyIndex].bShift == A.KeyBindings[KeyIndex].bShift);
+                CHECK(B.KeyBindings[KeyIndex].bCtrl == A.KeyBindings[KeyIndex].bCtrl);
+            }
+        }
+
+        for (int32 Index = 0; Index < Expected.AxisBindings.Num(); ++Index)
+        {
+            const FS_InputAxisBinding &A = Expected.AxisBindings[Index];
+            const FS_InputAxisBinding &B = Actual.AxisBindings[Index];
+            CHECK(B.InputAxisName == A.InputAxisName);
+            CHECK(B.ValueType == A.ValueType);
+            CHECK(FMath::IsNearlyEqual(B.DeadZone, A.DeadZone));
+            CHECK(FMath::IsNearlyEqual(B.Sensitivity, A.Sensitivity));
+            REQUIRE(B.AxisBindings.Num() == A.AxisBindings.Num());
+            CHECK(B.AxisBindings[0].Key == A.AxisBindings[0].Key);
+        }
+    }
+}
+
+TEST_CASE("P_MEIS::ProfileCodecs::Json", "[P_MEIS][Codecs]")
+{
+    FS_InputProfile Profile = P_MEISTests::MakeTestProfile(24, 4);
+    Profile.bAutoCalibrateSticks = true;
+
+    FS_StickCalibration Stick;
+    Stick.Stick = EKeys::Gamepad_Left2D.GetFName();
+    Stick.CenterOffset = FVector2D(0.05, -0.02);
+    Stick.DeadZone = 0.12f;
+    FS_DeviceStickCalibration::Store(Profile.StickCalibrations, TEXT("GamepadInput/DualSense"), Stick);
+
+    SECTION("Saved and self-contained JSON both round-trip")
+    {
+        for (bool bSelfContained : {false, true})
+        {
+            FS_InputProfile Loaded;
+            REQUIRE(UCPP_InputProfileStorage::DeserializeProfileFromJson(UCPP_InputProfileStorage::SerializeProfileToJson(Profile, bSelfContained), Loaded));
+            CheckSameBindings(Profile, Loaded);
+        }
+    }
+
+    SECTION("Stick calibrations are keyed by hardware id")
+    {
+        FS_InputProfile Loaded;
+        REQUIRE(UCPP_InputProfileStorage::DeserializeProfileFromJson(UCPP_InputProfileStorage::SerializeProfileToJson(Profile), Loaded));
+        const FS_StickCalibration *LoadedStick = FS_DeviceStickCalibration::Find(Loaded.StickCalibrations, TEXT("GamepadInput/DualSense"), Stick.Stick);
+        REQUIRE(LoadedStick != nullptr);
+        CHECK(FMath::IsNearlyEqual(LoadedStick->DeadZone, Stick.DeadZone));
+        CHECK(FMath::IsNearlyEqual(LoadedStick->CenterOffset.X, Stick.CenterOffset.X));
+    }
+
+    SECTION("Malformed JSON is rejected")
+    {
+        FS_InputProfile Loaded;
+        CHECK_FALSE(UCPP_InputProfileStorage::DeserializeProfileFromJson(TEXT("{\"ProfileName\": "), Loaded));
+    }
+}
+
+TEST_CASE("P_MEIS::ProfileCodecs::Compressed", "[P_MEIS][Codecs]")
+{
+    const FString Json = UCPP_InputProfileStorage::SerializeProfileToJson(P_MEISTests::MakeTestProfile(128, 8));
+
+    SECTION("Uncompressed bytes are plain UTF-8")
+    {
+        TArray<uint8> Bytes;
+        UCPP_InputCompressedFile::EncodeString(Json, EP_MEIS_CompressionFormat::None, Bytes);
+        CHECK_FALSE(UCPP_InputCompressedFile::IsCompressed(Bytes));
+
+        FString Decoded;
+        REQUIRE(UCPP_InputCompressedFile::DecodeString(Bytes, Decoded));
+        CHECK(Decoded == Json);
+    }
+
+    SECTION("Zlib round-trips and shrinks profile JSON")
+    {
+        TArray<uint8> Bytes;
+        UCPP_InputCompressedFile::EncodeString(Json, EP_MEIS_CompressionFormat::Zlib, Bytes);
+        REQUIRE(UCPP_InputCompressedFile::IsCompressed(Bytes));
+        CHECK(Bytes.Num() < Json.Len());
+
+        FString Decoded;
+        REQUIRE(UCPP_InputCompressedFile::DecodeString(Bytes, Decoded));
+        CHECK(Decoded == Json);
+    }
+
+    SECTION("Truncated or oversized blocks are rejected")
+    {
+        TArray<uint8> Bytes;
+        UCPP_InputCompressedFile::EncodeString(Json, EP_MEIS_CompressionFormat::Zlib, Bytes);
+
+        TArray<uint8> Truncated = Bytes;
+        Truncated.SetNum(Bytes.Num() - 16);
+        FString Decoded;
+        CHECK_FALSE(UCPP_InputCompressedFile::DecodeString(Truncated, Decoded));
+
+        // Header: magic (4), version (1), format (1), block size (4), total size (8)
+        TArray<uint8> HugeBlocks = Bytes;
+        const int32 BlockSize = MAX_int32;
+        FMemory::Memcpy(HugeBlocks.GetData() + 6, &BlockSize, sizeof(BlockSize));
+        CHECK_FALSE(UCPP_InputCompressedFile::DecodeString(HugeBlocks, Decoded));
+    }
+}
+
+TEST_CASE("P_MEIS::ProfileCodecs::InputCommands", "[P_MEIS][Codecs]")
+{
+    const FInputCommandLayout Layout = FInputCommandLayout::Build(P_MEISTests::MakeTestProfile(40, 3), FS_InputCommandSettings());
+    REQUIRE(Layout.IsValid());
+    REQUIRE(Layout.DigitalActions.Num() == 40);
+    REQUIRE(Layout.NumAxisComponents == 6);
+
+    FInputCommandSerializer::FFrameArray Frames;
+    for (int32 FrameNumber = 10; FrameNumber < 13; ++FrameNumber)
+    {
+        FInputCommandFrame &Frame = Frames.AddDefaulted_GetRef();
+        Frame.Reset(Layout, FrameNumber);
+        Frame.SetDigital(FrameNumber % Layout.DigitalActions.Num(), true);
+        Frame.SetDigital(35, true);
+        Frame.AxisValues[0] = Layout.Quantize(0.25f * (FrameNumber - 10));
+        Frame.AxisValues[5] = Layout.Quantize(-1.0f);
+    }
+
+    FBitWriter Writer(0, true);
+    FInputCommandSerializer::Write(Writer, Layout, Frames, nullptr);
+
+    SECTION("Frames decode to the same state")
+    {
+        FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+        FInputCommandHistory History;
+        FInputCommandSerializer::FFrameArray Decoded;
+        REQUIRE(FInputCommandSerializer::Read(Reader, Layout, History, Decoded));
+        REQUIRE(Decoded.Num() == Frames.Num());
+        for (int32 Index = 0; Index < Frames.Num(); ++Index)
+        {
+            CHECK(Decoded[Index].Frame == Frames[Index].Frame);
+            CHECK(Decoded[Index].HasSameState(Frames[Index]));
+        }
+    }
+
+    SECTION("A packet for another layout is rejected")
+    {
+        const FInputCommandLayout OtherLayout = FInputCommandLayout::Build(P_MEISTests::MakeTestProfile(41, 3), FS_InputCommandSettings());
+        FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+        FInputCommandHistory History;
+        FInputCommandSerializer::FFrameArray Decoded;
+        CHECK_FALSE(FInputCommandSerializer::Read(Reader, OtherLayout, History, Decoded));
+    }
+
+    SECTION("Quantization is within one step")
+    {
+        const float Step = Layout.Settings.AxisRange / Layout.GetMaxQuantized();
+        for (float Value : {-1.0f, -0.33f, 0.0f, 0.5f, 1.0f})
+        {
+            CHECK(FMath::Abs(Layout.Dequantize(Layout.Quantize(Value)) - Value) <= Step);
+        }
+    }
+}